@@ -44,6 +44,7 @@ list (APPEND MAIN_SOURCE_FILES
       src/opm/common/utility/numeric/calculateCellVol.cpp
       src/opm/common/utility/numeric/RootFinders.cpp
       src/opm/common/utility/shmatch.cpp
+      src/opm/common/utility/SnapshotFile.cpp
       src/opm/common/utility/String.cpp
       src/opm/common/utility/TimeService.cpp
       src/opm/material/common/Spline.cpp
@@ -54,7 +55,7 @@ list (APPEND MAIN_SOURCE_FILES
       src/opm/material/components/H2.cpp
       src/opm/material/densead/Evaluation.cpp
       src/opm/material/fluidmatrixinteractions/EclEpsScalingPoints.cpp
-      src/opm/material/fluidsystems/BlackOilFluidSystem.cpp
+      src/opm/material/fluidsystems/BlackOilFluidSystemNonStatic.cpp
       src/opm/material/fluidsystems/blackoilpvt/DeadOilPvt.cpp
       src/opm/material/fluidsystems/blackoilpvt/DryGasPvt.cpp
       src/opm/material/fluidsystems/blackoilpvt/DryHumidGasPvt.cpp
@@ -273,6 +274,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+    src/opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQState.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQToken.cpp
@@ -371,7 +373,9 @@ if(ENABLE_ECL_OUTPUT)
           src/opm/io/eclipse/ExtESmry.cpp
           src/opm/io/eclipse/ESmry_write_rsm.cpp
           src/opm/io/eclipse/OutputStream.cpp
+          src/opm/io/eclipse/ExtSmryBlocks.cpp
           src/opm/io/eclipse/ExtSmryOutput.cpp
+          src/opm/io/eclipse/MappedFile.cpp
           src/opm/io/eclipse/RestartFileView.cpp
           src/opm/io/eclipse/SummaryNode.cpp
           src/opm/io/eclipse/rst/action.cpp
@@ -437,6 +441,7 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_OpmInputError_format.cpp
       tests/test_OpmLog.cpp
       tests/test_param.cpp
+      tests/test_PersistentMap.cpp
       tests/test_RootFinders.cpp
       tests/test_SegmentMatcher.cpp
       tests/test_sparsevector.cpp
@@ -478,6 +483,7 @@ if(ENABLE_ECL_INPUT)
     tests/test_PAvgCalculator.cpp
     tests/test_PAvgDynamicSourceData.cpp
     tests/test_Serialization.cpp
+    tests/test_SnapshotFile.cpp
     tests/material/test_co2brinepvt.cpp
     tests/material/test_h2brinepvt.cpp
     tests/material/test_eclblackoilfluidsystem.cpp
@@ -764,8 +770,10 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/Demangle.hpp
       opm/common/utility/FileSystem.hpp
       opm/common/utility/OpmInputError.hpp
+      opm/common/utility/PersistentMap.hpp
       opm/common/utility/Serializer.hpp
       opm/common/utility/MemPacker.hpp
+      opm/common/utility/SnapshotFile.hpp
       opm/common/utility/numeric/cmp.hpp
       opm/common/utility/platform_dependent/disable_warnings.h
       opm/common/utility/platform_dependent/reenable_warnings.h
@@ -857,6 +865,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidsystems/GasPhase.hpp
       opm/material/fluidsystems/TwoPhaseImmiscibleFluidSystem.hpp
       opm/material/fluidsystems/BlackOilFluidSystem.hpp
+      opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp
       opm/material/fluidsystems/LiquidPhase.hpp
       opm/material/fluidsystems/PTFlashParameterCache.hpp
       opm/material/fluidsystems/Spe5ParameterCache.hpp
@@ -1077,6 +1086,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Units/Dimension.hpp
        opm/input/eclipse/Parser/ErrorGuard.hpp
        opm/input/eclipse/Parser/ParserItem.hpp
+       opm/input/eclipse/Parser/BuiltinKeywordTable.hpp
        opm/input/eclipse/Parser/Parser.hpp
        opm/input/eclipse/Parser/ParserRecord.hpp
        opm/input/eclipse/Parser/ParserKeyword.hpp
@@ -1300,6 +1310,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/EclipseState/SimulationConfig/RockConfig.hpp
        opm/input/eclipse/EclipseState/SimulationConfig/SimulationConfig.hpp
        opm/input/eclipse/Schedule/MSW/Valve.hpp
+       opm/input/eclipse/EclipseState/IOConfig/ExtSmryLayout.hpp
        opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp
        opm/input/eclipse/EclipseState/checkDeck.hpp
        opm/input/eclipse/EclipseState/Phase.hpp
@@ -1315,6 +1326,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp
        opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
        opm/input/eclipse/Schedule/UDQ/UDQParams.hpp
+       opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp
        opm/input/eclipse/Schedule/UDQ/UDQSet.hpp
        opm/input/eclipse/Schedule/UDQ/UDQState.hpp
        opm/input/eclipse/Schedule/UDQ/UDQToken.hpp
@@ -1336,6 +1348,7 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/EclArrayView.hpp
         opm/io/eclipse/EclFile.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
@@ -1349,7 +1362,9 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/ExtESmry.hpp
         opm/io/eclipse/PaddedOutputString.hpp
         opm/io/eclipse/OutputStream.hpp
+        opm/io/eclipse/ExtSmryBlocks.hpp
         opm/io/eclipse/ExtSmryOutput.hpp
+        opm/io/eclipse/MappedFile.hpp
         opm/io/eclipse/RestartFileView.hpp
         opm/io/eclipse/SummaryNode.hpp
         opm/io/eclipse/rst/action.hpp
@@ -0,0 +1,388 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PERSISTENT_MAP_HPP
+#define OPM_PERSISTENT_MAP_HPP
+
+#include <bitset>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Hash map with cheap copies, implemented as a hash array mapped trie.
+ *
+ * Copies of a PersistentMap share all their nodes; assigning a value only
+ * copies the nodes on the path from the root to the value, i.e. a handful
+ * of small arrays, and leaves other copies unchanged.  This makes it
+ * suitable for long sequences of snapshots where each snapshot differs
+ * from the previous one in a few entries only.
+ *
+ * The map holds the values by copy.  Elements are visited in hash order.
+ */
+template <class Key, class Value,
+          class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class PersistentMap
+{
+public:
+    using value_type = std::pair<Key, Value>;
+
+private:
+    static constexpr std::size_t bitsPerLevel = 5;
+    static constexpr std::size_t hashBits = sizeof(std::size_t) * CHAR_BIT;
+
+    // Slots holding an entry are flagged in entryMap, and slots holding a
+    // sub-node in nodeMap.  Both are stored compactly in slot order.  Nodes
+    // below the last hash level hold colliding entries only, in insertion
+    // order.
+    struct Node
+    {
+        std::uint32_t entryMap{0};
+        std::uint32_t nodeMap{0};
+        std::vector<value_type> entries{};
+        std::vector<std::shared_ptr<const Node>> children{};
+    };
+
+    using NodePtr = std::shared_ptr<const Node>;
+
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename PersistentMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+
+        reference operator*() const
+        {
+            const auto& [node, pos] = this->stack_.back();
+            return node->entries[pos];
+        }
+
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        const_iterator& operator++()
+        {
+            ++this->stack_.back().second;
+            this->settle();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            if (this->stack_.empty() || other.stack_.empty()) {
+                return this->stack_.empty() == other.stack_.empty();
+            }
+
+            return this->stack_.back() == other.stack_.back();
+        }
+
+        bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class PersistentMap;
+
+        // Node and position within the node.  Positions below the number
+        // of entries refer to entries, the others to sub-nodes.
+        std::vector<std::pair<const Node*, std::size_t>> stack_{};
+
+        explicit const_iterator(const Node* root)
+        {
+            if (root != nullptr) {
+                this->stack_.emplace_back(root, 0);
+                this->settle();
+            }
+        }
+
+        // Advance to the next entry at or after the current position.
+        void settle()
+        {
+            while (! this->stack_.empty()) {
+                auto& [node, pos] = this->stack_.back();
+                const auto numEntries = node->entries.size();
+
+                if (pos < numEntries) {
+                    return;
+                }
+
+                if (pos < numEntries + node->children.size()) {
+                    const auto* child = node->children[pos - numEntries].get();
+                    ++pos;
+                    this->stack_.emplace_back(child, 0);
+                }
+                else {
+                    this->stack_.pop_back();
+                }
+            }
+        }
+    };
+
+    std::size_t size() const
+    {
+        return this->size_;
+    }
+
+    bool empty() const
+    {
+        return this->size_ == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator { this->root_.get() };
+    }
+
+    const_iterator end() const
+    {
+        return {};
+    }
+
+    /// Value associated with key, or nullptr if no such element.
+    const Value* find(const Key& key) const
+    {
+        const auto hash = Hash{}(key);
+
+        const Node* node = this->root_.get();
+        for (std::size_t shift = 0; node != nullptr; shift += bitsPerLevel) {
+            if (shift >= hashBits) {
+                for (const auto& entry : node->entries) {
+                    if (KeyEqual{}(entry.first, key)) {
+                        return &entry.second;
+                    }
+                }
+
+                return nullptr;
+            }
+
+            const auto bit = slotBit(hash, shift);
+            if (node->entryMap & bit) {
+                const auto& entry = node->entries[index(node->entryMap, bit)];
+                return KeyEqual{}(entry.first, key) ? &entry.second : nullptr;
+            }
+
+            if (! (node->nodeMap & bit)) {
+                return nullptr;
+            }
+
+            node = node->children[index(node->nodeMap, bit)].get();
+        }
+
+        return nullptr;
+    }
+
+    bool contains(const Key& key) const
+    {
+        return this->find(key) != nullptr;
+    }
+
+    /// Insert element, or replace the value of an existing element.  Other
+    /// copies of the map are not affected.
+    void insert_or_assign(const Key& key, Value value)
+    {
+        bool inserted = false;
+        this->root_ = assign(this->root_.get(), value_type { key, std::move(value) },
+                             Hash{}(key), 0, inserted);
+
+        if (inserted) {
+            ++this->size_;
+        }
+    }
+
+    /// Whether the maps share their storage, i.e. one is an unmodified
+    /// copy of the other.  Cheap sufficient condition for equality.
+    bool sharesStorage(const PersistentMap& other) const
+    {
+        return this->root_ == other.root_;
+    }
+
+    /// Call visitor for each trie node, with the node's address and
+    /// approximate heap memory use.  Nodes shared between copies of a map
+    /// have the same address.  The visitor returns whether to descend into
+    /// the node's children, e.g. false for nodes it has seen before.
+    /// Memory owned by keys or values is not included.
+    template <class Visitor>
+    void visitNodes(Visitor&& visitor) const
+    {
+        if (this->root_ != nullptr) {
+            visit(*this->root_, visitor);
+        }
+    }
+
+private:
+    NodePtr root_{};
+    std::size_t size_{0};
+
+    static std::uint32_t slotBit(const std::size_t hash, const std::size_t shift)
+    {
+        return std::uint32_t{1} << ((hash >> shift) & ((1u << bitsPerLevel) - 1));
+    }
+
+    // Position of the slot in a compact entry or child array.
+    static std::size_t index(const std::uint32_t bitmap, const std::uint32_t bit)
+    {
+        return std::bitset<32>(bitmap & (bit - 1)).count();
+    }
+
+    static NodePtr assign(const Node* node, value_type&& entry,
+                          const std::size_t hash, const std::size_t shift,
+                          bool& inserted)
+    {
+        if (node == nullptr) {
+            inserted = true;
+            auto leaf = std::make_shared<Node>();
+            if (shift < hashBits) {
+                leaf->entryMap = slotBit(hash, shift);
+            }
+            leaf->entries.push_back(std::move(entry));
+            return leaf;
+        }
+
+        auto copy = std::make_shared<Node>(*node);
+
+        if (shift >= hashBits) {
+            for (auto& existing : copy->entries) {
+                if (KeyEqual{}(existing.first, entry.first)) {
+                    existing.second = std::move(entry.second);
+                    return copy;
+                }
+            }
+
+            inserted = true;
+            copy->entries.push_back(std::move(entry));
+            return copy;
+        }
+
+        const auto bit = slotBit(hash, shift);
+        if (copy->entryMap & bit) {
+            const auto ix = index(copy->entryMap, bit);
+            auto& existing = copy->entries[ix];
+            if (KeyEqual{}(existing.first, entry.first)) {
+                existing.second = std::move(entry.second);
+                return copy;
+            }
+
+            // Slot occupied by another key; move both one level down.
+            inserted = true;
+            const auto existingHash = Hash{}(existing.first);
+            auto child = merge(std::move(existing), existingHash,
+                               std::move(entry), hash, shift + bitsPerLevel);
+
+            copy->entries.erase(copy->entries.begin() + ix);
+            copy->entryMap &= ~bit;
+            copy->nodeMap |= bit;
+            copy->children.insert(copy->children.begin() + index(copy->nodeMap, bit),
+                                  std::move(child));
+            return copy;
+        }
+
+        if (copy->nodeMap & bit) {
+            auto& child = copy->children[index(copy->nodeMap, bit)];
+            child = assign(child.get(), std::move(entry), hash, shift + bitsPerLevel, inserted);
+            return copy;
+        }
+
+        inserted = true;
+        copy->entryMap |= bit;
+        copy->entries.insert(copy->entries.begin() + index(copy->entryMap, bit),
+                             std::move(entry));
+        return copy;
+    }
+
+    static NodePtr merge(value_type&& entry1, const std::size_t hash1,
+                         value_type&& entry2, const std::size_t hash2,
+                         const std::size_t shift)
+    {
+        auto node = std::make_shared<Node>();
+
+        if (shift >= hashBits) {
+            node->entries.push_back(std::move(entry1));
+            node->entries.push_back(std::move(entry2));
+            return node;
+        }
+
+        const auto bit1 = slotBit(hash1, shift);
+        const auto bit2 = slotBit(hash2, shift);
+        if (bit1 == bit2) {
+            node->nodeMap = bit1;
+            node->children.push_back(merge(std::move(entry1), hash1,
+                                           std::move(entry2), hash2,
+                                           shift + bitsPerLevel));
+            return node;
+        }
+
+        node->entryMap = bit1 | bit2;
+        if (bit1 < bit2) {
+            node->entries.push_back(std::move(entry1));
+            node->entries.push_back(std::move(entry2));
+        }
+        else {
+            node->entries.push_back(std::move(entry2));
+            node->entries.push_back(std::move(entry1));
+        }
+
+        return node;
+    }
+
+    template <class Visitor>
+    static void visit(const Node& node, Visitor& visitor)
+    {
+        const bool descend =
+            visitor(static_cast<const void*>(&node),
+                    sizeof(Node)
+                    + node.entries.capacity() * sizeof(value_type)
+                    + node.children.capacity() * sizeof(NodePtr));
+
+        if (! descend) {
+            return;
+        }
+
+        for (const auto& child : node.children) {
+            visit(*child, visitor);
+        }
+    }
+};
+
+} // namespace Opm
+
+#endif // OPM_PERSISTENT_MAP_HPP
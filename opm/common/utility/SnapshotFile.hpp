@@ -0,0 +1,159 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_SNAPSHOT_FILE_HPP
+#define OPM_SNAPSHOT_FILE_HPP
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+namespace detail {
+
+//! \brief Serializer to and from a buffer owned by a SnapshotFile.
+class SnapshotSerializer : public Serializer<Serialization::MemPacker>
+{
+public:
+    SnapshotSerializer()
+        : Serializer<Serialization::MemPacker>(packer())
+    {}
+
+    //! \brief Serialize objects.  Throws std::length_error if the
+    //! serialized objects exceed the buffer size supported by MemPacker.
+    template<class... Args>
+    void packChecked(const Args&... data)
+    {
+        m_op = Operation::PACKSIZE;
+        m_packSize = 0;
+        variadic_call(data...);
+
+        if (m_packSize > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+            throw std::length_error("Objects too large for snapshot file");
+        }
+
+        m_position = 0;
+        m_buffer.resize(m_packSize);
+        m_op = Operation::PACK;
+        variadic_call(data...);
+    }
+
+    std::vector<char>& buffer()
+    {
+        return m_buffer;
+    }
+
+private:
+    static const Serialization::MemPacker& packer()
+    {
+        static const Serialization::MemPacker memPacker{};
+        return memPacker;
+    }
+};
+
+} // namespace detail
+
+/*!
+ * \brief On-disk snapshot of serializable objects, e.g., Deck, EclipseState
+ *        and Schedule, keyed on the contents of the input files they were
+ *        created from.
+ *
+ * A snapshot records the names, sizes and content hashes of a set of input
+ * files together with the serialized objects.  Loading a snapshot succeeds
+ * only if all recorded input files are unchanged, so the objects may be
+ * restored in a single read instead of re-parsing and re-internalising the
+ * input.  For decks, DeckTree::files() provides the list of input files.
+ *
+ * Settings which influence the objects without being part of the input
+ * files, e.g., the ParseContext, or the program version, should be encoded
+ * in the key.  Snapshots are native-endian and only intended for reuse by
+ * the same build on the same kind of machine.
+ */
+class SnapshotFile
+{
+public:
+    explicit SnapshotFile(const std::string& fileName);
+
+    //! \brief Write snapshot, replacing any existing snapshot file.
+    //! \param inputFiles Files on which the objects depend.
+    //! \param key Identifies settings which influence the objects.
+    //! \param objects Objects to serialize.
+    template<class... Objects>
+    void save(const std::vector<std::string>& inputFiles,
+              const std::string& key,
+              const Objects&... objects) const
+    {
+        detail::SnapshotSerializer ser;
+        ser.packChecked(objects...);
+        this->write(inputFiles, key, ser.buffer());
+    }
+
+    //! \brief Restore objects from snapshot.
+    //!
+    //! \return Whether the objects were restored.  False if the snapshot
+    //! file does not exist, was made with a different key, if any of its
+    //! input files have changed, or if the snapshot data is inconsistent.
+    //! The objects are in an unspecified state if the snapshot data is
+    //! inconsistent and are otherwise not modified when returning false.
+    template<class... Objects>
+    bool load(const std::string& key, Objects&... objects) const
+    {
+        detail::SnapshotSerializer ser;
+        if (! this->read(key, ser.buffer())) {
+            return false;
+        }
+
+        try {
+            ser.unpack(objects...);
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+
+        return ser.position() == ser.buffer().size();
+    }
+
+    //! \brief Whether a snapshot exists for the key and all its input
+    //! files are unchanged.
+    bool isValid(const std::string& key) const;
+
+    const std::string& fileName() const
+    {
+        return this->fileName_;
+    }
+
+private:
+    std::string fileName_;
+
+    void write(const std::vector<std::string>& inputFiles,
+               const std::string& key,
+               const std::vector<char>& payload) const;
+
+    bool read(const std::string& key, std::vector<char>& payload) const;
+};
+
+} // namespace Opm
+
+#endif // OPM_SNAPSHOT_FILE_HPP
@@ -20,18 +20,81 @@
 #ifndef OPM_UTILITY_SHMATCH_HPP
 #define OPM_UTILITY_SHMATCH_HPP
 
+#include <bitset>
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace Opm {
 
 /*
   The shmatch() function is an implementation of the shell matching algorithm
-  used in posix function fnmatch(). It is implemented here based on std::regex
-  to avoid using a posix function.
+  used in posix function fnmatch(). It is implemented here without using a
+  posix function.
+
+  Patterns consisting of literal characters, the wildcards '*' and '?', and
+  character classes like [0-9] or [^AB] are matched directly.  For backwards
+  compatibility, patterns with other regular expression syntax, e.g., '.', are
+  matched with std::regex.
 */
 
 bool shmatch(const std::string& pattern, const std::string& symbol);
 
+/*
+  Precompiled shell pattern, for matching the same pattern against many
+  symbols.  ShellPattern(pattern).match(symbol) == shmatch(pattern, symbol).
+*/
+
+class ShellPattern
+{
+public:
+    explicit ShellPattern(const std::string& pattern);
+
+    bool match(std::string_view symbol) const;
+
+    // Whether the pattern matches anything but the pattern string itself.
+    bool hasWildcard() const
+    {
+        return this->has_wildcard_;
+    }
+
+    // Leading literal characters which every matching symbol starts with.
+    const std::string& prefix() const
+    {
+        return this->prefix_;
+    }
+
+    const std::string& pattern() const
+    {
+        return this->pattern_;
+    }
+
+private:
+    struct Regex;
+
+    enum class Kind : unsigned char { Char, AnyChar, AnyString, Class };
+
+    struct Token
+    {
+        Kind kind;
+        char ch;
+        std::size_t class_index;
+    };
+
+    std::string pattern_;
+    std::string prefix_;
+    bool has_wildcard_ = false;
+    std::vector<Token> tokens_;
+    std::vector<std::bitset<256>> classes_;
+
+    // Set if the pattern uses syntax beyond the directly matched subset.
+    std::shared_ptr<const Regex> regex_;
+
+    bool compile();
+    bool matchToken(const Token& token, char c) const;
+};
 
 }
 #endif //OPM_UTILITY_STRING_HPP
@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <vector>
 
 
 namespace Opm {
@@ -47,6 +48,9 @@ public:
     bool has_include(const std::string& fname) const;
     const std::string& root() const;
 
+    // Canonical names of root file and all include files, root file first.
+    std::vector<std::string> files() const;
+
 private:
     class TreeNode {
     public:
@@ -162,6 +162,34 @@ namespace Opm {
         std::array<double, 3> getCellCenter(size_t globalIndex) const;
         std::array<double, 3> getCornerPos(size_t i,size_t j, size_t k, size_t corner_index) const;
         const std::vector<double>& activeVolume() const;
+
+        /// Geometry of all active cells, stored as one array per quantity
+        /// indexed by active cell.
+        struct ActiveGeometry {
+            std::vector<double> volume;
+            std::vector<double> depth;
+            std::vector<double> thickness;
+            std::array<std::vector<double>, 3> center;
+            std::array<std::vector<double>, 3> dims;
+        };
+
+        /// Compute the geometry of all active cells in one parallel pass
+        /// and keep it until the set of active cells changes.  While the
+        /// geometry is cached, getCellVolume(), getCellCenter(),
+        /// getCellDepth(), getCellThickness() and getCellDims() look up
+        /// active cells in the cache instead of recomputing the corner
+        /// point geometry.  Opt-in since the cache holds eleven doubles
+        /// per active cell.
+        const ActiveGeometry& precomputeGeometry() const;
+
+        /// Drop the cached active cell geometry, keeping only the cell
+        /// volumes for activeVolume().
+        void releaseGeometry() const;
+
+        /// Cached active cell geometry, or nullptr if precomputeGeometry()
+        /// has not been called since the active cells last changed.
+        const ActiveGeometry* activeGeometry() const;
+
         double getCellVolume(size_t globalIndex) const;
         double getCellVolume(size_t i , size_t j , size_t k) const;
         double getCellThickness(size_t globalIndex) const;
@@ -233,6 +261,7 @@ namespace Opm {
         double    m_pinchMaxEmptyGap;
 
         mutable std::optional<std::vector<double>> active_volume;
+        mutable std::optional<ActiveGeometry> active_geometry;
 
         bool m_circle = false;
 
@@ -265,6 +294,11 @@ namespace Opm {
 
         void updateNumericalAquiferCells(const Deck&);
         double computeCellGeometricDepth(size_t globalIndex) const;
+        double computeCellVolume(size_t globalIndex,
+                                 const std::array<double,8>& X,
+                                 const std::array<double,8>& Y,
+                                 const std::array<double,8>& Z) const;
+        const ActiveGeometry* cachedGeometry(size_t globalIndex) const;
 
         void initGridFromEGridFile(Opm::EclIO::EclFile& egridfile, std::string fileName);
         void resetACTNUM( const int* actnum);
@@ -51,50 +51,129 @@ namespace Fieldprops
         data.resize(data.size() - shift);
     }
 
+    /// Read-only view of the values of a field, either backed by a
+    /// vector or by a single value repeated for all cells.
+    template<typename T>
+    class FieldView {
+    public:
+        FieldView() = default;
+
+        FieldView(const std::vector<T>& data) :
+            data_ptr(&data),
+            m_size(data.size())
+        {}
+
+        FieldView(const T& constant, std::size_t size) :
+            m_constant(constant),
+            m_size(size)
+        {}
+
+        std::size_t size() const {
+            return this->m_size;
+        }
+
+        T operator[](std::size_t index) const {
+            return this->data_ptr ? (*this->data_ptr)[index] : this->m_constant;
+        }
+
+        bool is_constant() const {
+            return this->data_ptr == nullptr;
+        }
+
+        std::vector<T> to_vector() const {
+            return this->data_ptr ? *this->data_ptr : std::vector<T>(this->m_size, this->m_constant);
+        }
+
+    private:
+        const std::vector<T>* data_ptr = nullptr;
+        T m_constant{};
+        std::size_t m_size = 0;
+    };
+
+
+    /// Number of bytes allocated for one field.
+    struct MemoryUsage {
+        std::string keyword;
+        std::size_t bytes;
+        bool constant;
+    };
+
+
+    /*
+      A field where all cells have the same value and status is stored
+      symbolically in the 'constant' member, and the data, value_status and
+      global arrays are only allocated by materialize(), i.e., when the field
+      is modified cell by cell or accessed as a vector. All member functions
+      are aware of the symbolic representation, but code accessing the
+      vectors directly must call materialize() first.
+    */
     template<typename T>
     struct FieldData {
+        struct Constant {
+            T value;
+            value::status status;
+            std::size_t active_size;
+            std::size_t global_size;
+
+            bool operator==(const Constant& other) const {
+                return this->value == other.value &&
+                       this->status == other.status &&
+                       this->active_size == other.active_size &&
+                       this->global_size == other.global_size;
+            }
+        };
+
         std::vector<T> data;
         std::vector<value::status> value_status;
         keywords::keyword_info<T> kw_info;
         std::optional<std::vector<T>> global_data;
         std::optional<std::vector<value::status>> global_value_status;
+        std::optional<Constant> constant;
         mutable bool all_set;
 
         bool operator==(const FieldData& other) const {
-            return this->data == other.data &&
-                   this->value_status == other.value_status &&
-                   this->kw_info == other.kw_info &&
-                   this->global_data == other.global_data &&
-                   this->global_value_status == other.global_value_status;
+            if (!(this->kw_info == other.kw_info))
+                return false;
+
+            if (this->constant && other.constant)
+                return *this->constant == *other.constant;
+
+            if (!this->constant && !other.constant)
+                return this->data == other.data &&
+                       this->value_status == other.value_status &&
+                       this->global_data == other.global_data &&
+                       this->global_value_status == other.global_value_status;
+
+            return equal_views(this->view(), other.view()) &&
+                   equal_views(this->status_view(), other.status_view()) &&
+                   equal_views(this->global_view(), other.global_view()) &&
+                   equal_views(this->global_status_view(), other.global_status_view());
         }
 
 
         FieldData() = default;
 
         FieldData(const keywords::keyword_info<T>& info, std::size_t active_size, std::size_t global_size) :
-            data(std::vector<T>(active_size)),
-            value_status(active_size, value::status::uninitialized),
             kw_info(info),
+            constant(Constant{T{}, value::status::uninitialized, active_size, global_size}),
             all_set(false)
         {
-            if (global_size != 0) {
-                this->global_data = std::vector<T>(global_size);
-                this->global_value_status = std::vector<value::status>(global_size, value::status::uninitialized);
-            }
-
             if (info.scalar_init)
                 this->default_assign( *info.scalar_init );
         }
 
 
         std::size_t size() const {
-            return this->data.size();
+            return this->constant ? this->constant->active_size : this->data.size();
         }
 
         bool valid() const {
             if (this->all_set)
                 return true;
 
+            if (this->constant)
+                return value::has_value(this->constant->status);
+
             static const std::array<value::status,2> invalid_value = {value::status::uninitialized, value::status::empty_default};
             const auto& it = std::find_first_of(this->value_status.begin(), this->value_status.end(), invalid_value.begin(), invalid_value.end());
             this->all_set = (it == this->value_status.end());
@@ -103,23 +182,104 @@ namespace Fieldprops
         }
 
         bool valid_default() const {
+            if (this->constant)
+                return this->constant->status == value::status::valid_default;
+
             return std::all_of( this->value_status.begin(), this->value_status.end(), [] (const value::status& status) {return status == value::status::valid_default; });
         }
 
+        FieldView<T> view() const {
+            if (this->constant)
+                return { this->constant->value, this->constant->active_size };
+
+            return { this->data };
+        }
+
+        FieldView<value::status> status_view() const {
+            if (this->constant)
+                return { this->constant->status, this->constant->active_size };
+
+            return { this->value_status };
+        }
+
+        FieldView<T> global_view() const {
+            if (this->constant)
+                return { this->constant->value, this->constant->global_size };
+
+            if (this->global_data)
+                return { *this->global_data };
+
+            return {};
+        }
+
+        FieldView<value::status> global_status_view() const {
+            if (this->constant)
+                return { this->constant->status, this->constant->global_size };
+
+            if (this->global_value_status)
+                return { *this->global_value_status };
+
+            return {};
+        }
+
+        /// Expand a symbolic constant field to full vectors.
+        void materialize() {
+            if (!this->constant)
+                return;
+
+            const auto constant_value = *this->constant;
+            this->constant.reset();
+
+            this->data.assign(constant_value.active_size, constant_value.value);
+            this->value_status.assign(constant_value.active_size, constant_value.status);
+
+            if (constant_value.global_size != 0) {
+                this->global_data = std::vector<T>(constant_value.global_size, constant_value.value);
+                this->global_value_status = std::vector<value::status>(constant_value.global_size, constant_value.status);
+            }
+        }
+
+        /// Number of bytes allocated for the cell values and status flags.
+        std::size_t memory_usage() const {
+            std::size_t bytes = this->data.capacity() * sizeof(T) + this->value_status.capacity() * sizeof(value::status);
+            if (this->global_data)
+                bytes += this->global_data->capacity() * sizeof(T);
+
+            if (this->global_value_status)
+                bytes += this->global_value_status->capacity() * sizeof(value::status);
+
+            return bytes;
+        }
+
 
         void compress(const std::vector<bool>& active_map) {
+            if (this->constant) {
+                this->constant->active_size = std::count(active_map.begin(), active_map.end(), true);
+                return;
+            }
+
             Fieldprops::compress(this->data, active_map);
             Fieldprops::compress(this->value_status, active_map);
         }
 
         void copy(const FieldData<T>& src, const std::vector<Box::cell_index>& index_list) {
+            this->materialize();
+
+            const auto src_data = src.view();
+            const auto src_status = src.status_view();
             for (const auto& ci : index_list) {
-                this->data[ci.active_index] = src.data[ci.active_index];
-                this->value_status[ci.active_index] = src.value_status[ci.active_index];
+                this->data[ci.active_index] = src_data[ci.active_index];
+                this->value_status[ci.active_index] = src_status[ci.active_index];
             }
         }
 
         void default_assign(T value) {
+            if (this->constant) {
+                this->constant->value = value;
+                this->constant->status = value::status::valid_default;
+                return;
+            }
+
             std::fill(this->data.begin(), this->data.end(), value);
             std::fill(this->value_status.begin(), this->value_status.end(), value::status::valid_default);
 
@@ -133,6 +293,7 @@ namespace Fieldprops
             if (src.size() != this->size())
                 throw std::invalid_argument("Size mismatch got: " + std::to_string(src.size()) + " expected: " + std::to_string(this->size()));
 
+            this->materialize();
             std::copy(src.begin(), src.end(), this->data.begin());
             std::fill(this->value_status.begin(), this->value_status.end(), value::status::valid_default);
         }
@@ -141,6 +302,10 @@ namespace Fieldprops
             if (src.size() != this->size())
                 throw std::invalid_argument("Size mismatch got: " + std::to_string(src.size()) + " expected: " + std::to_string(this->size()));
 
+            if (this->constant && value::has_value(this->constant->status))
+                return;
+
+            this->materialize();
             for (std::size_t i = 0; i < src.size(); i++) {
                 if (!value::has_value(this->value_status[i])) {
                     this->value_status[i] = value::status::valid_default;
@@ -150,10 +315,24 @@ namespace Fieldprops
         }
 
         void update(std::size_t index, T value, value::status status) {
+            this->materialize();
             this->data[index] = value;
             this->value_status[index] = status;
         }
 
+    private:
+        template<typename U>
+        static bool equal_views(const FieldView<U>& view1, const FieldView<U>& view2) {
+            if (view1.size() != view2.size())
+                return false;
+
+            for (std::size_t i = 0; i < view1.size(); i++) {
+                if (!(view1[i] == view2[i]))
+                    return false;
+            }
+
+            return true;
+        }
     };
 } // end namespace Fieldprops
 } // end namespace Opm
@@ -408,9 +408,13 @@ public:
     template <typename T>
     std::vector<std::string> keys() const;
 
+    /// If materialize is false the returned field data may be stored as a
+    /// symbolic constant, and must only be accessed through its views.
     template <typename T>
     FieldDataManager<T>
-    try_get(const std::string& keyword, const bool allow_unsupported = false)
+    try_get(const std::string& keyword,
+            const bool allow_unsupported = false,
+            const bool materialize = true)
     {
         if (!allow_unsupported && !FieldProps::template supported<T>(keyword)) {
             return { keyword, GetStatus::NOT_SUPPPORTED_KEYWORD, nullptr };
@@ -418,8 +422,11 @@ public:
 
         const auto has0 = this->template has<T>(keyword);
 
-        const auto& field_data =
-            this->template init_get<T>(keyword, std::is_same<T,double>::value && allow_unsupported);
+        auto& field_data =
+            this->template lazy_get<T>(keyword, std::is_same<T,double>::value && allow_unsupported);
+
+        if (materialize)
+            field_data.materialize();
 
         if (field_data.valid() || allow_unsupported) {
             // Note: FieldDataManager depends on init_get<>() producing a
@@ -442,18 +449,24 @@ public:
         return this->template try_get<T>(keyword).data();
     }
 
+    template <typename T>
+    Fieldprops::FieldView<T> get_view(const std::string& keyword)
+    {
+        return this->template try_get<T>(keyword, false, false).field_data().view();
+    }
+
     template <typename T>
     std::vector<T> get_global(const std::string& keyword)
     {
-        const auto managed_field_data = this->template try_get<T>(keyword);
+        const auto managed_field_data = this->template try_get<T>(keyword, false, false);
         const auto& field_data = managed_field_data.field_data();
 
         const auto& kw_info = Fieldprops::keywords::
             template global_kw_info<T>(keyword);
 
         return kw_info.global
-            ? *field_data.global_data
-            : this->global_copy(field_data.data, kw_info.scalar_init);
+            ? field_data.global_view().to_vector()
+            : this->global_copy(field_data.view(), kw_info.scalar_init);
     }
 
     template <typename T>
@@ -469,10 +482,10 @@ public:
         // for control flow, and we cannot move this try_get() call into the
         // 'has0' branch even though the actual 'field_data' object returned
         // from try_get() is only needed/used there.
-        const auto& field_data = this->template try_get<T>(keyword).field_data();
+        const auto& field_data = this->template try_get<T>(keyword, false, false).field_data();
 
         if (has0) {
-            return this->get_copy(field_data.data, field_data.kw_info.scalar_init, global);
+            return this->get_copy(field_data.view(), field_data.kw_info.scalar_init, global);
         }
 
         const auto initial_value = Fieldprops::keywords::
@@ -484,11 +497,11 @@ public:
     template <typename T>
     std::vector<bool> defaulted(const std::string& keyword)
     {
-        const auto& field = this->template init_get<T>(keyword);
-        std::vector<bool> def(field.size());
+        const auto status = this->template lazy_get<T>(keyword).status_view();
+        std::vector<bool> def(status.size());
 
         for (std::size_t i = 0; i < def.size(); ++i) {
-            def[i] = value::defaulted(field.value_status[i]);
+            def[i] = value::defaulted(status[i]);
         }
 
         return def;
@@ -497,6 +510,13 @@ public:
     template <typename T>
     std::vector<T> global_copy(const std::vector<T>&   data,
                                const std::optional<T>& default_value) const
+    {
+        return this->global_copy(Fieldprops::FieldView<T>(data), default_value);
+    }
+
+    template <typename T>
+    std::vector<T> global_copy(const Fieldprops::FieldView<T>& data,
+                               const std::optional<T>& default_value) const
     {
         const T fill_value = default_value.has_value() ? *default_value : 0;
 
@@ -526,6 +546,9 @@ public:
         return this->double_data.size();
     }
 
+    /// Memory allocated for each field, largest first.
+    std::vector<Fieldprops::MemoryUsage> memory_usage() const;
+
     void handle_schedule_keywords(const std::vector<DeckKeyword>& keywords);
     bool tran_active(const std::string& keyword) const;
     void apply_tran(const std::string& keyword, std::vector<double>& data);
@@ -553,11 +576,11 @@ private:
     std::vector<T> extract(const std::string& keyword);
 
     template <typename T>
-    std::vector<T> get_copy(const std::vector<T>&   x,
-                            const std::optional<T>& initial_value,
-                            const bool              global) const
+    std::vector<T> get_copy(const Fieldprops::FieldView<T>& x,
+                            const std::optional<T>&         initial_value,
+                            const bool                      global) const
     {
-        return (! global) ? x : this->global_copy(x, initial_value);
+        return (! global) ? x.to_vector() : this->global_copy(x, initial_value);
     }
 
     template <typename T>
@@ -574,11 +597,30 @@ private:
     template <typename T>
     static void apply(ScalarOperation op, std::vector<T>& data, std::vector<value::status>& value_status, T scalar_value, const std::vector<Box::cell_index>& index_list);
 
+    // Get field data, creating it if necessary, as full vectors.
+    template <typename T>
+    Fieldprops::FieldData<T>& init_get(const std::string& keyword, bool allow_unsupported = false)
+    {
+        auto& field_data = this->template lazy_get<T>(keyword, allow_unsupported);
+        field_data.materialize();
+        return field_data;
+    }
+
+    template <typename T>
+    Fieldprops::FieldData<T>& init_get(const std::string& keyword, const Fieldprops::keywords::keyword_info<T>& kw_info)
+    {
+        auto& field_data = this->template lazy_get<T>(keyword, kw_info);
+        field_data.materialize();
+        return field_data;
+    }
+
+    // Get field data, creating it if necessary, possibly as a symbolic
+    // constant.
     template <typename T>
-    Fieldprops::FieldData<T>& init_get(const std::string& keyword, bool allow_unsupported = false);
+    Fieldprops::FieldData<T>& lazy_get(const std::string& keyword, bool allow_unsupported = false);
 
     template <typename T>
-    Fieldprops::FieldData<T>& init_get(const std::string& keyword, const Fieldprops::keywords::keyword_info<T>& kw_info);
+    Fieldprops::FieldData<T>& lazy_get(const std::string& keyword, const Fieldprops::keywords::keyword_info<T>& kw_info);
 
     std::string region_name(const DeckItem& region_item);
     std::vector<Box::cell_index> region_index( const std::string& region_name, int region_value );
@@ -32,6 +32,8 @@ class DeckKeyword;
 namespace Fieldprops {
 class TranCalculator;
 template<typename T> struct FieldData;
+template<typename T> class FieldView;
+struct MemoryUsage;
 }
 class FieldProps;
 class Phases;
@@ -185,6 +187,22 @@ public:
     virtual const std::vector<double>& get_double(const std::string& keyword) const { return this->get<double>(keyword); }
     virtual std::vector<double> get_global_double(const std::string& keyword) const { return this->get_global<double>(keyword); }
 
+    /*
+      Like get_int() and get_double(), but keywords which have the same value
+      in all cells, e.g. defaulted keywords or keywords assigned with EQUALS
+      for the whole grid, are not expanded to full vectors. The views refer
+      to data held by the container. Include FieldData.hpp to use them.
+    */
+    Fieldprops::FieldView<int> get_int_view(const std::string& keyword) const;
+    Fieldprops::FieldView<double> get_double_view(const std::string& keyword) const;
+
+    /*
+      Number of bytes allocated for each keyword in the container, largest
+      first. Keywords stored as a single value for all cells report zero
+      bytes until they are expanded, e.g. by get_int() or get_double().
+    */
+    std::vector<Fieldprops::MemoryUsage> memory_usage() const;
+
     virtual bool has_int(const std::string& keyword) const { return this->has<int>(keyword); }
     virtual bool has_double(const std::string& keyword) const { return this->has<double>(keyword); }
 
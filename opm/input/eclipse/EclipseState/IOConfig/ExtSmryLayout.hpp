@@ -0,0 +1,42 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_EXT_SMRY_LAYOUT_HPP
+#define OPM_EXT_SMRY_LAYOUT_HPP
+
+namespace Opm {
+
+/// On-disk layout of ESMRY files.
+enum class ExtSmryLayout {
+    /// One array per summary vector, holding all time steps.  The whole
+    /// file must be rewritten whenever new time steps are added.
+    Transposed,
+
+    /// Append-only sequence of time blocks, each with a per-vector index
+    /// into the block's data.  Vector data stored as raw floats.
+    Chunked,
+
+    /// As Chunked, but each vector's data in a block is XOR-delta encoded
+    /// against the previous time step, byte shuffled, and compressed by
+    /// run-length encoding of zero bytes.
+    ChunkedCompressed,
+};
+
+} // namespace Opm
+
+#endif // OPM_EXT_SMRY_LAYOUT_HPP
@@ -20,6 +20,8 @@
 #ifndef OPM_IO_CONFIG_HPP
 #define OPM_IO_CONFIG_HPP
 
+#include <opm/input/eclipse/EclipseState/IOConfig/ExtSmryLayout.hpp>
+
 #include <string>
 
 namespace Opm {
@@ -172,6 +174,10 @@ namespace Opm {
         bool getOutputEnabled() const;
         void setOutputEnabled(bool enabled);
 
+        /// Layout of the ESMRY file written alongside the summary output.
+        ExtSmryLayout getEsmryLayout() const;
+        void setEsmryLayout(ExtSmryLayout layout);
+
         std::string getOutputDir() const;
         void setOutputDir(const std::string& outputDir);
 
@@ -205,6 +211,7 @@ namespace Opm {
             serializer(m_nosim);
             serializer(m_base_name);
             serializer(ecl_compatible_rst);
+            serializer(m_esmry_layout);
         }
 
     private:
@@ -220,6 +227,7 @@ namespace Opm {
         bool            m_nosim;
         std::string     m_base_name;
         bool            ecl_compatible_rst = true;
+        ExtSmryLayout m_esmry_layout = ExtSmryLayout::Transposed;
 
         IOConfig( const GRIDSection&,
                   const RUNSPECSection&,
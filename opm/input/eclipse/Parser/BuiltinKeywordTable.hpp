@@ -0,0 +1,123 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_BUILTIN_KEYWORD_TABLE_HPP
+#define OPM_BUILTIN_KEYWORD_TABLE_HPP
+
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Opm {
+
+/// Table of the builtin keywords, generated by genkw from the keyword
+/// definitions.
+///
+/// The table holds constant descriptors only; the full ParserKeyword
+/// objects are created on demand through the descriptors' factory
+/// functions.  Deck names are looked up through a perfect hash which is
+/// computed by the generator: a first hash of the deck name selects a
+/// bucket, and the bucket's seed for a second hash selects the single slot
+/// which may hold the deck name.
+struct BuiltinKeywordTable
+{
+    struct Keyword
+    {
+        /// Position of keyword in the table's list of keywords.
+        std::uint32_t index;
+
+        /// Internal keyword name.
+        std::string_view name;
+
+        /// End marker of code keywords, empty for other keywords.
+        std::string_view code_end;
+
+        /// Whether deck names are matched by a regular expression.
+        bool wildcard;
+
+        /// Create full keyword definition.
+        ParserKeyword (*create)();
+    };
+
+    struct Slot
+    {
+        std::string_view deck_name;
+        const Keyword* keyword;
+    };
+
+    const Keyword* const* keywords;
+    std::size_t num_keywords;
+
+    const std::uint32_t* seeds;
+    std::size_t num_seeds;
+
+    const Slot* slots;
+    std::size_t num_slots;
+
+    /// Number of deck names in the table.
+    std::size_t num_deck_names;
+
+    /// Seeded 64-bit FNV-1a hash, shared by the generator and the lookup.
+    static constexpr std::uint64_t hash(std::string_view name, std::uint32_t seed)
+    {
+        std::uint64_t h = 0xcbf29ce484222325ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+        for (const char c : name) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ULL;
+        }
+
+        return h ^ (h >> 32);
+    }
+
+    /// Keyword with a given deck name, or nullptr if there is no such
+    /// builtin keyword.
+    const Keyword* find(std::string_view deck_name) const
+    {
+        if (this->num_slots == 0) {
+            return nullptr;
+        }
+
+        const auto seed = this->seeds[hash(deck_name, 0) % this->num_seeds];
+        const auto& slot = this->slots[hash(deck_name, seed) % this->num_slots];
+
+        return (slot.keyword != nullptr) && (slot.deck_name == deck_name)
+            ? slot.keyword : nullptr;
+    }
+};
+
+/// Factory function for keyword descriptors.
+template <class KeywordType>
+ParserKeyword createBuiltinKeyword()
+{
+    return KeywordType{};
+}
+
+namespace ParserKeywords {
+
+/// Table of all builtin keywords.  Implemented in a source file generated
+/// by the build system.
+const BuiltinKeywordTable& builtinKeywordTable();
+
+} // namespace ParserKeywords
+
+} // namespace Opm
+
+#endif // OPM_BUILTIN_KEYWORD_TABLE_HPP
@@ -26,6 +26,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -169,8 +170,12 @@ namespace Opm {
         const std::vector<std::pair<std::string,std::string>> codeKeywords() const;
 
     private:
+        struct BuiltinKeywords;
+
         bool hasWildCardKeyword(const std::string& keyword) const;
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
+        bool hasDeckName(std::string_view deckKeywordName) const;
+        const ParserKeyword* findKeyword(std::string_view deckKeywordName) const;
         void addDefaultKeywords();
 
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
@@ -184,6 +189,10 @@ namespace Opm {
         std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
 
         std::vector<std::pair<std::string,std::string>> code_keywords;
+
+        // Builtin keywords, looked up in the generated keyword table and
+        // created on first use.  Keywords added explicitly take precedence.
+        std::shared_ptr<BuiltinKeywords> builtin_keywords;
     };
 
 } // namespace Opm
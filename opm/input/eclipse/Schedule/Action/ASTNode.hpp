@@ -1,9 +1,11 @@
 #ifndef ASTNODE_HPP
 #define ASTNODE_HPP
 
+#include <memory>
 #include <unordered_set>
 
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 
 #include "ActionValue.hpp"
 
@@ -50,6 +52,22 @@ private:
     std::vector<std::string> arg_list;
     double number = 0.0;
 
+    /*
+      Evaluation state of this node, created on first evaluation. Comparison
+      nodes keep the summary keys they read and the values found in the
+      previous evaluation, and reuse the previous result when the values are
+      unchanged. AND/OR nodes reuse their previous result when none of their
+      children changed. The result is a pure function of the values read, so
+      sharing the state between copies of a node is harmless. It is not part
+      of the node's value, and is neither compared nor serialized.
+    */
+    struct EvalCache;
+    mutable std::shared_ptr<EvalCache> cache;
+
+    const Action::Result& eval(const Action::Context& context, bool& changed) const;
+    void compile(EvalCache& eval_cache) const;
+    void read_inputs(const Action::Context& context, EvalCache& eval_cache) const;
+
     /*
       To have a member std::vector<ASTNode> inside the ASTNode class is
       supposedly borderline undefined behaviour; it compiles without warnings
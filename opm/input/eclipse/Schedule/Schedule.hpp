@@ -19,12 +19,14 @@
 #ifndef SCHEDULE_HPP
 #define SCHEDULE_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <ctime>
 #include <functional>
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <set>
 #include <string>
@@ -318,6 +320,29 @@ namespace Opm
 
         bool operator==(const Schedule& data) const;
         std::shared_ptr<const Python> python() const;
+        /*
+          Memory used by one member of the ScheduleState snapshots, summed
+          over all report steps.  Objects shared between report steps are
+          only counted once, so comparing references and instances shows how
+          well a member is shared.  The bytes are an estimate based on the
+          serialized size of the distinct instances plus the storage of the
+          well, group and VFP maps.  Well connections and segments are
+          reported separately, but are also included in the wells.
+        */
+        struct MemberMemoryUsage {
+            std::string member;
+            std::size_t references{0};
+            std::size_t instances{0};
+            std::size_t bytes{0};
+        };
+
+        /*
+          The memoryUsage() function reports the memory used by each member
+          of the ScheduleState snapshots, e.g. to find the keywords which
+          cause large schedules.  This is an expensive diagnostic function.
+        */
+        std::vector<MemberMemoryUsage> memoryUsage() const;
+
 
 
         const ScheduleState& back() const;
@@ -454,20 +479,32 @@ namespace Opm
 
             const auto& last_map = this->snapshots.back().get_map<K,T>();
             std::vector<K> key_list{ last_map.keys() };
-            std::unordered_map<K,T> current_value;
+            std::unordered_map<K, std::shared_ptr<T>> current_value;
 
             for (std::size_t index = 0; index < this->snapshots.size(); index++) {
                 auto& state = this->snapshots[index];
                 const auto& current_map = state.template get_map<K,T>();
+
+                // Unchanged from the previous report step.
+                if ((index > 0) &&
+                    current_map.storage().sharesStorage(this->snapshots[index - 1].template get_map<K,T>().storage()))
+                    continue;
+
                 for (const auto& key : key_list) {
-                    auto& value = current_map.get_ptr(key);
+                    auto value = current_map.get_ptr(key);
                     if (value) {
                         auto it = current_value.find(key);
-                        if (it == current_value.end() || !(*value == it->second)) {
+                        if (it == current_value.end()) {
                             value_list.push_back( *value );
                             index_list.push_back( index );
-
-                            current_value[key] = *value;
+                            current_value.emplace(key, std::move(value));
+                        }
+                        else if (value != it->second) {
+                            if (!(*value == *it->second)) {
+                                value_list.push_back( *value );
+                                index_list.push_back( index );
+                            }
+                            it->second = std::move(value);
                         }
                     }
                 }
@@ -479,29 +516,22 @@ namespace Opm
         void unpack_map(const std::vector<T>& value_list,
                         const std::vector<std::size_t>& index_list) {
 
-            std::unordered_map<K, std::vector<std::pair<std::size_t, T>>> storage;
-            for (std::size_t storage_index = 0; storage_index < value_list.size(); storage_index++) {
-                const auto& value = value_list[storage_index];
-                const auto& time_index = index_list[storage_index];
-
-                storage[ value.name() ].emplace_back( time_index, value );
-            }
-
-            for (const auto& [key, values] : storage) {
-                for (std::size_t unique_index = 0; unique_index < values.size(); unique_index++) {
-                    const auto& [time_index, value] = values[unique_index];
-                    auto last_index = this->snapshots.size();
-                    if (unique_index < (values.size() - 1))
-                        last_index = values[unique_index + 1].first;
-
-                    auto& map_value = this->snapshots[time_index].template get_map<K,T>();
-                    map_value.update(std::move(value));
-
-                    for (std::size_t index=time_index + 1; index < last_index; index++) {
-                        auto& forward_map = this->snapshots[index].template get_map<K,T>();
-                        forward_map.update( key, map_value );
-                    }
-                }
+            std::vector<std::size_t> order(value_list.size());
+            std::iota(order.begin(), order.end(), std::size_t{0});
+            std::stable_sort(order.begin(), order.end(),
+                             [&index_list](const std::size_t i1, const std::size_t i2)
+                             { return index_list[i1] < index_list[i2]; });
+
+            // Each report step starts out as a copy of the previous one,
+            // sharing the storage of all unchanged objects.
+            auto next = order.begin();
+            for (std::size_t time_index = 0; time_index < this->snapshots.size(); time_index++) {
+                auto& map_value = this->snapshots[time_index].template get_map<K,T>();
+                if (time_index > 0)
+                    map_value = this->snapshots[time_index - 1].template get_map<K,T>();
+
+                for (; (next != order.end()) && (index_list[*next] == time_index); ++next)
+                    map_value.update(value_list[*next]);
             }
         }
 
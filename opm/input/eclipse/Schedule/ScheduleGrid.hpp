@@ -21,6 +21,8 @@
 
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 
+#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
+
 namespace Opm {
 
 class EclipseGrid;
@@ -34,10 +36,16 @@ public:
     const CompletedCells::Cell& get_cell(std::size_t i, std::size_t j, std::size_t k) const;
     const Opm::EclipseGrid* get_grid() const;
 
+    // Bounding box search tree of the active grid cells, used to intersect
+    // well trajectories with the grid.  Built on first use and shared by
+    // all subsequent trajectory wells.
+    const external::cvf::BoundingBoxTree& cellSearchTree() const;
+
 private:
     const EclipseGrid* grid{nullptr};
     const FieldPropsManager* fp{nullptr};
     CompletedCells& cells;
+    mutable external::cvf::ref<external::cvf::BoundingBoxTree> searchTree;
 };
 
 
@@ -27,6 +27,7 @@
 #include <unordered_map>
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/common/utility/PersistentMap.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
@@ -139,6 +140,14 @@ namespace Opm {
                 return *this->m_data;
             }
 
+            /*
+              Address of the shared instance, or nullptr if the member has
+              not been assigned.
+            */
+            const T* get_ptr() const {
+                return this->m_data.get();
+            }
+
         private:
             std::shared_ptr<T> m_data;
         };
@@ -153,11 +162,17 @@ namespace Opm {
               const K& T::name() const;
 
           Which is used to get the storage key for the objects.
+
+          The map itself is a PersistentMap, i.e. consecutive ScheduleState
+          instances share the storage of all map entries which have not been
+          updated, and an update only copies the path to the updated entry.
          */
 
         template <typename K, typename T>
         class map_member {
         public:
+            using storage_type = PersistentMap<K, std::shared_ptr<T>>;
+
             std::vector<K> keys() const {
                 std::vector<K> key_vector;
                 std::transform( this->m_data.begin(), this->m_data.end(), std::back_inserter(key_vector), [](const auto& pair) { return pair.first; });
@@ -176,29 +191,28 @@ namespace Opm {
 
 
             const std::shared_ptr<T> get_ptr(const K& key) const {
-                auto iter = this->m_data.find(key);
-                if (iter != this->m_data.end())
-                    return iter->second;
+                const auto* ptr = this->m_data.find(key);
+                if (ptr != nullptr)
+                    return *ptr;
 
                 return {};
             }
 
 
             bool has(const K& key) const {
-                auto ptr = this->get_ptr(key);
-                return (ptr != nullptr);
+                return this->m_data.contains(key);
             }
 
 
             void update(T object) {
                 auto key = object.name();
-                this->m_data[key] = std::make_shared<T>( std::move(object) );
+                this->m_data.insert_or_assign(key, std::make_shared<T>( std::move(object) ));
             }
 
             void update(const K& key, const map_member<K,T>& other) {
                 auto other_ptr = other.get_ptr(key);
                 if (other_ptr)
-                    this->m_data[key] = other.get_ptr(key);
+                    this->m_data.insert_or_assign(key, std::move(other_ptr));
                 else
                     throw std::logic_error(std::string{"Tried to update member: "} + as_string(key) + std::string{"with uninitialized object"});
             }
@@ -208,11 +222,11 @@ namespace Opm {
             }
 
             const T& get(const K& key) const {
-                return *this->m_data.at(key);
+                return *this->at(key);
             }
 
             T& get(const K& key) {
-                return *this->m_data.at(key);
+                return *this->at(key);
             }
 
 
@@ -240,12 +254,15 @@ namespace Opm {
                 if (this->m_data.size() != other.m_data.size())
                     return false;
 
+                if (this->m_data.sharesStorage(other.m_data))
+                    return true;
+
                 for (const auto& [key1, ptr1] : this->m_data) {
-                    const auto& ptr2 = other.get_ptr(key1);
-                    if (!ptr2)
+                    const auto* ptr2 = other.m_data.find(key1);
+                    if (ptr2 == nullptr)
                         return false;
 
-                    if (!(*ptr1 == *ptr2))
+                    if ((ptr1 != *ptr2) && !(*ptr1 == **ptr2))
                         return false;
                 }
                 return true;
@@ -256,26 +273,42 @@ namespace Opm {
                 return this->m_data.size();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator begin() const {
+            typename storage_type::const_iterator begin() const {
                 return this->m_data.begin();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator end() const {
+            typename storage_type::const_iterator end() const {
                 return this->m_data.end();
             }
 
+            /*
+              The underlying map, e.g. for inspecting which parts of the
+              storage are shared with other ScheduleState instances.
+            */
+            const storage_type& storage() const {
+                return this->m_data;
+            }
+
 
             static map_member<K,T> serializationTestObject() {
                 map_member<K,T> map_object;
                 T value_object = T::serializationTestObject();
                 K key = value_object.name();
-                map_object.m_data.emplace( key, std::make_shared<T>( std::move(value_object) ));
+                map_object.m_data.insert_or_assign( key, std::make_shared<T>( std::move(value_object) ));
                 return map_object;
             }
 
 
         private:
-            std::unordered_map<K, std::shared_ptr<T>> m_data;
+            storage_type m_data;
+
+            const std::shared_ptr<T>& at(const K& key) const {
+                const auto* ptr = this->m_data.find(key);
+                if (ptr == nullptr)
+                    throw std::out_of_range(std::string{"No such member: "} + as_string(key));
+
+                return *ptr;
+            }
         };
 
 
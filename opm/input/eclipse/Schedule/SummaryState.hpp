@@ -23,11 +23,13 @@
 #include <opm/common/utility/TimeService.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <iosfwd>
+#include <iterator>
 #include <optional>
-#include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -63,11 +65,62 @@ class UDQSet;
 //     // accessible through the specialized st.has_well_var("OPY", "WGOR").
 //     st.has("WGOR:OPY") => True
 //     st.has_well_var("OPY", "WGOR") => False
+//
+// Internally the well, group, connection and segment values are stored only
+// in dense arrays indexed by interned names, and the general key/value map
+// holds the remaining values.  The general string API and the iterators
+// present both as one collection.  Colon separated keys are split and
+// looked up in the dense arrays on access, and are formed on the fly while
+// iterating.  Callers which update the same variables repeatedly can use the
+// well_id()/well_var_id() family of functions and the batched
+// update_well_vars() and update_group_vars() methods to avoid the string
+// handling altogether.
 
 class SummaryState
 {
 public:
-    typedef std::unordered_map<std::string, double>::const_iterator const_iterator;
+    // Forward iterator over all values, as ("VAR:NAME", value) pairs.  The
+    // keys of well, group, connection and segment values are formed when
+    // the iterator reaches them.  The iteration order is unspecified.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        reference operator*() const { return this->current; }
+        pointer operator->() const { return &this->current; }
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const
+        {
+            return ! (*this == other);
+        }
+
+    private:
+        friend class SummaryState;
+
+        enum class Table { Values, Wells, Groups, Connections, Segments, End };
+
+        const_iterator(const SummaryState& st, Table table);
+
+        void settle();
+
+        const SummaryState* st{nullptr};
+        Table table{Table::End};
+        std::unordered_map<std::string, double>::const_iterator value_pos{};
+        std::size_t var{0};
+        std::size_t name{0};
+        std::size_t index{0};
+        value_type current{};
+    };
+
     explicit SummaryState(time_point sim_start_arg);
 
     // The std::time_t constructor is only for export to Python
@@ -79,8 +132,8 @@ public:
     // The canonical way to update the SummaryState is through the
     // update_xxx() methods which will inspect the variable and either
     // accumulate or just assign, depending on whether it represents a total
-    // or not. The set() method is low level and unconditionally do an
-    // assignment.
+    // or not, and return the resulting value. The set() method is low level
+    // and unconditionally do an assignment.
     void set(const std::string& key, double value);
 
     bool erase(const std::string& key);
@@ -95,13 +148,44 @@ public:
     bool has_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const;
     bool has_segment_var(const std::string& well, const std::string& var, std::size_t segment) const;
 
-    void update(const std::string& key, double value);
-    void update_well_var(const std::string& well, const std::string& var, double value);
-    void update_group_var(const std::string& group, const std::string& var, double value);
+    double update(const std::string& key, double value);
+    double update_well_var(const std::string& well, const std::string& var, double value);
+    double update_group_var(const std::string& group, const std::string& var, double value);
     void update_elapsed(double delta);
     void update_udq(const UDQSet& udq_set, double undefined_value);
-    void update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value);
-    void update_segment_var(const std::string& well, const std::string& var, std::size_t segment, double value);
+    double update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value);
+    double update_segment_var(const std::string& well, const std::string& var, std::size_t segment, double value);
+
+    // Dense identifiers of well and group names and of well and group
+    // variables.  The identifiers are assigned on first use and remain
+    // valid for the lifetime of the object.
+    std::size_t well_id(const std::string& well);
+    std::size_t well_var_id(const std::string& var);
+    std::size_t group_id(const std::string& group);
+    std::size_t group_var_id(const std::string& var);
+
+    // Identifiers of names which have already been assigned one.  Unlike
+    // the functions above these never assign new identifiers.
+    std::optional<std::size_t> find_well_id(const std::string& well) const;
+    std::optional<std::size_t> find_well_var_id(const std::string& var) const;
+    std::optional<std::size_t> find_group_id(const std::string& group) const;
+    std::optional<std::size_t> find_group_var_id(const std::string& var) const;
+
+    // Batched versions of update_well_var() and update_group_var() for a
+    // single variable in several wells or groups.  The name and value
+    // arrays must have the same size.
+    void update_well_vars(const std::string& var,
+                          const std::vector<std::string>& wells,
+                          const std::vector<double>& values);
+    void update_well_vars(std::size_t var_id,
+                          const std::vector<std::size_t>& well_ids,
+                          const std::vector<double>& values);
+    void update_group_vars(const std::string& var,
+                           const std::vector<std::string>& groups,
+                           const std::vector<double>& values);
+    void update_group_vars(std::size_t var_id,
+                           const std::vector<std::size_t>& group_ids,
+                           const std::vector<double>& values);
 
     double get(const std::string&) const;
     double get(const std::string&, double) const;
@@ -114,6 +198,8 @@ public:
     double get_group_var(const std::string& group, const std::string& var, double) const;
     double get_conn_var(const std::string& conn, const std::string& var, std::size_t global_index, double) const;
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment, double) const;
+    double get_well_var(std::size_t var_id, std::size_t well_id, double) const;
+    double get_group_var(std::size_t var_id, std::size_t group_id, double) const;
 
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
@@ -133,11 +219,7 @@ public:
       serializer(elapsed);
       serializer(values);
       serializer(well_values);
-      serializer(m_wells);
-      serializer(well_names);
       serializer(group_values);
-      serializer(m_groups);
-      serializer(group_names);
       serializer(conn_values);
       serializer(segment_values);
     }
@@ -145,27 +227,156 @@ public:
     static SummaryState serializationTestObject();
 
 private:
+    // Interned names.  The identifiers are dense and assigned in order of
+    // first appearance.
+    class NameIndex
+    {
+    public:
+        std::size_t intern(const std::string& name);
+        std::optional<std::size_t> find(const std::string& name) const;
+
+        const std::string& name(const std::size_t id) const
+        {
+            return this->names_[id];
+        }
+
+        std::size_t size() const
+        {
+            return this->names_.size();
+        }
+
+        bool operator==(const NameIndex& other) const
+        {
+            return this->names_ == other.names_;
+        }
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(names_);
+            if (! serializer.isSerializing()) {
+                this->ids_.clear();
+                for (std::size_t id = 0; id < this->names_.size(); ++id)
+                    this->ids_.emplace(this->names_[id], id);
+            }
+        }
+
+    private:
+        std::vector<std::string> names_{};
+        std::unordered_map<std::string, std::size_t> ids_{};
+    };
+
+    // Plain data, so that entire columns are packed in one go.
+    struct Cell
+    {
+        double value;
+        bool defined;
+    };
+
+    struct IndexedCell
+    {
+        std::size_t index;
+        double value;
+    };
+
+    // Well or group values.  One column per variable, indexed by the well
+    // or group identifier.  Columns are extended on demand.
+    struct EntityValues
+    {
+        NameIndex variables{};
+        NameIndex entities{};
+        std::vector<bool> total{};
+        std::vector<std::vector<Cell>> columns{};
+
+        // Number of defined values of each variable.
+        std::vector<std::size_t> num_defined_var{};
+
+        // Whether or not the entity has at least one defined value, and
+        // the sorted names of those entities.
+        std::vector<bool> listed{};
+        std::size_t num_listed{0};
+        std::vector<std::string> sorted_names{};
+
+        std::size_t variable_id(const std::string& var);
+        std::size_t entity_id(const std::string& entity);
+        const Cell* find(const std::string& var, const std::string& entity) const;
+        const Cell* find(std::size_t var, std::size_t entity) const;
+        bool has_variable(const std::string& var) const;
+        std::pair<double, bool> update(std::size_t var, std::size_t entity, double value);
+        void set_listed(std::size_t entity, bool is_listed);
+        bool erase(const std::string& var, const std::string& entity);
+        void append(const EntityValues& other);
+        std::vector<std::string> names(const std::string& var) const;
+        const std::vector<std::string>& names() const;
+        std::size_t num_defined() const;
+        bool operator==(const EntityValues& other) const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(variables);
+            serializer(entities);
+            serializer(total);
+            serializer(columns);
+            serializer(num_defined_var);
+            serializer(listed);
+            serializer(num_listed);
+            serializer(sorted_names);
+        }
+    };
+
+    // Connection or segment values.  One flat array per variable and well,
+    // sorted on the connection's global index or the segment number.
+    struct IndexedValues
+    {
+        NameIndex variables{};
+        NameIndex wells{};
+        std::vector<bool> total{};
+        std::vector<std::vector<std::vector<IndexedCell>>> cells{};
+
+        std::size_t variable_id(const std::string& var);
+        std::size_t well_id(const std::string& well);
+        const IndexedCell* find(const std::string& var, const std::string& well, std::size_t index) const;
+        const IndexedCell* find(std::size_t var, std::size_t well, std::size_t index) const;
+        std::pair<double, bool> update(std::size_t var, std::size_t well, std::size_t index, double value);
+        bool erase(const std::string& var, const std::string& well, std::size_t index);
+        void append(const IndexedValues& other);
+        std::size_t num_defined() const;
+        bool operator==(const IndexedValues& other) const;
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(variables);
+            serializer(wells);
+            serializer(total);
+            serializer(cells);
+        }
+    };
+
     time_point sim_start;
     double elapsed = 0;
+
+    // Values which are not stored in one of the dense tables below.
     std::unordered_map<std::string,double> values;
 
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
-    std::set<std::string> m_wells;
-    mutable std::optional<std::vector<std::string>> well_names;
+    EntityValues well_values;
+    EntityValues group_values;
 
-    // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
-    std::set<std::string> m_groups;
-    mutable std::optional<std::vector<std::string>> group_names;
+    // NB: The global_index of the connection values has offset 1, and
+    // the segment values are keyed on the one-based segment number.
+    IndexedValues conn_values;
+    IndexedValues segment_values;
 
-    // The first key is the variable and the second key is the well and the
-    // third is the global index. NB: The global_index has offset 1!
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
+    const double* find_dense(const std::string& key) const;
+    double* find_dense(const std::string& key);
+    bool erase_dense(const std::string& key);
 
-    // The first key is the variable and the second key is the well and the
-    // third is the one-based segment number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values;
+    double update_entity(EntityValues& table,
+                         std::size_t var, std::size_t entity, double value);
+    double update_indexed(IndexedValues& table,
+                          std::size_t var, std::size_t well,
+                          std::size_t index, double value);
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
@@ -59,6 +59,11 @@ namespace Opm {
         std::optional<double> get_well_var(const std::string& well, const std::string& var) const;
         std::optional<double> get_group_var(const std::string& group, const std::string& var) const;
         std::optional<double> get_segment_var(const std::string& well, const std::string& var, std::size_t segment) const;
+
+        // Values of 'var' for all wells(), or groups(), in order.
+        // Undefined values are represented by NaN.
+        void well_values(const std::string& var, std::vector<double>& values) const;
+        void group_values(const std::string& var, std::vector<double>& values) const;
         const UDT& get_udt(const std::string& name) const;
 
         void add(const std::string& key, double value);
@@ -40,6 +40,7 @@
 namespace Opm {
 
 class UDQASTNode;
+class UDQProgram;
 class ParseContext;
 class ErrorGuard;
 
@@ -88,6 +89,10 @@ public:
     std::pair<UDQUpdate, std::size_t> status() const;
     const std::vector<Opm::UDQToken> tokens() const;
 
+    /// Whether or not the expression is evaluated by a UDQProgram
+    /// rather than by traversing the syntax tree.
+    bool compiled() const;
+
     bool operator==(const UDQDefine& data) const;
 
     template <class Serializer>
@@ -101,18 +106,24 @@ public:
         serializer(string_data);
         serializer(m_update_status);
         serializer(m_report_step);
+
+        if (! serializer.isSerializing()) {
+            this->compile();
+        }
     }
 
 private:
     std::string m_keyword;
     std::vector<Opm::UDQToken> m_tokens;
     std::shared_ptr<UDQASTNode> ast;
+    std::shared_ptr<const UDQProgram> program;
     UDQVarType m_var_type;
     KeywordLocation m_location;
     std::size_t m_report_step;
     UDQUpdate m_update_status;
     mutable std::optional<std::string> string_data;
 
+    void compile();
     UDQSet scatter_scalar_value(UDQSet&& res, const UDQContext& context) const;
     UDQSet scatter_scalar_well_value(const UDQContext& context, const std::optional<double>& value) const;
     UDQSet scatter_scalar_group_value(const UDQContext& context, const std::optional<double>& value) const;
@@ -0,0 +1,116 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_PROGRAM_HPP
+#define UDQ_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+/// Linear form of a well or group level UDQ expression.
+///
+/// The program is a sequence of stack machine instructions, in the order
+/// in which the syntax tree evaluates its nodes.  Each stack entry is
+/// either a scalar or an array of doubles with one element per well, or
+/// group, in the order of the evaluation context.  Undefined values are
+/// represented by NaN, mirroring the UDQScalar convention of treating
+/// non-finite values as undefined, so the element-wise operations are
+/// plain loops without per-element bookkeeping.
+///
+/// Expressions using constructs which the program does not support, like
+/// comparisons, sorting, random numbers, table lookups or well name
+/// patterns, are not compiled and must be evaluated by the syntax tree.
+class UDQProgram
+{
+public:
+    /// Compile expression for evaluation into a set of the target type.
+    ///
+    /// \return Nullopt if the expression or target type is not supported.
+    static std::optional<UDQProgram>
+    compile(const UDQASTNode& ast, UDQVarType target_type);
+
+    /// Evaluate program.
+    ///
+    /// \return Nullopt if the result must be established by the syntax
+    /// tree, typically in order to report an error like combining an
+    /// undefined scalar with a set.
+    std::optional<UDQSet>
+    eval(const std::string& keyword, const UDQContext& context) const;
+
+private:
+    enum class OpCode : unsigned char
+    {
+        // Push.
+        LoadSet, LoadWell, LoadGroup, LoadField, LoadScalar, Constant,
+
+        // Pop two, push one.
+        Add, Sub, Mul, Div, Pow, UAdd, UMul, UMin, UMax,
+
+        // Replace top.
+        Abs, Def, Exp, Idv, Ln, Log, Nint,
+        Sum, Prod, Min, Max, Avea,
+        Scale,
+    };
+
+    struct Instruction
+    {
+        OpCode op;
+
+        // Whether or not the result, and the operands of binary
+        // operations, are sets rather than scalars.
+        bool is_set;
+        bool lhs_set;
+        bool rhs_set;
+
+        // Constant or scale factor.
+        double value;
+
+        // Indices into 'names' of the variable and the well or group.
+        std::size_t var;
+        std::size_t wgname;
+    };
+
+    UDQVarType target_type{UDQVarType::NONE};
+    std::vector<Instruction> code{};
+    std::vector<std::string> names{};
+    std::size_t max_depth{0};
+
+    explicit UDQProgram(UDQVarType target);
+
+    bool compile_node(const UDQASTNode& node, std::vector<bool>& stack);
+    bool compile_expression(const UDQASTNode& node, std::vector<bool>& stack);
+    void push(OpCode op, bool is_set, std::vector<bool>& stack,
+              double value = 0.0,
+              const std::string& var = "",
+              const std::string& wgname = "");
+};
+
+} // namespace Opm
+
+#endif // UDQ_PROGRAM_HPP
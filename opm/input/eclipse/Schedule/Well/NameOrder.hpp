@@ -28,6 +28,8 @@
 
 namespace Opm {
 
+class ShellPattern;
+
 // The purpose of this small class is to ensure that well and group name
 // always come in the order they are defined in the deck.
 
@@ -44,11 +46,17 @@ public:
     bool has(const std::string& wname) const;
     std::size_t size() const;
 
+    // Names matching a shell pattern, in the order they were added.  Only
+    // names starting with the literal prefix of the pattern are examined.
+    std::vector<std::string> match(const ShellPattern& pattern) const;
+
     template <class Serializer>
     void serializeOp(Serializer& serializer)
     {
         serializer(m_index_map);
         serializer(m_name_list);
+        if (!serializer.isSerializing())
+            this->rebuildSortedIndex();
     }
 
     static NameOrder serializationTestObject();
@@ -61,6 +69,11 @@ public:
 private:
     std::unordered_map<std::string, std::size_t> m_index_map;
     std::vector<std::string> m_name_list;
+
+    // Indices into m_name_list, ordered lexicographically by name.
+    std::vector<std::size_t> m_sorted_index;
+
+    void rebuildSortedIndex();
 };
 
 class GroupOrder
@@ -21,11 +21,13 @@
 #define CONNECTIONSET_HPP_
 
 #include <opm/input/eclipse/Schedule/Well/Connection.hpp>
-#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
 
+#include <array>
 #include <cstddef>
+#include <map>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <stddef.h>
@@ -39,6 +41,10 @@ namespace Opm {
     class EclipseGrid;
 } // namespace Opm
 
+namespace external {
+    struct WellPathCellIntersectionInfo;
+} // namespace external
+
 namespace Opm {
 
     class WellConnections
@@ -89,7 +95,16 @@ namespace Opm {
                          const std::string&     wname,
                          const KeywordLocation& location);
 
-        void loadCOMPTRAJ(const DeckRecord& record, const ScheduleGrid& grid, const std::string& wname, const KeywordLocation& location, external::cvf::ref<external::cvf::BoundingBoxTree>& cellSearchTree);
+        // Grid cells intersected by the perforated part of the WELTRAJ
+        // trajectory given in a COMPTRAJ record.  Does not modify the
+        // connections and may be called concurrently for different wells
+        // once grid.cellSearchTree() has been built.
+        std::vector<external::WellPathCellIntersectionInfo>
+        trajectoryIntersections(const DeckRecord& record, const ScheduleGrid& grid) const;
+
+        void loadCOMPTRAJ(const DeckRecord& record, const ScheduleGrid& grid, const std::string& wname, const KeywordLocation& location);
+        void loadCOMPTRAJ(const DeckRecord& record, const ScheduleGrid& grid, const std::string& wname, const KeywordLocation& location,
+                          const std::vector<external::WellPathCellIntersectionInfo>& intersections);
 
         void loadWELTRAJ(const DeckRecord& record, const ScheduleGrid& grid, const std::string& wname, const KeywordLocation& location);
 
@@ -162,6 +177,9 @@ namespace Opm {
             serializer(this->m_connections);
             serializer(this->coord);
             serializer(this->md);
+
+            if (!serializer.isSerializing())
+                this->rebuildIndex();
         }
     private:
         Connection::Order m_ordering { Connection::Order::TRACK };
@@ -171,6 +189,17 @@ namespace Opm {
         std::vector<std::vector<double>> coord{3, std::vector<double>(0, 0.0) };
         std::vector<double> md{};
 
+        // Position in m_connections of the (first) connection in each
+        // cell, keyed on global cell index and on (I,J,K) respectively.
+        // Maintained by add() and rebuilt whenever the connections are
+        // reordered or removed.
+        std::unordered_map<std::size_t, std::size_t> global_index_pos{};
+        std::map<std::array<int, 3>, std::size_t> ijk_pos{};
+
+        void indexConnection(std::size_t pos);
+        void rebuildIndex();
+        std::size_t findIJK(int i, int j, int k) const;
+
         void addConnection(const int i, const int j, const int k,
                            const std::size_t global_index,
                            const int complnum,
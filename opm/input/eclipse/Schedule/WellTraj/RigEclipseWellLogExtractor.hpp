@@ -47,9 +47,12 @@ class BoundingBox;
 class RigEclipseWellLogExtractor : public RigWellLogExtractor
 {
 public:
-    RigEclipseWellLogExtractor( const RigWellPath* wellpath, const Opm::EclipseGrid& grid, cvf::ref<cvf::BoundingBoxTree>& cellSearchTree);
+    RigEclipseWellLogExtractor( const RigWellPath* wellpath, const Opm::EclipseGrid& grid, const cvf::BoundingBoxTree& cellSearchTree);
 
-    cvf::ref<cvf::BoundingBoxTree> getCellSearchTree();
+    // Bounding box search tree of the active cells in grid. The tree is
+    // read only once built and may be shared by extractors running in
+    // different threads.
+    static cvf::ref<cvf::BoundingBoxTree> buildCellSearchTree(const Opm::EclipseGrid& grid);
 private:
     void                calculateIntersection();
     std::vector<size_t> findCloseCellIndices( const cvf::BoundingBox& bb );
@@ -67,11 +70,10 @@ private:
                            cvf::Vec3d&                      localXdirection,
                            cvf::Vec3d&                      localYdirection,
                            cvf::Vec3d&                      localZdirection ) const;
-    void buildCellSearchTree();
     void findIntersectingCells( const cvf::BoundingBox& inputBB, std::vector<size_t>* cellIndices ) const;
     void computeCachedData();
 
     const Opm::EclipseGrid& m_grid;
-    cvf::ref<cvf::BoundingBoxTree> m_cellSearchTree;
+    const cvf::BoundingBoxTree& m_cellSearchTree;
 };
 } //namespace external
@@ -21,6 +21,7 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 
+#include <cstdint>
 #include <ios>
 #include <map>
 #include <string>
@@ -67,6 +68,17 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
+    /// Selected elements of a restart array without loading the report
+    /// step.  See EclFile::getElements().
+    template <typename T>
+    std::vector<T> getRestartElements(const std::string&               name,
+                                      int                              reportStepNumber,
+                                      const std::vector<std::int64_t>& elements,
+                                      int                              occurrence = 0)
+    {
+        return this->getElements<T>(getArrayIndex(name, reportStepNumber, occurrence), elements);
+    }
+
     int occurrence_count(const std::string& name, int reportStepNumber) const;
     size_t numberOfReportSteps() const { return seqnum.size(); };
 
@@ -24,11 +24,13 @@
 #include <iosfwd>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <map>
 #include <stdint.h>
 
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/io/eclipse/ExtSmryBlocks.hpp>
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 namespace Opm { namespace EclIO {
@@ -59,7 +61,7 @@ public:
     void loadData(const std::vector<std::string>& vectList) const;
     void loadData() const;
 
-    bool make_esmry_file();
+    bool make_esmry_file(ExtSmryLayout layout = ExtSmryLayout::Transposed);
 
     time_point startdate() const { return tp_startdat; }
     std::vector<int> start_v() const { return start_vect; }
@@ -151,6 +153,9 @@ private:
     std::vector<int> makeKeywPosVector(int speInd) const;
     std::string read_string_from_disk(std::fstream& fileH, uint64_t size) const;
 
+    void loadDataSegment(std::size_t begin, std::size_t end,
+                         const std::vector<std::pair<int, int>>& columns) const;
+
     void read_ministeps_from_disk();
     int read_ministep_formatted(std::fstream& fileH);
 };
@@ -0,0 +1,300 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ECLARRAYVIEW_HPP
+#define OPM_IO_ECLARRAYVIEW_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+namespace detail {
+
+    inline std::uint32_t loadBigEndian32(const char* src)
+    {
+        std::uint32_t raw;
+        std::memcpy(&raw, src, sizeof raw);
+        return __builtin_bswap32(raw);
+    }
+
+    inline std::uint64_t loadBigEndian64(const char* src)
+    {
+        std::uint64_t raw;
+        std::memcpy(&raw, src, sizeof raw);
+        return __builtin_bswap64(raw);
+    }
+
+    template <typename T>
+    T decodeElement(const char* src, int elementSize)
+    {
+        if constexpr (std::is_same_v<T, int>) {
+            static_cast<void>(elementSize);
+            return static_cast<int>(loadBigEndian32(src));
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            static_cast<void>(elementSize);
+            const auto bits = loadBigEndian32(src);
+            float value;
+            std::memcpy(&value, &bits, sizeof value);
+            return value;
+        }
+        else if constexpr (std::is_same_v<T, double>) {
+            static_cast<void>(elementSize);
+            const auto bits = loadBigEndian64(src);
+            double value;
+            std::memcpy(&value, &bits, sizeof value);
+            return value;
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            static_cast<void>(elementSize);
+            std::uint32_t raw;
+            std::memcpy(&raw, src, sizeof raw);
+            if ((raw == true_value_ecl) || (raw == true_value_ix)) {
+                return true;
+            }
+            if (raw == false_value) {
+                return false;
+            }
+            throw std::runtime_error("Error reading logi value");
+        }
+        else {
+            static_assert(std::is_same_v<T, std::string>,
+                          "Unsupported element type in EclArrayView");
+
+            auto len = static_cast<std::size_t>(elementSize);
+            while ((len > 0) && (src[len - 1] == ' ')) {
+                --len;
+            }
+            return std::string(src, len);
+        }
+    }
+
+} // namespace detail
+
+/// Lazy, read-only view of one array in a memory mapped, unformatted
+/// ECLIPSE file.
+///
+/// No array data is copied when the view is created.  Elements are
+/// decoded--byte swapped and, for string arrays, trimmed--from the mapped
+/// pages only when accessed.  The view keeps the underlying mapping alive,
+/// so it remains valid even if the EclFile object that created it is
+/// destroyed.
+///
+/// Supported element types are int (INTE), float (REAL), double (DOUB),
+/// bool (LOGI), and std::string (CHAR, C0nn).
+template <typename T>
+class EclArrayView
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        const_iterator() = default;
+        const_iterator(const EclArrayView* view, size_type ix)
+            : view_(view), ix_(ix)
+        {}
+
+        T operator*() const { return (*this->view_)[this->ix_]; }
+
+        const_iterator& operator++() { ++this->ix_; return *this; }
+        const_iterator operator++(int) { auto old = *this; ++this->ix_; return old; }
+
+        difference_type operator-(const const_iterator& other) const
+        {
+            return static_cast<difference_type>(this->ix_) -
+                   static_cast<difference_type>(other.ix_);
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return (this->view_ == other.view_) && (this->ix_ == other.ix_);
+        }
+
+        bool operator!=(const const_iterator& other) const
+        {
+            return ! (*this == other);
+        }
+
+    private:
+        const EclArrayView* view_{nullptr};
+        size_type ix_{0};
+    };
+
+    EclArrayView() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] file Mapped file containing array.
+    ///
+    /// \param[in] dataOffset Byte offset of the first data block's leading
+    ///    record marker, i.e., the position immediately after the array
+    ///    header.
+    ///
+    /// \param[in] size Number of array elements.
+    ///
+    /// \param[in] elementSize Number of bytes per element on disk.
+    ///
+    /// \param[in] elementsPerBlock Number of elements in each full Fortran
+    ///    record.
+    EclArrayView(std::shared_ptr<const MappedFile> file,
+                 const std::uint64_t dataOffset,
+                 const std::int64_t size,
+                 const int elementSize,
+                 const int elementsPerBlock)
+        : file_            (std::move(file))
+        , dataOffset_      (dataOffset)
+        , size_            (static_cast<size_type>(size))
+        , elementSize_     (elementSize)
+        , elementsPerBlock_(elementsPerBlock)
+    {}
+
+    size_type size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+
+    /// Decode single element.  No range checking.
+    T operator[](const size_type ix) const
+    {
+        return detail::decodeElement<T>(this->address(ix), this->elementSize_);
+    }
+
+    /// Decode single element.  Throws std::out_of_range if \p ix is not
+    /// a valid element index.
+    T at(const size_type ix) const
+    {
+        if (ix >= this->size_) {
+            throw std::out_of_range("Element index out of range in EclArrayView");
+        }
+
+        return (*this)[ix];
+    }
+
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, this->size_ }; }
+
+    /// Decode the elements [first, first+count) into an output range.
+    ///
+    /// Processes one Fortran record at a time, validating the record
+    /// markers, so is considerably faster than element-wise access for
+    /// larger ranges.
+    ///
+    /// \return Output iterator past the last decoded element.
+    template <typename OutputIt>
+    OutputIt copy(OutputIt out, size_type first, size_type count) const
+    {
+        if ((first > this->size_) || (count > this->size_ - first)) {
+            throw std::out_of_range("Element range out of bounds in EclArrayView");
+        }
+
+        const auto perBlock = static_cast<size_type>(this->elementsPerBlock_);
+
+        while (count > 0) {
+            const auto block = first / perBlock;
+            const auto inBlock = first % perBlock;
+            const auto blockSize = std::min(perBlock, this->size_ - block*perBlock);
+            const auto num = std::min(count, blockSize - inBlock);
+
+            const char* head = this->blockStart(block);
+            const auto marker = detail::loadBigEndian32(head);
+            const auto tail = detail::loadBigEndian32(head + 4 + blockSize*this->elementSize_);
+
+            if ((marker != blockSize*this->elementSize_) || (marker != tail)) {
+                throw std::runtime_error("Error reading binary data, inconsistent "
+                                         "record markers in " + this->file_->filename());
+            }
+
+            const char* src = head + 4 + inBlock*this->elementSize_;
+            for (size_type i = 0; i < num; ++i, src += this->elementSize_) {
+                *out++ = detail::decodeElement<T>(src, this->elementSize_);
+            }
+
+            first += num;
+            count -= num;
+        }
+
+        return out;
+    }
+
+    /// Decode all elements into a new vector.
+    std::vector<T> toVector() const
+    {
+        auto values = std::vector<T>(this->size_);
+        this->copy(values.begin(), 0, this->size_);
+        return values;
+    }
+
+    /// Hint that the elements [first, first+count) will be accessed soon.
+    void prefetch(size_type first, size_type count) const
+    {
+        if ((count == 0) || (first >= this->size_)) {
+            return;
+        }
+
+        const auto begin = static_cast<std::uint64_t>(this->address(first) - this->file_->data());
+        const auto last = std::min(this->size_, first + count) - 1;
+        const auto end = static_cast<std::uint64_t>(this->address(last) - this->file_->data())
+            + this->elementSize_;
+
+        this->file_->willNeed(begin, end - begin);
+    }
+
+private:
+    std::shared_ptr<const MappedFile> file_{};
+    std::uint64_t dataOffset_{0};
+    size_type size_{0};
+    int elementSize_{0};
+    int elementsPerBlock_{1};
+
+    const char* blockStart(const size_type block) const
+    {
+        // Every record but the last holds exactly elementsPerBlock_
+        // elements, framed by leading and trailing four byte markers.
+        const auto blockBytes = static_cast<std::uint64_t>(this->elementsPerBlock_) * this->elementSize_ + 2*4;
+        return this->file_->data() + this->dataOffset_ + block*blockBytes;
+    }
+
+    const char* address(const size_type ix) const
+    {
+        const auto perBlock = static_cast<size_type>(this->elementsPerBlock_);
+        return this->blockStart(ix / perBlock) + 4 + (ix % perBlock)*this->elementSize_;
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLARRAYVIEW_HPP
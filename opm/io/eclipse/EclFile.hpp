@@ -19,10 +19,12 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/EclArrayView.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <ios>
 #include <map>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <tuple>
@@ -39,9 +41,23 @@ public:
         bool value;
     };
 
+    /// Opt-in memory mapped access to unformatted files.  The array index
+    /// is built from the mapped Fortran record headers and array data is
+    /// decoded directly from the mapped pages.  Formatted files are read
+    /// through regular streams regardless of this setting.
+    ///
+    /// Only getView() avoids copying array data.  The get() and loadData()
+    /// functions still decode the requested arrays into vectors owned by
+    /// this object, but without any stream reads.
+    struct MemoryMapped {
+        bool value;
+    };
+
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
+    EclFile(const std::string& filename, MemoryMapped mmap, bool preload = false);
     bool formattedInput() const { return formatted; }
+    bool memoryMapped() const { return static_cast<bool>(mappedFile); }
 
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
@@ -62,12 +78,38 @@ public:
 
     const std::vector<int>& getElementSizeList() const { return array_element_size; }
 
+    /// Array contents, loaded on first access and cached in this object.
+    /// In memory mapped mode the array is decoded from the mapped pages
+    /// into the cache, so this is a copy.  Use getView() to avoid it.
     template <typename T>
     const std::vector<T>& get(int arrIndex);
 
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    /// Zero-copy access to array in unformatted file.  Elements are
+    /// decoded from the memory mapped file on access and nothing is
+    /// cached in this object.  Maps the file on first use if the object
+    /// was not constructed in memory mapped mode.  Throws
+    /// std::runtime_error for formatted files.
+    template <typename T>
+    EclArrayView<T> getView(int arrIndex);
+
+    template <typename T>
+    EclArrayView<T> getView(const std::string& name);
+
+    /// Selected elements of an array, in the order of \p elements.  For
+    /// unformatted files only the parts of the array holding requested
+    /// elements are read, by seeking from the array's file offset, and
+    /// nothing is cached in this object.  Arrays in formatted files, and
+    /// arrays which are already loaded, are served from the full array.
+    /// Throws std::out_of_range for elements outside the array.
+    template <typename T>
+    std::vector<T> getElements(int arrIndex, const std::vector<std::int64_t>& elements);
+
+    template <typename T>
+    std::vector<T> getElements(const std::string& name, const std::vector<std::int64_t>& elements);
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -104,6 +146,21 @@ protected:
 
 private:
     std::vector<bool> arrayLoaded;
+    std::shared_ptr<const MappedFile> mappedFile;
+
+    template <typename T>
+    EclArrayView<T> makeView(int arrIndex) const;
+
+    template <typename T>
+    EclArrayView<T> getViewImpl(int arrIndex, eclArrType type, const std::string& typeStr);
+
+    template <typename T>
+    std::vector<T> readBinaryElements(int arrIndex, const std::vector<std::int64_t>& elements) const;
+
+    int arrayIndexOrThrow(const std::string& name) const;
+
+    void loadMappedArray(std::size_t arrIndex);
+    void indexMappedFile();
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
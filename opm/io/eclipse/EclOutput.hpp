@@ -19,6 +19,7 @@
 #define OPM_IO_ECLOUTPUT_HPP
 
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <string>
 #include <typeinfo>
@@ -74,6 +75,18 @@ public:
         }
     }
 
+    // Callback which transforms a contiguous range of values in place.
+    using ConvertBlock = std::function<void(double* begin, double* end)>;
+
+    // Write 'data' as a DOUB array if 'write_double' and as a REAL array
+    // otherwise.  The values are copied, converted by 'convert' (unless
+    // empty), narrowed and byte-swapped one output block at a time, so
+    // no temporary copy of the full array is created.
+    void write(const std::string&         name,
+               const std::vector<double>& data,
+               const ConvertBlock&        convert,
+               const bool                 write_double);
+
     // when this function is used array type will be assumed C0NN (not CHAR).
     // Also in cases where element size is 8 or less, element size will be 8.
 
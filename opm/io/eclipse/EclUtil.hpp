@@ -63,6 +63,10 @@ namespace Opm { namespace EclIO {
     void readBinaryHeader(std::fstream& fileH, std::string& arrName,
                       std::int64_t& size, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
+    /// Array type and on-disk element size in bytes from four character
+    /// type string of a binary array header.
+    std::tuple<Opm::EclIO::eclArrType, int> binaryArrayType(const std::string& typeStr);
+
     void readFormattedHeader(std::fstream& fileH, std::string& arrName,
                       std::int64_t &num, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
@@ -21,6 +21,7 @@
 
 #include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -74,7 +75,22 @@ private:
     std::filesystem::path m_inputFileName;
     std::vector<std::filesystem::path> m_esmry_files;
 
+    // Time block of ESMRY file with chunked layout.
+    struct TimeBlock {
+        // File position of first record marker of BLKDATA array.
+        uint64_t dataPos;
+
+        // Number of time steps in block.
+        size_t numSteps;
+
+        // Start of each vector's data in BLKDATA (in words), with one
+        // extra trailing entry equal to total size of BLKDATA.
+        std::vector<uint64_t> start;
+    };
+
     bool m_loadBaseRun;
+    std::vector<bool> m_chunked;
+    std::vector<std::vector<TimeBlock>> m_blocks;
     std::vector<std::map<std::string, int>> m_keyword_index;
     std::vector<std::tuple<int,int>> m_tstep_range;
     std::vector<std::string> m_keyword;
@@ -99,11 +115,18 @@ private:
     double m_io_opening;
     double m_io_loading;
 
-    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset);
+    bool open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset,
+                    bool& chunked, std::vector<TimeBlock>& blocks);
+
+    void index_blocks(std::fstream& fileH, size_t nVect, std::vector<int>& rstep,
+                      std::vector<int>& tstep, std::vector<TimeBlock>& blocks);
 
     bool load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind );
 
+    bool load_esmry_blocks(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
+                           const std::vector<int>& loadKeyIndex, int ind, int to_ind );
+
     void updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN);
 };
 
@@ -0,0 +1,96 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ExtSmryBlocks_HPP
+#define OPM_IO_ExtSmryBlocks_HPP
+
+#include <opm/input/eclipse/EclipseState/IOConfig/ExtSmryLayout.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class EclOutput;
+
+using ExtSmryLayout = ::Opm::ExtSmryLayout;
+
+/// Support for the chunked ESMRY layout.
+///
+/// A chunked file has the same leading header arrays as a transposed
+/// file--START, optionally RESTART and RSTNUM, KEYCHECK and UNITS--followed
+/// by
+///
+///    BLKSPEC  INTE [layout version, compression, number of vectors]
+///
+/// and then any number of time blocks, appended as the simulation
+/// progresses.  Each time block consists of
+///
+///    RSTEP    INTE [report step flag pr time step in block]
+///    TSTEP    INTE [time step number pr time step in block]
+///    BLKINDEX INTE [number of data words pr vector]
+///    BLKDATA  INTE [concatenated data of all vectors]
+///
+/// Each vector's data in BLKDATA starts with a word identifying its
+/// encoding, followed by the encoded values.
+namespace ExtSmryBlocks {
+
+    /// Version number of chunked layout.
+    constexpr int layoutVersion = 1;
+
+    /// Maximum number of time steps in a single block when converting
+    /// existing summary files.
+    constexpr std::size_t maxBlockSize = 1024;
+
+    enum class Compression : int {
+        None = 0,
+        DeltaShuffle = 1,
+    };
+
+    /// Write the BLKSPEC array identifying a chunked layout.
+    void writeSpec(EclOutput& outFile, int nVect, Compression compression);
+
+    /// Write one time block.
+    ///
+    /// \param[in] rstep Report step flags of block's time steps.
+    ///
+    /// \param[in] tstep Time step numbers of block's time steps.
+    ///
+    /// \param[in] vectorData Summary vector values.  Time steps
+    ///    [first, first + rstep.size()) of each vector form the block.
+    void writeBlock(EclOutput& outFile,
+                    const std::vector<int>& rstep,
+                    const std::vector<int>& tstep,
+                    const std::vector<std::vector<float>>& vectorData,
+                    std::size_t first,
+                    Compression compression);
+
+    /// Encode a sequence of summary values.
+    std::vector<int> encode(const float* values, std::size_t n,
+                            Compression compression);
+
+    /// Decode a sequence of n summary values.  Throws std::runtime_error
+    /// if the encoded data is inconsistent.
+    void decode(const int* words, std::size_t nWords,
+                float* values, std::size_t n);
+
+} // namespace ExtSmryBlocks
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ExtSmryBlocks_HPP
@@ -19,6 +19,8 @@
 #ifndef OPM_IO_ExtSmryOutput_HPP
 #define OPM_IO_ExtSmryOutput_HPP
 
+#include <opm/io/eclipse/ExtSmryBlocks.hpp>
+
 #include <array>
 #include <chrono>
 #include <string>
@@ -31,13 +33,16 @@ class GridDims;
 
 namespace EclIO {
 
+class EclOutput;
+
 class ExtSmryOutput
 {
 public:
     ExtSmryOutput(const std::vector<std::string>& valueKeys,
                   const std::vector<std::string>& valueUnits,
                   const EclipseState& es,
-                  const time_t start_time);
+                  const time_t start_time,
+                  const ExtSmryLayout layout = ExtSmryLayout::Transposed);
 
     void write(const std::vector<float>& ts_data,
                int report_step,
@@ -51,12 +56,16 @@ private:
     int m_nTimeSteps;
     int m_nVect;
     bool m_fmt;
+    ExtSmryLayout m_layout;
+    bool m_blockFileCreated{false};
 
     std::vector<int> m_start_date_vect;
     std::string m_restart_rootn;
     int m_restart_step;
     std::vector<std::string> m_smry_keys;
     std::vector<std::string> m_smryUnits;
+    // All time steps for transposed layout, time steps not yet written
+    // for chunked layouts.
     std::vector<int> m_rstep;
     std::vector<int> m_tstep;
     std::vector<std::vector<float>> m_smrydata;
@@ -66,6 +75,10 @@ private:
     std::vector<std::string> make_modified_keys(const std::vector<std::string>& valueKeys,
                                                 const GridDims& dims);
     bool rename_tmpfile(const std::string& tmp_fname);
+
+    void write_header(EclOutput& outFile) const;
+    void write_transposed();
+    void append_block();
 };
 
 
@@ -0,0 +1,74 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_MAPPEDFILE_HPP
+#define OPM_IO_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Read-only memory mapping of an entire file.
+///
+/// The mapping is shared, meaning all processes mapping the same file use
+/// the same pages from the operating system's page cache rather than
+/// private copies.  Pages are brought in on demand when first touched.
+///
+/// On platforms without POSIX memory mapping (Windows) the file contents
+/// are instead read into a buffer owned by the object.
+class MappedFile
+{
+public:
+    /// Map file into memory.  Throws std::runtime_error if the file
+    /// cannot be opened or mapped.
+    explicit MappedFile(const std::string& filename);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Start of mapped file contents.  Null if file is empty.
+    const char* data() const { return this->data_; }
+
+    /// Size of mapped file in bytes.
+    std::size_t size() const { return this->size_; }
+
+    /// Name of mapped file.
+    const std::string& filename() const { return this->filename_; }
+
+    /// Hint to the operating system that the byte range [offset,
+    /// offset+length) will be read soon.  No effect on platforms not
+    /// supporting such hints.
+    void willNeed(std::uint64_t offset, std::uint64_t length) const;
+
+private:
+    std::string filename_{};
+    const char* data_{nullptr};
+    std::size_t size_{0};
+
+    /// File contents if the file could not be memory mapped.
+    std::vector<char> buffer_{};
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_MAPPEDFILE_HPP
@@ -25,6 +25,7 @@
 
 #include <array>
 #include <chrono>
+#include <functional>
 #include <ios>
 #include <memory>
 #include <string>
@@ -205,6 +206,24 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&         kw,
                    const std::vector<double>& data);
 
+        /// Write converted floating point data to underlying output
+        /// stream without creating a temporary copy of the full array.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Input values.
+        ///
+        /// \param[in] convert In-place conversion of a range of values,
+        ///    applied to each output block in turn.  No conversion if
+        ///    empty.
+        ///
+        /// \param[in] write_double Whether to output double precision
+        ///    values.  Values are narrowed to single precision otherwise.
+        void write(const std::string&                           kw,
+                   const std::vector<double>&                   data,
+                   const std::function<void(double*, double*)>& convert,
+                   const bool                                   write_double);
+
         /// Write unpadded string data to underlying output stream.
         ///
         /// \param[in] kw Name of output vector (keyword).
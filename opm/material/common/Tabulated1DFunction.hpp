@@ -32,8 +32,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iosfwd>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace Opm {
@@ -278,6 +280,89 @@ public:
         return y0 + (y1 - y0)*(x - x0)/(x1 - x0);
     }
 
+    /*!
+     * \brief Evaluate the function at a sequence of positions.
+     *
+     * Equivalent to calling eval() and evalDerivative() for each position, but the
+     * segment found for one position is tried first for the next one, so sorted or
+     * spatially correlated positions rarely need a bisection.  The interpolation itself
+     * is done for blocks of positions in loops without branches, which the compiler may
+     * vectorize.
+     *
+     * \param n The number of positions
+     * \param x The positions
+     * \param values Array of size n receiving the function values
+     * \param derivatives Array of size n receiving the derivatives with respect to x,
+     *                    or nullptr if these are not needed
+     * \param extrapolate As for eval()
+     */
+    template <class Evaluation>
+    void evalBatch(size_t n,
+                   const Evaluation* x,
+                   Evaluation* values,
+                   std::add_pointer_t<Evaluation> derivatives = nullptr,
+                   bool extrapolate = false) const
+    {
+        constexpr size_t blockSize = 64;
+        size_t segIdx[blockSize];
+        SegmentIndex hint{0};
+
+        for (size_t blockStart = 0; blockStart < n; blockStart += blockSize) {
+            const size_t blockLen = std::min(blockSize, n - blockStart);
+            const Evaluation* xBlock = x + blockStart;
+
+            for (size_t k = 0; k < blockLen; ++k) {
+                hint = findSegmentIndex(xBlock[k], extrapolate, hint);
+                segIdx[k] = hint.value;
+            }
+
+            Evaluation* valueBlock = values + blockStart;
+            for (size_t k = 0; k < blockLen; ++k)
+                valueBlock[k] = eval(xBlock[k], SegmentIndex{segIdx[k]});
+
+            if (derivatives != nullptr) {
+                Evaluation* derivativeBlock = derivatives + blockStart;
+                for (size_t k = 0; k < blockLen; ++k)
+                    derivativeBlock[k] = evalDerivative_(xBlock[k], segIdx[k]);
+            }
+        }
+    }
+
+    /*!
+     * \brief Evaluate one function from a set of functions, e.g. one per PVT region,
+     *        at each position in a sequence.
+     *
+     * \param functions The set of functions
+     * \param regionIdx Array of size n with the index of the function to use at each
+     *                  position
+     *
+     * See evalBatch() for the other parameters.  Positions in consecutive runs of the
+     * same region are evaluated together.
+     */
+    template <class Evaluation, class RegionIndex>
+    static void evalBatch(const std::vector<Tabulated1DFunction>& functions,
+                          size_t n,
+                          const RegionIndex* regionIdx,
+                          const Evaluation* x,
+                          Evaluation* values,
+                          std::add_pointer_t<Evaluation> derivatives = nullptr,
+                          bool extrapolate = false)
+    {
+        size_t runStart = 0;
+        while (runStart < n) {
+            size_t runEnd = runStart + 1;
+            while (runEnd < n && regionIdx[runEnd] == regionIdx[runStart])
+                ++runEnd;
+
+            functions[regionIdx[runStart]].evalBatch(runEnd - runStart,
+                                                     x + runStart,
+                                                     values + runStart,
+                                                     derivatives ? derivatives + runStart : nullptr,
+                                                     extrapolate);
+            runStart = runEnd;
+        }
+    }
+
     /*!
      * \brief Evaluate the spline's derivative at a given position.
      *
@@ -457,50 +542,84 @@ public:
         else if (x >= xValues_[xValues_.size() - 2])
             return SegmentIndex{xValues_.size() - 2};
         else {
-            // bisection
-            size_t lowerIdx = 1;
-            size_t upperIdx = xValues_.size() - 2;
-            while (lowerIdx + 1 < upperIdx) {
-                size_t pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (x < xValues_[pivotIdx])
-                    upperIdx = pivotIdx;
-                else
-                    lowerIdx = pivotIdx;
-            }
+            return bisectSegmentIndex_(x, 1, xValues_.size() - 2);
+        }
+    }
 
-            if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1]) {
-                std::string msg = "Problematic interpolation/extrapolation "
-                                  "segment is found for the input value " +
-                                  std::to_string(Opm::getValue(x)) +
-                                  "\nthe lower index of the found segment is " +
-                                  std::to_string(lowerIdx) +
-                                  ", the size of the table is " +
-                                  std::to_string(numSamples()) +
-                                  ",\nand the end values of the found segment are " +
-                                  std::to_string(xValues_[lowerIdx]) +
-                                  " and " +
-                                  std::to_string(xValues_[lowerIdx + 1]) +
-                                  ", respectively.\n";
-                msg += "Outputting the problematic table for more information "
-                       "(with *** marking the found segment):";
-                for (size_t i = 0; i < numSamples(); ++i) {
-                    if (i % 10 == 0)
-                        msg += "\n";
-                    if (i == lowerIdx)
-                        msg += " ***";
-                    msg += " " + std::to_string(xValues_[i]);
-                    if (i == lowerIdx + 1)
-                        msg += " ***";
-                }
-                msg += "\n";
-                OpmLog::debug(msg);
-                throw std::runtime_error(msg);
+    /*!
+     * \brief Find the segment of a position, starting the search at the segment of a
+     *        nearby position.
+     *
+     * Returns the same segment as findSegmentIndex(x, extrapolate), but checks the
+     * hinted segment and its right neighbour before falling back to bisection.
+     */
+    template <class Evaluation>
+    SegmentIndex findSegmentIndex(const Evaluation& x, bool extrapolate, SegmentIndex hint) const
+    {
+        const size_t n = numSamples();
+        const size_t i = hint.value;
+        if (n >= 4 && i >= 1 && i + 3 <= n && isfinite(x)) {
+            // Interior segments are half-open intervals [x_i, x_{i+1}).
+            if (xValues_[1] < x && x < xValues_[n - 2]) {
+                if (xValues_[i] <= x && x < xValues_[i + 1])
+                    return SegmentIndex{i};
+
+                if (i + 4 <= n && xValues_[i + 1] <= x && x < xValues_[i + 2])
+                    return SegmentIndex{i + 1};
+
+                return x < xValues_[i]
+                    ? bisectSegmentIndex_(x, 1, i)
+                    : bisectSegmentIndex_(x, i, n - 2);
             }
-            return SegmentIndex{lowerIdx};
         }
+
+        return findSegmentIndex(x, extrapolate);
     }
 
 private:
+    // Bisection for the interior segment containing x in [x_lowerIdx, x_upperIdx).
+    template <class Evaluation>
+    SegmentIndex bisectSegmentIndex_(const Evaluation& x, size_t lowerIdx, size_t upperIdx) const
+    {
+        while (lowerIdx + 1 < upperIdx) {
+            size_t pivotIdx = (lowerIdx + upperIdx) / 2;
+            if (x < xValues_[pivotIdx])
+                upperIdx = pivotIdx;
+            else
+                lowerIdx = pivotIdx;
+        }
+
+        if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1]) {
+            std::string msg = "Problematic interpolation/extrapolation "
+                              "segment is found for the input value " +
+                              std::to_string(Opm::getValue(x)) +
+                              "\nthe lower index of the found segment is " +
+                              std::to_string(lowerIdx) +
+                              ", the size of the table is " +
+                              std::to_string(numSamples()) +
+                              ",\nand the end values of the found segment are " +
+                              std::to_string(xValues_[lowerIdx]) +
+                              " and " +
+                              std::to_string(xValues_[lowerIdx + 1]) +
+                              ", respectively.\n";
+            msg += "Outputting the problematic table for more information "
+                   "(with *** marking the found segment):";
+            for (size_t i = 0; i < numSamples(); ++i) {
+                if (i % 10 == 0)
+                    msg += "\n";
+                if (i == lowerIdx)
+                    msg += " ***";
+                msg += " " + std::to_string(xValues_[i]);
+                if (i == lowerIdx + 1)
+                    msg += " ***";
+            }
+            msg += "\n";
+            OpmLog::debug(msg);
+            throw std::runtime_error(msg);
+        }
+        return SegmentIndex{lowerIdx};
+    }
+
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, size_t segIdx) const
     {
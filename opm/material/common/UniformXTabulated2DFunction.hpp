@@ -33,8 +33,10 @@
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/common/MathToolbox.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iosfwd>
 #include <tuple>
 #include <type_traits>
@@ -214,6 +216,22 @@ public:
         }
     }
 
+    /*!
+     * \brief Return the interval index of a given position on the x-axis, trying the
+     *        interval of a nearby position first.
+     *
+     * Returns the same index as xSegmentIndex(x, extrapolate).
+     */
+    template <class Evaluation>
+    unsigned xSegmentIndex(const Evaluation& x, bool extrapolate, unsigned hint) const
+    {
+        if (hintedSegment_(xPos_.size(), hint, x,
+                           [this](unsigned idx) { return xPos_[idx]; }))
+            return hint;
+
+        return xSegmentIndex(x, extrapolate);
+    }
+
     /*!
      * \brief Return the relative position of an x value in an intervall
      *
@@ -263,6 +281,25 @@ public:
         }
     }
 
+    /*!
+     * \brief Return the interval index of a given position on the y-axis, trying the
+     *        interval of a nearby position first.
+     *
+     * Returns the same index as ySegmentIndex(y, xSampleIdx, extrapolate).
+     */
+    template <class Evaluation>
+    unsigned ySegmentIndex(const Evaluation& y, unsigned xSampleIdx,
+                           bool extrapolate, unsigned hint) const
+    {
+        const auto& colSamplePoints = samples_[xSampleIdx];
+        if (hintedSegment_(colSamplePoints.size(), hint, y,
+                           [&colSamplePoints](unsigned idx)
+                           { return std::get<1>(colSamplePoints[idx]); }))
+            return hint;
+
+        return ySegmentIndex(y, xSampleIdx, extrapolate);
+    }
+
     /*!
      * \brief Return the relative position of an y value in an interval
      *
@@ -323,6 +360,88 @@ public:
         return eval(i, j1, j2, alpha, beta1, beta2);
     }
 
+    /*!
+     * \brief Evaluate the function at a sequence of (x,y) positions.
+     *
+     * Equivalent to calling eval() for each position, but the table intervals found
+     * for one position are tried first for the next one, so that sorted or spatially
+     * correlated positions, e.g. the cells of a grid, rarely need a bisection.  The
+     * interval search and the interpolation are done in separate passes over blocks of
+     * positions.
+     *
+     * \param n The number of positions
+     * \param x Array of size n with the positions on the x-axis
+     * \param y Array of size n with the positions on the y-axis
+     * \param values Array of size n receiving the function values
+     * \param extrapolate As for eval()
+     */
+    template <class Evaluation>
+    void evalBatch(size_t n,
+                   const Evaluation* x,
+                   const Evaluation* y,
+                   Evaluation* values,
+                   bool extrapolate = false) const
+    {
+        constexpr size_t blockSize = 64;
+        unsigned i[blockSize], j1[blockSize], j2[blockSize];
+        Evaluation alpha[blockSize], beta1[blockSize], beta2[blockSize];
+
+        unsigned iHint = 0, j1Hint = 0, j2Hint = 0;
+        for (size_t blockStart = 0; blockStart < n; blockStart += blockSize) {
+            const size_t blockLen = std::min(blockSize, n - blockStart);
+
+            for (size_t k = 0; k < blockLen; ++k) {
+                i[k] = iHint;
+                j1[k] = j1Hint;
+                j2[k] = j2Hint;
+                findPoints_(i[k], j1[k], j2[k], alpha[k], beta1[k], beta2[k],
+                            x[blockStart + k], y[blockStart + k], extrapolate,
+                            /*hinted=*/true);
+                iHint = i[k];
+                j1Hint = j1[k];
+                j2Hint = j2[k];
+            }
+
+            for (size_t k = 0; k < blockLen; ++k)
+                values[blockStart + k] = eval(i[k], j1[k], j2[k], alpha[k], beta1[k], beta2[k]);
+        }
+    }
+
+    /*!
+     * \brief Evaluate one function from a set of functions, e.g. one per PVT region,
+     *        at each position in a sequence.
+     *
+     * \param functions The set of functions
+     * \param regionIdx Array of size n with the index of the function to use at each
+     *                  position
+     *
+     * See evalBatch() for the other parameters.  Positions in consecutive runs of the
+     * same region are evaluated together.
+     */
+    template <class Evaluation, class RegionIndex>
+    static void evalBatch(const std::vector<UniformXTabulated2DFunction>& functions,
+                          size_t n,
+                          const RegionIndex* regionIdx,
+                          const Evaluation* x,
+                          const Evaluation* y,
+                          Evaluation* values,
+                          bool extrapolate = false)
+    {
+        size_t runStart = 0;
+        while (runStart < n) {
+            size_t runEnd = runStart + 1;
+            while (runEnd < n && regionIdx[runEnd] == regionIdx[runStart])
+                ++runEnd;
+
+            functions[regionIdx[runStart]].evalBatch(runEnd - runStart,
+                                                     x + runStart,
+                                                     y + runStart,
+                                                     values + runStart,
+                                                     extrapolate);
+            runStart = runEnd;
+        }
+    }
+
     template <class Evaluation>
     void findPoints(unsigned& i,
                     unsigned& j1,
@@ -334,61 +453,7 @@ public:
                     const Evaluation& y,
                     bool extrapolate) const
     {
-#ifndef NDEBUG
-        if (!extrapolate && !applies(x, y)) {
-            if constexpr (std::is_floating_point_v<Evaluation>) {
-                throw NumericalProblem("Attempt to get undefined table value (" +
-                                       std::to_string(x) + ", " +
-                                       std::to_string(y) + ")");
-            } else {
-                throw NumericalProblem("Attempt to get undefined table value (" +
-                                       std::to_string(x.value()) + ", " +
-                                       std::to_string(y.value()) + ")");
-            }
-        };
-#endif
-
-        // bi-linear interpolation: first, calculate the x and y indices in the lookup
-        // table ...
-        i = xSegmentIndex(x, extrapolate);
-        alpha = xToAlpha(x, i);
-        // The 'shift' is used to shift the points used to interpolate within
-        // the (i) and (i+1) sets of sample points, so that when approaching
-        // the boundary of the domain given by the samples, one gets the same
-        // value as one would get by interpolating along the boundary curve
-        // itself.
-        Evaluation shift = 0.0;
-        if (interpolationGuide_ == InterpolationPolicy::Vertical) {
-            // Shift is zero, no need to reset it.
-        } else {
-            // find upper and lower y value
-            if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
-                // The domain is above the boundary curve, up to y = infinity.
-                // The shift is therefore the same for all values of y.
-                shift = yPos_[i+1] - yPos_[i];
-            } else {
-                assert(interpolationGuide_ == InterpolationPolicy::RightExtreme);
-                // The domain is below the boundary curve, down to y = 0.
-                // The shift is therefore no longer the the same for all
-                // values of y, since at y = 0 the shift must be zero.
-                // The shift is computed by linear interpolation between
-                // the maximal value at the domain boundary curve, and zero.
-                shift = yPos_[i+1] - yPos_[i];
-                auto yEnd = yPos_[i]*(1.0 - alpha) + yPos_[i+1]*alpha;
-                if (yEnd > 0.) {
-                    shift = shift * y / yEnd;
-                } else {
-                    shift = 0.;
-                }
-            }
-        }
-        auto yLower =  y - alpha*shift;
-        auto yUpper =  y + (1-alpha)*shift;
-
-        j1 = ySegmentIndex(yLower, i, extrapolate);
-        j2 = ySegmentIndex(yUpper, i + 1, extrapolate);
-        beta1 = yToBeta(yLower, i, j1);
-        beta2 = yToBeta(yUpper, i + 1, j2);
+        findPoints_(i, j1, j2, alpha, beta1, beta2, x, y, extrapolate, /*hinted=*/false);
     }
 
     template <class Evaluation>
@@ -477,6 +542,95 @@ public:
     }
 
 private:
+    // If hinted is true, the incoming values of i, j1 and j2 are the intervals of a
+    // nearby position and are tried first.
+    template <class Evaluation>
+    void findPoints_(unsigned& i,
+                     unsigned& j1,
+                     unsigned& j2,
+                     Evaluation& alpha,
+                     Evaluation& beta1,
+                     Evaluation& beta2,
+                     const Evaluation& x,
+                     const Evaluation& y,
+                     bool extrapolate,
+                     bool hinted) const
+    {
+#ifndef NDEBUG
+        if (!extrapolate && !applies(x, y)) {
+            if constexpr (std::is_floating_point_v<Evaluation>) {
+                throw NumericalProblem("Attempt to get undefined table value (" +
+                                       std::to_string(x) + ", " +
+                                       std::to_string(y) + ")");
+            } else {
+                throw NumericalProblem("Attempt to get undefined table value (" +
+                                       std::to_string(x.value()) + ", " +
+                                       std::to_string(y.value()) + ")");
+            }
+        };
+#endif
+
+        // bi-linear interpolation: first, calculate the x and y indices in the lookup
+        // table ...
+        i = hinted ? xSegmentIndex(x, extrapolate, i) : xSegmentIndex(x, extrapolate);
+        alpha = xToAlpha(x, i);
+        // The 'shift' is used to shift the points used to interpolate within
+        // the (i) and (i+1) sets of sample points, so that when approaching
+        // the boundary of the domain given by the samples, one gets the same
+        // value as one would get by interpolating along the boundary curve
+        // itself.
+        Evaluation shift = 0.0;
+        if (interpolationGuide_ == InterpolationPolicy::Vertical) {
+            // Shift is zero, no need to reset it.
+        } else {
+            // find upper and lower y value
+            if (interpolationGuide_ == InterpolationPolicy::LeftExtreme) {
+                // The domain is above the boundary curve, up to y = infinity.
+                // The shift is therefore the same for all values of y.
+                shift = yPos_[i+1] - yPos_[i];
+            } else {
+                assert(interpolationGuide_ == InterpolationPolicy::RightExtreme);
+                // The domain is below the boundary curve, down to y = 0.
+                // The shift is therefore no longer the the same for all
+                // values of y, since at y = 0 the shift must be zero.
+                // The shift is computed by linear interpolation between
+                // the maximal value at the domain boundary curve, and zero.
+                shift = yPos_[i+1] - yPos_[i];
+                auto yEnd = yPos_[i]*(1.0 - alpha) + yPos_[i+1]*alpha;
+                if (yEnd > 0.) {
+                    shift = shift * y / yEnd;
+                } else {
+                    shift = 0.;
+                }
+            }
+        }
+        auto yLower =  y - alpha*shift;
+        auto yUpper =  y + (1-alpha)*shift;
+
+        if (hinted) {
+            j1 = ySegmentIndex(yLower, i, extrapolate, j1);
+            j2 = ySegmentIndex(yUpper, i + 1, extrapolate, j2);
+        }
+        else {
+            j1 = ySegmentIndex(yLower, i, extrapolate);
+            j2 = ySegmentIndex(yUpper, i + 1, extrapolate);
+        }
+        beta1 = yToBeta(yLower, i, j1);
+        beta2 = yToBeta(yUpper, i + 1, j2);
+    }
+
+    // Whether a position lies within the interior interval [pos(hint), pos(hint + 1)) of
+    // a sorted sequence of numPos positions.  The first and last intervals extend to
+    // infinity and are left to the regular search.
+    template <class Evaluation, class Position>
+    static bool hintedSegment_(size_t numPos, unsigned hint, const Evaluation& v,
+                               const Position& pos)
+    {
+        return numPos >= 4 && hint >= 1 && hint + 3 <= numPos
+            && pos(1) < v && v < pos(numPos - 2)
+            && pos(hint) <= v && v < pos(hint + 1);
+    }
+
     // the vector which contains the values of the sample points
     // f(x_i, y_j). don't use this directly, use getSamplePoint(i,j)
     // instead!
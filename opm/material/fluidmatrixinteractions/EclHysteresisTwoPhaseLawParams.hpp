@@ -32,10 +32,13 @@
 #include <opm/material/fluidmatrixinteractions/EclEpsScalingPoints.hpp>
 #include <opm/material/fluidmatrixinteractions/EclHysteresisConfig.hpp>
 
+#include <opm/utility/CopyablePtr.hpp>
+
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <cassert>
 #include <cmath>
 #include <memory>
+#include <utility>
 
 namespace Opm {
 /*!
@@ -117,15 +120,21 @@ public:
 
     /*!
      * \brief Set the hysteresis configuration object.
+     *
+     * The configuration is shared by all cells and is not copied. Until this
+     * method is called, a default configuration with hysteresis disabled is used.
      */
     void setConfig(std::shared_ptr<EclHysteresisConfig> value)
-    { config_ = *value; }
+    {
+        assert(value);
+        config_ = std::move(value);
+    }
 
     /*!
      * \brief Returns the hysteresis configuration object.
      */
     const EclHysteresisConfig& config() const
-    { return config_; }
+    { return *config_; }
 
     /*!
      * \brief Set the WAG-hysteresis configuration object.
@@ -222,12 +231,15 @@ public:
 
     /*!
      * \brief Sets the parameters used for the imbibition curve
+     *
+     * The imbibition parameters are only allocated once this method is called, so
+     * cells of runs without hysteresis do not pay for them.
      */
     void setImbibitionParams(const EffLawParams& value,
                              const EclEpsScalingPointsInfo<Scalar>& info,
                              EclTwoPhaseSystemType twoPhaseSystem)
     {
-        imbibitionParams_ = value;
+        imbibitionParams_ = std::make_unique<EffLawParams>(value);
 
         if (!config().enableHysteresis())
             return;
@@ -267,12 +279,27 @@ public:
 
     /*!
      * \brief Returns the parameters used for the imbibition curve
+     *
+     * If setImbibitionParams() has not been called, the imbibition curve is the
+     * drainage curve.
      */
     const EffLawParams& imbibitionParams() const
-    { return imbibitionParams_; }
+    { return imbibitionParams_ ? *imbibitionParams_.get() : drainageParams_; }
 
+    /*!
+     * \brief Returns the parameters used for the imbibition curve
+     *
+     * If setImbibitionParams() has not been called, the imbibition parameters are
+     * allocated as a copy of the drainage parameters, so modifying them does not
+     * affect the drainage curve.
+     */
     EffLawParams& imbibitionParams()
-    { return imbibitionParams_; }
+    {
+        if (!imbibitionParams_)
+            imbibitionParams_ = std::make_unique<EffLawParams>(drainageParams_);
+
+        return *imbibitionParams_.get();
+    }
 
     /*!
      * \brief Get the saturation of the wetting phase where the last switch from the main
@@ -706,9 +733,17 @@ private:
 
     }
 
-    EclHysteresisConfig config_;
+    // a single default configuration is shared by all parameter objects for
+    // which setConfig() has not been called
+    static const std::shared_ptr<EclHysteresisConfig>& defaultConfig_()
+    {
+        static const auto config = std::make_shared<EclHysteresisConfig>();
+        return config;
+    }
+
+    std::shared_ptr<EclHysteresisConfig> config_ = defaultConfig_();
     std::shared_ptr<WagHysteresisConfig::WagHysteresisConfigRecord> wagConfig_;
-    EffLawParams imbibitionParams_;
+    Utility::CopyablePtr<EffLawParams> imbibitionParams_;
     EffLawParams drainageParams_;
 
     // largest wettinging phase saturation which is on the main-drainage curve. These are
@@ -27,27 +27,13 @@
 #ifndef OPM_BLACK_OIL_FLUID_SYSTEM_HPP
 #define OPM_BLACK_OIL_FLUID_SYSTEM_HPP
 
-#include "BlackOilDefaultIndexTraits.hpp"
-#include "blackoilpvt/OilPvtMultiplexer.hpp"
-#include "blackoilpvt/GasPvtMultiplexer.hpp"
-#include "blackoilpvt/WaterPvtMultiplexer.hpp"
-#include "blackoilpvt/BrineCo2Pvt.hpp"
-#include "blackoilpvt/BrineH2Pvt.hpp"
-
-#include <opm/common/TimingMacros.hpp>
-
 #include <opm/material/fluidsystems/BaseFluidSystem.hpp>
-#include <opm/material/Constants.hpp>
-
-#include <opm/material/common/MathToolbox.hpp>
-#include <opm/material/common/Valgrind.hpp>
-#include <opm/material/common/HasMemberGeneratorMacros.hpp>
+#include <opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp>
 
 #include <array>
+#include <cassert>
 #include <cstddef>
 #include <memory>
-#include <stdexcept>
-#include <vector>
 
 namespace Opm {
 
@@ -56,173 +42,39 @@ class EclipseState;
 class Schedule;
 #endif
 
-namespace BlackOil {
-OPM_GENERATE_HAS_MEMBER(Rs, ) // Creates 'HasMember_Rs<T>'.
-OPM_GENERATE_HAS_MEMBER(Rv, ) // Creates 'HasMember_Rv<T>'.
-OPM_GENERATE_HAS_MEMBER(Rvw, ) // Creates 'HasMember_Rvw<T>'.
-OPM_GENERATE_HAS_MEMBER(Rsw, ) // Creates 'HasMember_Rsw<T>'.
-OPM_GENERATE_HAS_MEMBER(saltConcentration, )
-OPM_GENERATE_HAS_MEMBER(saltSaturation, )
-
-template <class FluidSystem, class FluidState, class LhsEval>
-LhsEval getRs_(typename std::enable_if<!HasMember_Rs<FluidState>::value, const FluidState&>::type fluidState,
-               unsigned regionIdx)
-{
-    const auto& XoG =
-        decay<LhsEval>(fluidState.massFraction(FluidSystem::oilPhaseIdx, FluidSystem::gasCompIdx));
-    return FluidSystem::convertXoGToRs(XoG, regionIdx);
-}
-
-template <class FluidSystem, class FluidState, class LhsEval>
-auto getRs_(typename std::enable_if<HasMember_Rs<FluidState>::value, const FluidState&>::type fluidState,
-            unsigned)
-    -> decltype(decay<LhsEval>(fluidState.Rs()))
-{ return decay<LhsEval>(fluidState.Rs()); }
-
-template <class FluidSystem, class FluidState, class LhsEval>
-LhsEval getRv_(typename std::enable_if<!HasMember_Rv<FluidState>::value, const FluidState&>::type fluidState,
-               unsigned regionIdx)
-{
-    const auto& XgO =
-        decay<LhsEval>(fluidState.massFraction(FluidSystem::gasPhaseIdx, FluidSystem::oilCompIdx));
-    return FluidSystem::convertXgOToRv(XgO, regionIdx);
-}
-
-template <class FluidSystem, class FluidState, class LhsEval>
-auto getRv_(typename std::enable_if<HasMember_Rv<FluidState>::value, const FluidState&>::type fluidState,
-            unsigned)
-    -> decltype(decay<LhsEval>(fluidState.Rv()))
-{ return decay<LhsEval>(fluidState.Rv()); }
-
-template <class FluidSystem, class FluidState, class LhsEval>
-LhsEval getRvw_(typename std::enable_if<!HasMember_Rvw<FluidState>::value, const FluidState&>::type fluidState,
-               unsigned regionIdx)
-{
-    const auto& XgW =
-        decay<LhsEval>(fluidState.massFraction(FluidSystem::gasPhaseIdx, FluidSystem::waterCompIdx));
-    return FluidSystem::convertXgWToRvw(XgW, regionIdx);
-}
-
-template <class FluidSystem, class FluidState, class LhsEval>
-auto getRvw_(typename std::enable_if<HasMember_Rvw<FluidState>::value, const FluidState&>::type fluidState,
-            unsigned)
-    -> decltype(decay<LhsEval>(fluidState.Rvw()))
-{ return decay<LhsEval>(fluidState.Rvw()); }
-
-template <class FluidSystem, class FluidState, class LhsEval>
-LhsEval getRsw_(typename std::enable_if<!HasMember_Rsw<FluidState>::value, const FluidState&>::type fluidState,
-               unsigned regionIdx)
-{
-    const auto& XwG =
-        decay<LhsEval>(fluidState.massFraction(FluidSystem::waterPhaseIdx, FluidSystem::gasCompIdx));
-    return FluidSystem::convertXwGToRsw(XwG, regionIdx);
-}
-
-template <class FluidSystem, class FluidState, class LhsEval>
-auto getRsw_(typename std::enable_if<HasMember_Rsw<FluidState>::value, const FluidState&>::type fluidState,
-            unsigned)
-    -> decltype(decay<LhsEval>(fluidState.Rsw()))
-{ return decay<LhsEval>(fluidState.Rsw()); }
-
-template <class FluidSystem, class FluidState, class LhsEval>
-LhsEval getSaltConcentration_(typename std::enable_if<!HasMember_saltConcentration<FluidState>::value,
-                              const FluidState&>::type,
-                              unsigned)
-{return 0.0;}
-
-template <class FluidSystem, class FluidState, class LhsEval>
-auto getSaltConcentration_(typename std::enable_if<HasMember_saltConcentration<FluidState>::value, const FluidState&>::type fluidState,
-            unsigned)
-    -> decltype(decay<LhsEval>(fluidState.saltConcentration()))
-{ return decay<LhsEval>(fluidState.saltConcentration()); }
-
-template <class FluidSystem, class FluidState, class LhsEval>
-LhsEval getSaltSaturation_(typename std::enable_if<!HasMember_saltSaturation<FluidState>::value,
-                              const FluidState&>::type,
-                              unsigned)
-{return 0.0;}
-
-template <class FluidSystem, class FluidState, class LhsEval>
-auto getSaltSaturation_(typename std::enable_if<HasMember_saltSaturation<FluidState>::value, const FluidState&>::type fluidState,
-            unsigned)
-    -> decltype(decay<LhsEval>(fluidState.saltSaturation()))
-{ return decay<LhsEval>(fluidState.saltSaturation()); }
-
-}
-
 /*!
  * \brief A fluid system which uses the black-oil model assumptions to calculate
  *        termodynamically meaningful quantities.
  *
+ * All methods are static and forward to a single, process wide instance of
+ * BlackOilFluidSystemNonStatic, see defaultInstance().
+ *
  * \tparam Scalar The type used for scalar floating point values
  */
 template <class Scalar, class IndexTraits = BlackOilDefaultIndexTraits>
 class BlackOilFluidSystem : public BaseFluidSystem<Scalar, BlackOilFluidSystem<Scalar, IndexTraits> >
 {
-    using ThisType = BlackOilFluidSystem;
-
 public:
-    using GasPvt = GasPvtMultiplexer<Scalar>;
-    using OilPvt = OilPvtMultiplexer<Scalar>;
-    using WaterPvt = WaterPvtMultiplexer<Scalar>;
+    using NonStatic = BlackOilFluidSystemNonStatic<Scalar, IndexTraits>;
+
+    using GasPvt = typename NonStatic::GasPvt;
+    using OilPvt = typename NonStatic::OilPvt;
+    using WaterPvt = typename NonStatic::WaterPvt;
 
     //! \copydoc BaseFluidSystem::ParameterCache
     template <class EvaluationT>
-    struct ParameterCache : public NullParameterCache<EvaluationT>
-    {
-        using Evaluation = EvaluationT;
-
-    public:
-        ParameterCache(Scalar maxOilSat = 1.0, unsigned regionIdx=0)
-        {
-            maxOilSat_ = maxOilSat;
-            regionIdx_ = regionIdx;
-        }
-
-        /*!
-         * \brief Copy the data which is not dependent on the type of the Scalars from
-         *        another parameter cache.
-         *
-         * For the black-oil parameter cache this means that the region index must be
-         * copied.
-         */
-        template <class OtherCache>
-        void assignPersistentData(const OtherCache& other)
-        {
-            regionIdx_ = other.regionIndex();
-            maxOilSat_ = other.maxOilSat();
-        }
-
-        /*!
-         * \brief Return the index of the region which should be used to determine the
-         *        thermodynamic properties
-         *
-         * This is only required because "oil" and "gas" are pseudo-components, i.e. for
-         * more comprehensive equations of state there would only be one "region".
-         */
-        unsigned regionIndex() const
-        { return regionIdx_; }
-
-        /*!
-         * \brief Set the index of the region which should be used to determine the
-         *        thermodynamic properties
-         *
-         * This is only required because "oil" and "gas" are pseudo-components, i.e. for
-         * more comprehensive equations of state there would only be one "region".
-         */
-        void setRegionIndex(unsigned val)
-        { regionIdx_ = val; }
-
-        const Evaluation& maxOilSat() const
-        { return maxOilSat_; }
-
-        void setMaxOilSat(const Evaluation& val)
-        { maxOilSat_ = val; }
-
-    private:
-        Evaluation maxOilSat_;
-        unsigned regionIdx_;
-    };
+    using ParameterCache = typename NonStatic::template ParameterCache<EvaluationT>;
+
+    /*!
+     * \brief Return the fluid system object to which all static methods forward.
+     *
+     * The object may be copied to obtain a fluid system whose state is
+     * independent of the static one. The static data members surfacePressure and
+     * surfaceTemperature are refreshed from it by initFromState(), initBegin() and
+     * initEnd().
+     */
+    static NonStatic& defaultInstance()
+    { return instance(); }
 
     /****************************************
      * Initialization
@@ -231,7 +83,11 @@ public:
     /*!
      * \brief Initialize the fluid system using an ECL deck object
      */
-    static void initFromState(const EclipseState& eclState, const Schedule& schedule);
+    static void initFromState(const EclipseState& eclState, const Schedule& schedule)
+    {
+        instance().initFromState(eclState, schedule);
+        syncStatics_();
+    }
 #endif // HAVE_ECL_INPUT
 
     /*!
@@ -242,7 +98,11 @@ public:
      * compressibility must be set. Before the fluid system can be used, initEnd() must
      * be called to finalize the initialization.
      */
-    static void initBegin(std::size_t numPvtRegions);
+    static void initBegin(std::size_t numPvtRegions)
+    {
+        instance().initBegin(numPvtRegions);
+        syncStatics_();
+    }
 
     /*!
      * \brief Specify whether the fluid system should consider that the gas component can
@@ -251,7 +111,7 @@ public:
      * By default, dissolved gas is considered.
      */
     static void setEnableDissolvedGas(bool yesno)
-    { enableDissolvedGas_ = yesno; }
+    { instance().setEnableDissolvedGas(yesno); }
 
     /*!
      * \brief Specify whether the fluid system should consider that the oil component can
@@ -260,7 +120,7 @@ public:
      * By default, vaporized oil is not considered.
      */
     static void setEnableVaporizedOil(bool yesno)
-    { enableVaporizedOil_ = yesno; }
+    { instance().setEnableVaporizedOil(yesno); }
 
      /*!
      * \brief Specify whether the fluid system should consider that the water component can
@@ -269,7 +129,7 @@ public:
      * By default, vaporized water is not considered.
      */
     static void setEnableVaporizedWater(bool yesno)
-    { enableVaporizedWater_ = yesno; }
+    { instance().setEnableVaporizedWater(yesno); }
 
      /*!
      * \brief Specify whether the fluid system should consider that the gas component can
@@ -278,46 +138,36 @@ public:
      * By default, dissovled gas in water is not considered.
      */
     static void setEnableDissolvedGasInWater(bool yesno)
-    { enableDissolvedGasInWater_ = yesno; }
+    { instance().setEnableDissolvedGasInWater(yesno); }
     /*!
      * \brief Specify whether the fluid system should consider diffusion
      *
      * By default, diffusion is not considered.
      */
     static void setEnableDiffusion(bool yesno)
-    { enableDiffusion_ = yesno; }
+    { instance().setEnableDiffusion(yesno); }
 
 
     /*!
      * \brief Set the pressure-volume-saturation (PVT) relations for the gas phase.
      */
     static void setGasPvt(std::shared_ptr<GasPvt> pvtObj)
-    { gasPvt_ = pvtObj; }
+    { instance().setGasPvt(pvtObj); }
 
     /*!
      * \brief Set the pressure-volume-saturation (PVT) relations for the oil phase.
      */
     static void setOilPvt(std::shared_ptr<OilPvt> pvtObj)
-    { oilPvt_ = pvtObj; }
+    { instance().setOilPvt(pvtObj); }
 
     /*!
      * \brief Set the pressure-volume-saturation (PVT) relations for the water phase.
      */
     static void setWaterPvt(std::shared_ptr<WaterPvt> pvtObj)
-    { waterPvt_ = pvtObj; }
+    { instance().setWaterPvt(pvtObj); }
 
     static void setVapPars(const Scalar par1, const Scalar par2)
-    {
-        if (gasPvt_) {
-            gasPvt_->setVapPars(par1, par2);
-        }
-        if (oilPvt_) {
-            oilPvt_->setVapPars(par1, par2);
-        }
-        if (waterPvt_) {
-            waterPvt_->setVapPars(par1, par2);
-        }
-    }
+    { instance().setVapPars(par1, par2); }
 
     /*!
      * \brief Initialize the values of the reference densities
@@ -329,15 +179,24 @@ public:
     static void setReferenceDensities(Scalar rhoOil,
                                       Scalar rhoWater,
                                       Scalar rhoGas,
-                                      unsigned regionIdx);
+                                      unsigned regionIdx)
+    { instance().setReferenceDensities(rhoOil, rhoWater, rhoGas, regionIdx); }
 
     /*!
      * \brief Finish initializing the black oil fluid system.
      */
-    static void initEnd();
+    static void initEnd()
+    {
+        // the surface conditions may have been assigned directly
+        instance().surfacePressure = surfacePressure;
+        instance().surfaceTemperature = surfaceTemperature;
+
+        instance().initEnd();
+        syncStatics_();
+    }
 
     static bool isInitialized()
-    { return isInitialized_; }
+    { return instance().isInitialized(); }
 
     /****************************************
      * Generic phase properties
@@ -360,7 +219,8 @@ public:
     static Scalar surfaceTemperature;
 
     //! \copydoc BaseFluidSystem::phaseName
-    static const char* phaseName(unsigned phaseIdx);
+    static const char* phaseName(unsigned phaseIdx)
+    { return NonStatic::phaseName(phaseIdx); }
 
     //! \copydoc BaseFluidSystem::isLiquid
     static bool isLiquid(unsigned phaseIdx)
@@ -390,27 +250,27 @@ protected:
 public:
     //! \brief Returns the number of active fluid phases (i.e., usually three)
     static unsigned numActivePhases()
-    { return numActivePhases_; }
+    { return instance().numActivePhases(); }
 
     //! \brief Returns whether a fluid phase is active
     static unsigned phaseIsActive(unsigned phaseIdx)
-    {
-        assert(phaseIdx < numPhases);
-        return phaseIsActive_[phaseIdx];
-    }
+    { return instance().phaseIsActive(phaseIdx); }
 
     //! \brief returns the index of "primary" component of a phase (solvent)
-    static unsigned solventComponentIndex(unsigned phaseIdx);
+    static unsigned solventComponentIndex(unsigned phaseIdx)
+    { return NonStatic::solventComponentIndex(phaseIdx); }
 
     //! \brief returns the index of "secondary" component of a phase (solute)
-    static unsigned soluteComponentIndex(unsigned phaseIdx);
+    static unsigned soluteComponentIndex(unsigned phaseIdx)
+    { return instance().soluteComponentIndex(phaseIdx); }
 
     //! \copydoc BaseFluidSystem::componentName
-    static const char* componentName(unsigned compIdx);
+    static const char* componentName(unsigned compIdx)
+    { return NonStatic::componentName(compIdx); }
 
     //! \copydoc BaseFluidSystem::molarMass
     static Scalar molarMass(unsigned compIdx, unsigned regionIdx = 0)
-    { return molarMass_[regionIdx][compIdx]; }
+    { return instance().molarMass(compIdx, regionIdx); }
 
     //! \copydoc BaseFluidSystem::isIdealMixture
     static bool isIdealMixture(unsigned /*phaseIdx*/)
@@ -438,7 +298,7 @@ public:
      * By default, this is 1.
      */
     static std::size_t numRegions()
-    { return molarMass_.size(); }
+    { return instance().numRegions(); }
 
     /*!
      * \brief Returns whether the fluid system should consider that the gas component can
@@ -447,7 +307,7 @@ public:
      * By default, dissolved gas is considered.
      */
     static bool enableDissolvedGas()
-    { return enableDissolvedGas_; }
+    { return instance().enableDissolvedGas(); }
 
 
     /*!
@@ -457,7 +317,7 @@ public:
      * By default, dissolved gas is considered.
      */
     static bool enableDissolvedGasInWater()
-    { return enableDissolvedGasInWater_; }
+    { return instance().enableDissolvedGasInWater(); }
 
     /*!
      * \brief Returns whether the fluid system should consider that the oil component can
@@ -466,7 +326,7 @@ public:
      * By default, vaporized oil is not considered.
      */
     static bool enableVaporizedOil()
-    { return enableVaporizedOil_; }
+    { return instance().enableVaporizedOil(); }
 
     /*!
      * \brief Returns whether the fluid system should consider that the water component can
@@ -475,7 +335,7 @@ public:
      * By default, vaporized water is not considered.
      */
     static bool enableVaporizedWater()
-    { return enableVaporizedWater_; }
+    { return instance().enableVaporizedWater(); }
 
     /*!
      * \brief Returns whether the fluid system should consider diffusion
@@ -483,7 +343,7 @@ public:
      * By default, diffusion is not considered.
      */
     static bool enableDiffusion()
-    { return enableDiffusion_; }
+    { return instance().enableDiffusion(); }
 
     /*!
      * \brief Returns the density of a fluid phase at surface pressure [kg/m^3]
@@ -491,7 +351,7 @@ public:
      * \copydoc Doxygen::phaseIdxParam
      */
     static Scalar referenceDensity(unsigned phaseIdx, unsigned regionIdx)
-    { return referenceDensity_[regionIdx][phaseIdx]; }
+    { return instance().referenceDensity(phaseIdx, regionIdx); }
 
     /****************************************
      * thermodynamic quantities (generic version)
@@ -501,7 +361,7 @@ public:
     static LhsEval density(const FluidState& fluidState,
                            const ParameterCache<ParamCacheEval>& paramCache,
                            unsigned phaseIdx)
-    { return density<FluidState, LhsEval>(fluidState, phaseIdx, paramCache.regionIndex()); }
+    { return instance().template density<FluidState, LhsEval, ParamCacheEval>(fluidState, paramCache, phaseIdx); }
 
     //! \copydoc BaseFluidSystem::fugacityCoefficient
     template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
@@ -509,26 +369,21 @@ public:
                                        const ParameterCache<ParamCacheEval>& paramCache,
                                        unsigned phaseIdx,
                                        unsigned compIdx)
-    {
-        return fugacityCoefficient<FluidState, LhsEval>(fluidState,
-                                                        phaseIdx,
-                                                        compIdx,
-                                                        paramCache.regionIndex());
-    }
+    { return instance().template fugacityCoefficient<FluidState, LhsEval, ParamCacheEval>(fluidState, paramCache, phaseIdx, compIdx); }
 
     //! \copydoc BaseFluidSystem::viscosity
     template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
     static LhsEval viscosity(const FluidState& fluidState,
                              const ParameterCache<ParamCacheEval>& paramCache,
                              unsigned phaseIdx)
-    { return viscosity<FluidState, LhsEval>(fluidState, phaseIdx, paramCache.regionIndex()); }
+    { return instance().template viscosity<FluidState, LhsEval, ParamCacheEval>(fluidState, paramCache, phaseIdx); }
 
     //! \copydoc BaseFluidSystem::enthalpy
     template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
     static LhsEval enthalpy(const FluidState& fluidState,
                             const ParameterCache<ParamCacheEval>& paramCache,
                             unsigned phaseIdx)
-    { return enthalpy<FluidState, LhsEval>(fluidState, phaseIdx, paramCache.regionIndex()); }
+    { return instance().template enthalpy<FluidState, LhsEval, ParamCacheEval>(fluidState, paramCache, phaseIdx); }
 
     /****************************************
      * thermodynamic quantities (black-oil specific version: Note that the PVT region
@@ -539,90 +394,7 @@ public:
     static LhsEval density(const FluidState& fluidState,
                            unsigned phaseIdx,
                            unsigned regionIdx)
-    {
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const LhsEval& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const LhsEval& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-        const LhsEval& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: {
-            if (enableDissolvedGas()) {
-                // miscible oil
-                const LhsEval& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
-
-                return
-                    bo*referenceDensity(oilPhaseIdx, regionIdx)
-                    + Rs*bo*referenceDensity(gasPhaseIdx, regionIdx);
-            }
-
-            // immiscible oil
-            const LhsEval Rs(0.0);
-            const auto& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
-
-            return referenceDensity(phaseIdx, regionIdx)*bo;
-        }
-
-        case gasPhaseIdx: {
-             if (enableVaporizedOil() && enableVaporizedWater()) {
-                // gas containing vaporized oil and vaporized water
-                const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-
-                return
-                    bg*referenceDensity(gasPhaseIdx, regionIdx)
-                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx)
-                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx);
-            }
-            if (enableVaporizedOil()) {
-                // miscible gas
-                const LhsEval Rvw(0.0);
-                const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-
-                return
-                    bg*referenceDensity(gasPhaseIdx, regionIdx)
-                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx);
-            }
-            if (enableVaporizedWater()) {
-                // gas containing vaporized water
-                const LhsEval Rv(0.0);
-                const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-
-                return
-                    bg*referenceDensity(gasPhaseIdx, regionIdx)
-                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx);
-            }
-
-            // immiscible gas
-            const LhsEval Rv(0.0);
-            const LhsEval Rvw(0.0);
-            const auto& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-            return bg*referenceDensity(phaseIdx, regionIdx);
-        }
-
-        case waterPhaseIdx:
-            if (enableDissolvedGasInWater()) {
-                 // gas miscible in water
-                const LhsEval& Rsw = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
-                const LhsEval& bw = waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
-                return
-                    bw*referenceDensity(waterPhaseIdx, regionIdx)
-                    + Rsw*bw*referenceDensity(gasPhaseIdx, regionIdx);
-            }
-            const LhsEval Rsw(0.0);
-            return
-                referenceDensity(waterPhaseIdx, regionIdx)
-                * waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
-        }
-
-        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-    }
+    { return instance().template density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     /*!
      * \brief Compute the density of a saturated fluid phase.
@@ -637,94 +409,7 @@ public:
     static LhsEval saturatedDensity(const FluidState& fluidState,
                                     unsigned phaseIdx,
                                     unsigned regionIdx)
-    {
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = fluidState.pressure(phaseIdx);
-        const auto& T = fluidState.temperature(phaseIdx);
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: {
-            if (enableDissolvedGas()) {
-                // miscible oil
-                const LhsEval& Rs = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, oilPhaseIdx, regionIdx);
-                const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
-
-                return
-                    bo*referenceDensity(oilPhaseIdx, regionIdx)
-                    + Rs*bo*referenceDensity(gasPhaseIdx, regionIdx);
-            }
-
-            // immiscible oil
-            const LhsEval Rs(0.0);
-            const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
-            return referenceDensity(phaseIdx, regionIdx)*bo;
-        }
-
-        case gasPhaseIdx: {
-            if (enableVaporizedOil() && enableVaporizedWater()) {
-                // gas containing vaporized oil and vaporized water
-                const LhsEval& Rv = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
-                const LhsEval& Rvw = saturatedVaporizationFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-
-                return
-                    bg*referenceDensity(gasPhaseIdx, regionIdx)
-                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx) 
-                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx) ;
-            }
-
-            if (enableVaporizedOil()) {
-                // miscible gas
-                const LhsEval Rvw(0.0);
-                const LhsEval& Rv = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-
-                return
-                    bg*referenceDensity(gasPhaseIdx, regionIdx)
-                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx);
-            }
-
-            if (enableVaporizedWater()) {
-                // gas containing vaporized water
-                const LhsEval Rv(0.0);
-                const LhsEval& Rvw = saturatedVaporizationFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
-                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-
-                return
-                    bg*referenceDensity(gasPhaseIdx, regionIdx)
-                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx);
-            }
-
-            // immiscible gas
-            const LhsEval Rv(0.0);
-            const LhsEval Rvw(0.0);
-            const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-
-            return referenceDensity(phaseIdx, regionIdx)*bg;
-
-        }
-
-        case waterPhaseIdx:
-        {
-            if (enableDissolvedGasInWater()) {
-                 // miscible in water
-                const auto& saltConcentration = decay<LhsEval>(fluidState.saltConcentration());
-                const LhsEval& Rsw = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
-                const LhsEval& bw = waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
-                return
-                    bw*referenceDensity(waterPhaseIdx, regionIdx)
-                    + Rsw*bw*referenceDensity(gasPhaseIdx, regionIdx);
-            }
-            return
-                referenceDensity(waterPhaseIdx, regionIdx)
-                *inverseFormationVolumeFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
-        }
-        }
-
-        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-    }
+    { return instance().template saturatedDensity<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     /*!
      * \brief Returns the formation volume factor \f$B_\alpha\f$ of an "undersaturated"
@@ -738,92 +423,7 @@ public:
     static LhsEval inverseFormationVolumeFactor(const FluidState& fluidState,
                                                 unsigned phaseIdx,
                                                 unsigned regionIdx)
-    {
-        OPM_TIMEBLOCK_LOCAL(inverseFormationVolumeFactor);
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: {
-            if (enableDissolvedGas()) {
-                const auto& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rs >= (1.0 - 1e-10)*oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                {
-                    return oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-                } else {
-                    return oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
-                }
-            }
-
-            const LhsEval Rs(0.0);
-            return oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
-        }
-        case gasPhaseIdx: {
-            if (enableVaporizedOil() && enableVaporizedWater()) {
-                 const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                 const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                 if (fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
-                    && fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                 { 
-                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-                 } else {
-                     return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-                 }
-            }
-
-            if (enableVaporizedOil()) {
-                const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                {
-                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-                } else {
-                    const LhsEval Rvw(0.0);
-                    return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-                }
-            }
-
-            if (enableVaporizedWater()) { 
-                const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                {
-                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-                } else {
-                    const LhsEval Rv(0.0);
-                    return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-                }
-            }
-            
-            const LhsEval Rv(0.0);
-            const LhsEval Rvw(0.0);
-            return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
-        }
-        case waterPhaseIdx:
-        {
-            const auto& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-            if (enableDissolvedGasInWater()) {
-                const auto& Rsw = BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rsw >= (1.0 - 1e-10)*waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
-                {
-                    return waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
-                } else {
-                    return waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
-                }
-            }
-            const LhsEval Rsw(0.0);
-            return waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
-        }
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-    }
+    { return instance().template inverseFormationVolumeFactor<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     /*!
      * \brief Returns the formation volume factor \f$B_\alpha\f$ of a "saturated" fluid
@@ -838,22 +438,7 @@ public:
     static LhsEval saturatedInverseFormationVolumeFactor(const FluidState& fluidState,
                                                          unsigned phaseIdx,
                                                          unsigned regionIdx)
-    {
-        OPM_TIMEBLOCK_LOCAL(saturatedInverseFormationVolumeFactor);
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-        const auto& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-        case gasPhaseIdx: return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
-        case waterPhaseIdx: return waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-    }
+    { return instance().template saturatedInverseFormationVolumeFactor<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     //! \copydoc BaseFluidSystem::fugacityCoefficient
     template <class FluidState, class LhsEval = typename FluidState::Scalar>
@@ -861,252 +446,21 @@ public:
                                        unsigned phaseIdx,
                                        unsigned compIdx,
                                        unsigned regionIdx)
-    {
-        assert(phaseIdx <= numPhases);
-        assert(compIdx <= numComponents);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-
-        // for the fugacity coefficient of the oil component in the oil phase, we use
-        // some pseudo-realistic value for the vapor pressure to ease physical
-        // interpretation of the results
-        const LhsEval phi_oO = 20e3/p;
-
-        // for the gas component in the gas phase, assume it to be an ideal gas
-        constexpr const Scalar phi_gG = 1.0;
-
-        // for the fugacity coefficient of the water component in the water phase, we use
-        // the same approach as for the oil component in the oil phase
-        const LhsEval phi_wW = 30e3/p;
-
-        switch (phaseIdx) {
-        case gasPhaseIdx: // fugacity coefficients for all components in the gas phase
-            switch (compIdx) {
-            case gasCompIdx:
-                return phi_gG;
-
-            // for the oil component, we calculate the Rv value for saturated gas and Rs
-            // for saturated oil, and compute the fugacity coefficients at the
-            // equilibrium. for this, we assume that in equilibrium the fugacities of the
-            // oil component is the same in both phases.
-            case oilCompIdx: {
-                if (!enableVaporizedOil())
-                    // if there's no vaporized oil, the gas phase is assumed to be
-                    // immiscible with the oil component
-                    return phi_gG*1e6;
-
-                const auto& R_vSat = gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
-                const auto& X_gOSat = convertRvToXgO(R_vSat, regionIdx);
-                const auto& x_gOSat = convertXgOToxgO(X_gOSat, regionIdx);
-
-                const auto& R_sSat = oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
-                const auto& X_oGSat = convertRsToXoG(R_sSat, regionIdx);
-                const auto& x_oGSat = convertXoGToxoG(X_oGSat, regionIdx);
-                const auto& x_oOSat = 1.0 - x_oGSat;
-
-                const auto& p_o = decay<LhsEval>(fluidState.pressure(oilPhaseIdx));
-                const auto& p_g = decay<LhsEval>(fluidState.pressure(gasPhaseIdx));
-
-                return phi_oO*p_o*x_oOSat / (p_g*x_gOSat);
-            }
-
-            case waterCompIdx:
-                // the water component is assumed to be never miscible with the gas phase
-                return phi_gG*1e6;
-
-            default:
-                throw std::logic_error("Invalid component index "+std::to_string(compIdx));
-            }
-
-        case oilPhaseIdx: // fugacity coefficients for all components in the oil phase
-            switch (compIdx) {
-            case oilCompIdx:
-                return phi_oO;
-
-            // for the oil and water components, we proceed analogous to the gas and
-            // water components in the gas phase
-            case gasCompIdx: {
-                if (!enableDissolvedGas())
-                    // if there's no dissolved gas, the oil phase is assumed to be
-                    // immiscible with the gas component
-                    return phi_oO*1e6;
-
-                const auto& R_vSat = gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
-                const auto& X_gOSat = convertRvToXgO(R_vSat, regionIdx);
-                const auto& x_gOSat = convertXgOToxgO(X_gOSat, regionIdx);
-                const auto& x_gGSat = 1.0 - x_gOSat;
-
-                const auto& R_sSat = oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
-                const auto& X_oGSat = convertRsToXoG(R_sSat, regionIdx);
-                const auto& x_oGSat = convertXoGToxoG(X_oGSat, regionIdx);
-
-                const auto& p_o = decay<LhsEval>(fluidState.pressure(oilPhaseIdx));
-                const auto& p_g = decay<LhsEval>(fluidState.pressure(gasPhaseIdx));
-
-                return phi_gG*p_g*x_gGSat / (p_o*x_oGSat);
-            }
-
-            case waterCompIdx:
-                return phi_oO*1e6;
-
-            default:
-                throw std::logic_error("Invalid component index "+std::to_string(compIdx));
-            }
-
-        case waterPhaseIdx: // fugacity coefficients for all components in the water phase
-            // the water phase fugacity coefficients are pretty simple: because the water
-            // phase is assumed to consist entirely from the water component, we just
-            // need to make sure that the fugacity coefficients for the other components
-            // are a few orders of magnitude larger than the one of the water
-            // component. (i.e., the affinity of the gas and oil components to the water
-            // phase is lower by a few orders of magnitude)
-            switch (compIdx) {
-            case waterCompIdx: return phi_wW;
-            case oilCompIdx: return 1.1e6*phi_wW;
-            case gasCompIdx: return 1e6*phi_wW;
-            default:
-                throw std::logic_error("Invalid component index "+std::to_string(compIdx));
-            }
-
-        default:
-            throw std::logic_error("Invalid phase index "+std::to_string(phaseIdx));
-        }
-
-        throw std::logic_error("Unhandled phase or component index");
-    }
+    { return instance().template fugacityCoefficient<FluidState, LhsEval>(fluidState, phaseIdx, compIdx, regionIdx); }
 
     //! \copydoc BaseFluidSystem::viscosity
     template <class FluidState, class LhsEval = typename FluidState::Scalar>
     static LhsEval viscosity(const FluidState& fluidState,
                              unsigned phaseIdx,
                              unsigned regionIdx)
-    {
-        OPM_TIMEBLOCK_LOCAL(viscosity);
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const LhsEval& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const LhsEval& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: {
-            if (enableDissolvedGas()) {
-                const auto& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rs >= (1.0 - 1e-10)*oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                {
-                    return oilPvt_->saturatedViscosity(regionIdx, T, p);
-                } else {
-                    return oilPvt_->viscosity(regionIdx, T, p, Rs);
-                }
-            }
-
-            const LhsEval Rs(0.0);
-            return oilPvt_->viscosity(regionIdx, T, p, Rs);
-        }
-
-        case gasPhaseIdx: {
-             if (enableVaporizedOil() && enableVaporizedWater()) {
-                 const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                 const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                 if (fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
-                    && fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                 { 
-                     return gasPvt_->saturatedViscosity(regionIdx, T, p);
-                 } else {
-                     return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
-                 }
-            }
-            if (enableVaporizedOil()) {
-                const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(oilPhaseIdx) > 0.0
-                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                {
-                    return gasPvt_->saturatedViscosity(regionIdx, T, p);
-                } else {
-                    const LhsEval Rvw(0.0);
-                    return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
-                }
-            }
-            if (enableVaporizedWater()) {
-                const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(waterPhaseIdx) > 0.0
-                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
-                {
-                    return gasPvt_->saturatedViscosity(regionIdx, T, p); 
-                } else {
-                    const LhsEval Rv(0.0);
-                    return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
-                }
-            }
-
-            const LhsEval Rv(0.0);
-            const LhsEval Rvw(0.0);
-            return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
-        }
-
-        case waterPhaseIdx:
-        {
-            const LhsEval& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-            if (enableDissolvedGasInWater()) {
-                const auto& Rsw = BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
-                if (fluidState.saturation(gasPhaseIdx) > 0.0
-                    && Rsw >= (1.0 - 1e-10)*waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
-                {
-                    return waterPvt_->saturatedViscosity(regionIdx, T, p, saltConcentration);
-                } else {
-                    return waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
-                }
-            }
-            const LhsEval Rsw(0.0);
-            return waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
-        }
-        }
-
-        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-    }
+    { return instance().template viscosity<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     //! \copydoc BaseFluidSystem::enthalpy
     template <class FluidState, class LhsEval = typename FluidState::Scalar>
     static LhsEval enthalpy(const FluidState& fluidState,
                             unsigned phaseIdx,
                             unsigned regionIdx)
-    {
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-
-        switch (phaseIdx) {
-        case oilPhaseIdx:
-            return
-                oilPvt_->internalEnergy(regionIdx, T, p, BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx))
-                + p/density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
-
-        case gasPhaseIdx:
-            return
-                 gasPvt_->internalEnergy(regionIdx, T, p,
-                 BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
-                  BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx))
-                  + p/density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
-
-        case waterPhaseIdx:
-            return
-                waterPvt_->internalEnergy(regionIdx, T, p,
-                                          BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
-                                          BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx))
-                + p/density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
-
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-
-        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-    }
+    { return instance().template enthalpy<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     /*!
      * \brief Returns the water vaporization factor \f$R_\alpha\f$ of saturated phase
@@ -1118,21 +472,7 @@ public:
     static LhsEval saturatedVaporizationFactor(const FluidState& fluidState,
                                               unsigned phaseIdx,
                                               unsigned regionIdx)
-    {
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-        const auto& saltConcentration = decay<LhsEval>(fluidState.saltConcentration());
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: return 0.0;
-        case gasPhaseIdx: return gasPvt_->saturatedWaterVaporizationFactor(regionIdx, T, p, saltConcentration);
-        case waterPhaseIdx: return 0.0;
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-    }
+    { return instance().template saturatedVaporizationFactor<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     /*!
      * \brief Returns the dissolution factor \f$R_\alpha\f$ of a saturated fluid phase
@@ -1145,23 +485,7 @@ public:
                                               unsigned phaseIdx,
                                               unsigned regionIdx,
                                               const LhsEval& maxOilSaturation)
-    {
-        OPM_TIMEBLOCK_LOCAL(saturatedDissolutionFactor);
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-        const auto& So = decay<LhsEval>(fluidState.saturation(oilPhaseIdx));
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p, So, maxOilSaturation);
-        case gasPhaseIdx: return gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p, So, maxOilSaturation);
-        case waterPhaseIdx: return waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
-        BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-    }
+    { return instance().template saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx, maxOilSaturation); }
 
     /*!
      * \brief Returns the dissolution factor \f$R_\alpha\f$ of a saturated fluid phase
@@ -1175,22 +499,7 @@ public:
     static LhsEval saturatedDissolutionFactor(const FluidState& fluidState,
                                               unsigned phaseIdx,
                                               unsigned regionIdx)
-    {
-        OPM_TIMEBLOCK_LOCAL(saturatedDissolutionFactor);
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
-        case gasPhaseIdx: return gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
-        case waterPhaseIdx: return waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
-        BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-    }
+    { return instance().template saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     /*!
      * \brief Returns the bubble point pressure $P_b$ using the current Rs
@@ -1198,9 +507,7 @@ public:
     template <class FluidState, class LhsEval = typename FluidState::Scalar>
     static LhsEval bubblePointPressure(const FluidState& fluidState,
                                        unsigned regionIdx)
-    {
-        return saturationPressure(fluidState, oilPhaseIdx, regionIdx);
-    }
+    { return instance().template bubblePointPressure<FluidState, LhsEval>(fluidState, regionIdx); }
 
 
     /*!
@@ -1209,9 +516,7 @@ public:
     template <class FluidState, class LhsEval = typename FluidState::Scalar>
     static LhsEval dewPointPressure(const FluidState& fluidState,
                                        unsigned regionIdx)
-    {
-        return saturationPressure(fluidState, gasPhaseIdx, regionIdx);
-    }
+    { return instance().template dewPointPressure<FluidState, LhsEval>(fluidState, regionIdx); }
 
     /*!
      * \brief Returns the saturation pressure of a given phase [Pa] depending on its
@@ -1227,21 +532,7 @@ public:
     static LhsEval saturationPressure(const FluidState& fluidState,
                                       unsigned phaseIdx,
                                       unsigned regionIdx)
-    {
-        assert(phaseIdx <= numPhases);
-        assert(regionIdx <= numRegions());
-
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt_->saturationPressure(regionIdx, T, BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-        case gasPhaseIdx: return gasPvt_->saturationPressure(regionIdx, T, BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-        case waterPhaseIdx: return waterPvt_->saturationPressure(regionIdx, T,
-        BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
-        BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-    }
+    { return instance().template saturationPressure<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx); }
 
     /****************************************
      * Auxiliary and convenience methods for the black-oil model
@@ -1252,12 +543,7 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertXoGToRs(const LhsEval& XoG, unsigned regionIdx)
-    {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        return XoG/(1.0 - XoG)*(rho_oRef/rho_gRef);
-    }
+    { return instance().template convertXoGToRs<LhsEval>(XoG, regionIdx); }
 
     /*!
      * \brief Convert the mass fraction of the gas component in the water phase to the
@@ -1265,12 +551,7 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertXwGToRsw(const LhsEval& XwG, unsigned regionIdx)
-    {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        return XwG/(1.0 - XwG)*(rho_wRef/rho_gRef);
-    }
+    { return instance().template convertXwGToRsw<LhsEval>(XwG, regionIdx); }
 
     /*!
      * \brief Convert the mass fraction of the oil component in the gas phase to the
@@ -1278,12 +559,7 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertXgOToRv(const LhsEval& XgO, unsigned regionIdx)
-    {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        return XgO/(1.0 - XgO)*(rho_gRef/rho_oRef);
-    }
+    { return instance().template convertXgOToRv<LhsEval>(XgO, regionIdx); }
 
     /*!
      * \brief Convert the mass fraction of the water component in the gas phase to the
@@ -1291,12 +567,7 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertXgWToRvw(const LhsEval& XgW, unsigned regionIdx)
-    {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        return XgW/(1.0 - XgW)*(rho_gRef/rho_wRef);
-    }
+    { return instance().template convertXgWToRvw<LhsEval>(XgW, regionIdx); }
 
 
     /*!
@@ -1305,13 +576,7 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertRsToXoG(const LhsEval& Rs, unsigned regionIdx)
-    {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        const LhsEval& rho_oG = Rs*rho_gRef;
-        return rho_oG/(rho_oRef + rho_oG);
-    }
+    { return instance().template convertRsToXoG<LhsEval>(Rs, regionIdx); }
 
     /*!
      * \brief Convert a gas dissolution factor to the the corresponding mass fraction
@@ -1319,13 +584,7 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertRswToXwG(const LhsEval& Rsw, unsigned regionIdx)
-    {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        const LhsEval& rho_wG = Rsw*rho_gRef;
-        return rho_wG/(rho_wRef + rho_wG);
-    }
+    { return instance().template convertRswToXwG<LhsEval>(Rsw, regionIdx); }
 
     /*!
      * \brief Convert an oil vaporization factor to the corresponding mass fraction
@@ -1333,13 +592,7 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertRvToXgO(const LhsEval& Rv, unsigned regionIdx)
-    {
-        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        const LhsEval& rho_gO = Rv*rho_oRef;
-        return rho_gO/(rho_gRef + rho_gO);
-    }
+    { return instance().template convertRvToXgO<LhsEval>(Rv, regionIdx); }
 
     /*!
      * \brief Convert an water vaporization factor to the corresponding mass fraction
@@ -1347,85 +600,49 @@ public:
      */
     template <class LhsEval>
     static LhsEval convertRvwToXgW(const LhsEval& Rvw, unsigned regionIdx)
-    {
-        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
-        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
-
-        const LhsEval& rho_gW = Rvw*rho_wRef;
-        return rho_gW/(rho_gRef + rho_gW);
-    }
+    { return instance().template convertRvwToXgW<LhsEval>(Rvw, regionIdx); }
 
     /*!
      * \brief Convert a water mass fraction in the gas phase the corresponding mole fraction.
      */
     template <class LhsEval>
     static LhsEval convertXgWToxgW(const LhsEval& XgW, unsigned regionIdx)
-    {
-        Scalar MW = molarMass_[regionIdx][waterCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
-
-        return XgW*MG / (MW*(1 - XgW) + XgW*MG);
-    }
+    { return instance().template convertXgWToxgW<LhsEval>(XgW, regionIdx); }
 
     /*!
      * \brief Convert a gas mass fraction in the water phase the corresponding mole fraction.
      */
     template <class LhsEval>
     static LhsEval convertXwGToxwG(const LhsEval& XwG, unsigned regionIdx)
-    {
-        Scalar MW = molarMass_[regionIdx][waterCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
-
-        return XwG*MW / (MG*(1 - XwG) + XwG*MW);
-    }
+    { return instance().template convertXwGToxwG<LhsEval>(XwG, regionIdx); }
 
     /*!
      * \brief Convert a gas mass fraction in the oil phase the corresponding mole fraction.
      */
     template <class LhsEval>
     static LhsEval convertXoGToxoG(const LhsEval& XoG, unsigned regionIdx)
-    {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
-
-        return XoG*MO / (MG*(1 - XoG) + XoG*MO);
-    }
+    { return instance().template convertXoGToxoG<LhsEval>(XoG, regionIdx); }
 
     /*!
      * \brief Convert a gas mole fraction in the oil phase the corresponding mass fraction.
      */
     template <class LhsEval>
     static LhsEval convertxoGToXoG(const LhsEval& xoG, unsigned regionIdx)
-    {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
-
-        return xoG*MG / (xoG*(MG - MO) + MO);
-    }
+    { return instance().template convertxoGToXoG<LhsEval>(xoG, regionIdx); }
 
     /*!
      * \brief Convert a oil mass fraction in the gas phase the corresponding mole fraction.
      */
     template <class LhsEval>
     static LhsEval convertXgOToxgO(const LhsEval& XgO, unsigned regionIdx)
-    {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
-
-        return XgO*MG / (MO*(1 - XgO) + XgO*MG);
-    }
+    { return instance().template convertXgOToxgO<LhsEval>(XgO, regionIdx); }
 
     /*!
      * \brief Convert a oil mole fraction in the gas phase the corresponding mass fraction.
      */
     template <class LhsEval>
     static LhsEval convertxgOToXgO(const LhsEval& xgO, unsigned regionIdx)
-    {
-        Scalar MO = molarMass_[regionIdx][oilCompIdx];
-        Scalar MG = molarMass_[regionIdx][gasCompIdx];
-
-        return xgO*MO / (xgO*(MO - MG) + MG);
-    }
+    { return instance().template convertxgOToXgO<LhsEval>(xgO, regionIdx); }
 
     /*!
      * \brief Return a reference to the low-level object which calculates the gas phase
@@ -1435,7 +652,7 @@ public:
      *       specific methods of the fluid systems from above should be used instead.
      */
     static const GasPvt& gasPvt()
-    { return *gasPvt_; }
+    { return instance().gasPvt(); }
 
     /*!
      * \brief Return a reference to the low-level object which calculates the oil phase
@@ -1445,7 +662,7 @@ public:
      *       specific methods of the fluid systems from above should be used instead.
      */
     static const OilPvt& oilPvt()
-    { return *oilPvt_; }
+    { return instance().oilPvt(); }
 
     /*!
      * \brief Return a reference to the low-level object which calculates the water phase
@@ -1455,7 +672,7 @@ public:
      *       specific methods of the fluid systems from above should be used instead.
      */
     static const WaterPvt& waterPvt()
-    { return *waterPvt_; }
+    { return instance().waterPvt(); }
 
     /*!
      * \brief Set the temperature of the reservoir.
@@ -1463,7 +680,7 @@ public:
      * This method is black-oil specific and only makes sense for isothermal simulations.
      */
     static Scalar reservoirTemperature(unsigned = 0)
-    { return reservoirTemperature_; }
+    { return instance().reservoirTemperature(); }
 
     /*!
      * \brief Return the temperature of the reservoir.
@@ -1471,19 +688,21 @@ public:
      * This method is black-oil specific and only makes sense for isothermal simulations.
      */
     static void setReservoirTemperature(Scalar value)
-    { reservoirTemperature_ = value; }
+    { instance().setReservoirTemperature(value); }
 
-    static short activeToCanonicalPhaseIdx(unsigned activePhaseIdx);
+    static short activeToCanonicalPhaseIdx(unsigned activePhaseIdx)
+    { return instance().activeToCanonicalPhaseIdx(activePhaseIdx); }
 
-    static short canonicalToActivePhaseIdx(unsigned phaseIdx);
+    static short canonicalToActivePhaseIdx(unsigned phaseIdx)
+    { return instance().canonicalToActivePhaseIdx(phaseIdx); }
 
     //! \copydoc BaseFluidSystem::diffusionCoefficient
     static Scalar diffusionCoefficient(unsigned compIdx, unsigned phaseIdx, unsigned regionIdx = 0)
-    { return diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx]; }
+    { return instance().diffusionCoefficient(compIdx, phaseIdx, regionIdx); }
 
     //! \copydoc BaseFluidSystem::setDiffusionCoefficient
     static void setDiffusionCoefficient(Scalar coefficient, unsigned compIdx, unsigned phaseIdx, unsigned regionIdx = 0)
-    { diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx] = coefficient ; }
+    { instance().setDiffusionCoefficient(coefficient, compIdx, phaseIdx, regionIdx); }
 
     /*!
      * \copydoc BaseFluidSystem::diffusionCoefficient
@@ -1493,53 +712,30 @@ public:
                                         const ParameterCache<ParamCacheEval>& paramCache,
                                         unsigned phaseIdx,
                                         unsigned compIdx)
-    {
-        // diffusion is disabled by the user
-        if(!enableDiffusion())
-            return 0.0;
-
-        // diffusion coefficients are set, and we use them
-        if(!diffusionCoefficients_.empty()) {
-            return diffusionCoefficient(compIdx, phaseIdx, paramCache.regionIndex());
-        }
-
-        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
-        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
-
-        switch (phaseIdx) {
-        case oilPhaseIdx: return oilPvt().diffusionCoefficient(T, p, compIdx);
-        case gasPhaseIdx: return gasPvt().diffusionCoefficient(T, p, compIdx);
-        case waterPhaseIdx: return waterPvt().diffusionCoefficient(T, p, compIdx);
-        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
-        }
-    }
+    { return instance().template diffusionCoefficient<FluidState, LhsEval, ParamCacheEval>(fluidState, paramCache, phaseIdx, compIdx); }
 
 private:
-    static void resizeArrays_(std::size_t numRegions);
-
-    static Scalar reservoirTemperature_;
-
-    static std::shared_ptr<GasPvt> gasPvt_;
-    static std::shared_ptr<OilPvt> oilPvt_;
-    static std::shared_ptr<WaterPvt> waterPvt_;
-
-    static bool enableDissolvedGas_;
-    static bool enableDissolvedGasInWater_;
-    static bool enableVaporizedOil_;
-    static bool enableVaporizedWater_;
-    static bool enableDiffusion_;
+    // constructed on first use, so the static methods may be called during the
+    // dynamic initialization of other translation units
+    static NonStatic& instance()
+    {
+        static NonStatic instance_;
+        return instance_;
+    }
 
-    // HACK for GCC 4.4: the array size has to be specified using the literal value '3'
-    // here, because GCC 4.4 seems to be unable to determine the number of phases from
-    // the BlackOil fluid system in the attribute declaration below...
-    static std::vector<std::array<Scalar, /*numPhases=*/3> > referenceDensity_;
-    static std::vector<std::array<Scalar, /*numComponents=*/3> > molarMass_;
-    static std::vector<std::array<Scalar, /*numComponents=*/3 * /*numPhases=*/3> > diffusionCoefficients_;
+    // copy the state which is exposed through static data members from the
+    // default instance
+    static void syncStatics_()
+    {
+        const auto& fs = instance();
 
-    static std::array<short, numPhases> activeToCanonicalPhaseIdx_;
-    static std::array<short, numPhases> canonicalToActivePhaseIdx_;
+        surfacePressure = fs.surfacePressure;
+        surfaceTemperature = fs.surfaceTemperature;
 
-    static bool isInitialized_;
+        numActivePhases_ = static_cast<unsigned char>(fs.numActivePhases());
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+            phaseIsActive_[phaseIdx] = fs.phaseIsActive(phaseIdx);
+    }
 };
 
 template <class Scalar, class IndexTraits>
@@ -1548,12 +744,6 @@ unsigned char BlackOilFluidSystem<Scalar, IndexTraits>::numActivePhases_;
 template <class Scalar, class IndexTraits>
 std::array<bool, BlackOilFluidSystem<Scalar, IndexTraits>::numPhases> BlackOilFluidSystem<Scalar, IndexTraits>::phaseIsActive_;
 
-template <class Scalar, class IndexTraits>
-std::array<short, BlackOilFluidSystem<Scalar, IndexTraits>::numPhases> BlackOilFluidSystem<Scalar, IndexTraits>::activeToCanonicalPhaseIdx_;
-
-template <class Scalar, class IndexTraits>
-std::array<short, BlackOilFluidSystem<Scalar, IndexTraits>::numPhases> BlackOilFluidSystem<Scalar, IndexTraits>::canonicalToActivePhaseIdx_;
-
 template <class Scalar, class IndexTraits>
 Scalar
 BlackOilFluidSystem<Scalar, IndexTraits>::surfaceTemperature; // [K]
@@ -1562,53 +752,6 @@ template <class Scalar, class IndexTraits>
 Scalar
 BlackOilFluidSystem<Scalar, IndexTraits>::surfacePressure; // [Pa]
 
-template <class Scalar, class IndexTraits>
-Scalar
-BlackOilFluidSystem<Scalar, IndexTraits>::reservoirTemperature_;
-
-template <class Scalar, class IndexTraits>
-bool BlackOilFluidSystem<Scalar, IndexTraits>::enableDissolvedGas_;
-
-template <class Scalar, class IndexTraits>
-bool BlackOilFluidSystem<Scalar, IndexTraits>::enableDissolvedGasInWater_;
-
-
-template <class Scalar, class IndexTraits>
-bool BlackOilFluidSystem<Scalar, IndexTraits>::enableVaporizedOil_;
-
-template <class Scalar, class IndexTraits>
-bool BlackOilFluidSystem<Scalar, IndexTraits>::enableVaporizedWater_;
-
-template <class Scalar, class IndexTraits>
-bool BlackOilFluidSystem<Scalar, IndexTraits>::enableDiffusion_;
-
-template <class Scalar, class IndexTraits>
-std::shared_ptr<OilPvtMultiplexer<Scalar> >
-BlackOilFluidSystem<Scalar, IndexTraits>::oilPvt_;
-
-template <class Scalar, class IndexTraits>
-std::shared_ptr<GasPvtMultiplexer<Scalar> >
-BlackOilFluidSystem<Scalar, IndexTraits>::gasPvt_;
-
-template <class Scalar, class IndexTraits>
-std::shared_ptr<WaterPvtMultiplexer<Scalar> >
-BlackOilFluidSystem<Scalar, IndexTraits>::waterPvt_;
-
-template <class Scalar, class IndexTraits>
-std::vector<std::array<Scalar, 3> >
-BlackOilFluidSystem<Scalar, IndexTraits>::referenceDensity_;
-
-template <class Scalar, class IndexTraits>
-std::vector<std::array<Scalar, 3> >
-BlackOilFluidSystem<Scalar, IndexTraits>::molarMass_;
-
-template <class Scalar, class IndexTraits>
-std::vector<std::array<Scalar, 9> >
-BlackOilFluidSystem<Scalar, IndexTraits>::diffusionCoefficients_;
-
-template <class Scalar, class IndexTraits>
-bool BlackOilFluidSystem<Scalar, IndexTraits>::isInitialized_ = false;
-
 } // namespace Opm
 
 #endif
@@ -41,6 +41,9 @@
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 #include <vector>
 
 namespace Opm {
@@ -106,6 +109,7 @@ public:
 
     void setNumRegions(size_t numRegions)
     {
+        tables_.clear();
         brineReferenceDensity_.resize(numRegions);
         co2ReferenceDensity_.resize(numRegions);
         salinity_.resize(numRegions);
@@ -123,6 +127,7 @@ public:
                                Scalar rhoRefCO2,
                                Scalar /*rhoRefWater*/)
     {
+        tables_.clear();
         brineReferenceDensity_[regionIdx] = rhoRefBrine;
         co2ReferenceDensity_[regionIdx] = rhoRefCO2;
     }
@@ -160,6 +165,111 @@ public:
     unsigned numRegions() const
     { return brineReferenceDensity_.size(); }
 
+    /*!
+     * \brief Maximum relative deviations of the tabulated quantities from the
+     *        analytic expressions, see tabulate().
+     */
+    struct TabulationError
+    {
+        Scalar rsSat = 0.0;
+        Scalar density = 0.0;
+        Scalar enthalpy = 0.0;
+    };
+
+    /*!
+     * \brief Tabulate the CO2 solubility, the brine and water densities and the
+     *        enthalpy contributions over temperature and pressure.
+     *
+     * One set of tables is built per PVT region at the salinity of the region.
+     * The tables replace the analytic expressions whenever the salinity is not
+     * taken from the fluid state and (T, p) lies within the tabulated range.
+     * Any subsequent change of the reference densities or of the number of
+     * regions discards the tables, so this must be called after the object has
+     * been initialized.
+     *
+     * \return The largest relative deviation of the interpolated saturated
+     *         dissolution factor, density and enthalpy from the analytic
+     *         expressions, sampled at the centres of the table cells.
+     */
+    TabulationError tabulate(Scalar minT, Scalar maxT, unsigned numT,
+                             Scalar minP, Scalar maxP, unsigned numP)
+    {
+        if (numT < 2 || numP < 2 || !(minT < maxT) || !(minP < maxP)) {
+            OPM_THROW(std::invalid_argument,
+                      "Tabulating the brine-co2 PVT requires a non-empty range and "
+                      "at least two sampling points for both temperature and pressure");
+        }
+
+        tables_.clear();
+        std::vector<Tables> tables(numRegions());
+        for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+            auto& tab = tables[regionIdx];
+            for (auto* table : {&tab.rsSat, &tab.brineDensity, &tab.waterDensity,
+                                &tab.brineEnthalpy, &tab.co2Enthalpy}) {
+                table->resize(minT, maxT, numT, minP, maxP, numP);
+            }
+
+            const Scalar salinity = salinity_[regionIdx];
+            for (unsigned i = 0; i < numT; ++i) {
+                const Scalar T = tab.rsSat.iToX(i);
+                for (unsigned j = 0; j < numP; ++j) {
+                    const Scalar p = tab.rsSat.jToY(j);
+                    const Scalar hBrine = liquidEnthalpyBrineCO2_(T, p, salinity, Scalar{0.0});
+                    tab.rsSat.setSamplePoint(i, j, rsSatAnalytic_(regionIdx, T, p, salinity));
+                    tab.brineDensity.setSamplePoint(i, j, Brine::liquidDensity(T, p, salinity, extrapolate));
+                    tab.waterDensity.setSamplePoint(i, j, H2O::liquidDensity(T, p, extrapolate));
+                    tab.brineEnthalpy.setSamplePoint(i, j, hBrine);
+                    tab.co2Enthalpy.setSamplePoint(i, j,
+                                                   liquidEnthalpyBrineCO2_(T, p, salinity, Scalar{1.0}) - hBrine);
+                }
+            }
+        }
+
+        const auto relError = [](Scalar approx, Scalar exact)
+        { return std::abs(approx - exact) / std::max(std::abs(exact), Scalar{1e-30}); };
+
+        TabulationError error;
+        for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+            const auto& tab = tables[regionIdx];
+            const Scalar salinity = salinity_[regionIdx];
+            for (unsigned i = 0; i + 1 < numT; ++i) {
+                const Scalar T = (tab.rsSat.iToX(i) + tab.rsSat.iToX(i + 1)) / 2;
+                for (unsigned j = 0; j + 1 < numP; ++j) {
+                    const Scalar p = (tab.rsSat.jToY(j) + tab.rsSat.jToY(j + 1)) / 2;
+
+                    const Scalar rsSat = rsSatAnalytic_(regionIdx, T, p, salinity);
+                    const Scalar xlCO2 = convertXoGToxoG_(convertRsToXoG_(rsSat, regionIdx), salinity);
+                    const Scalar XlCO2 = convertRsToXoG_(rsSat, regionIdx);
+                    const Scalar rho = mixtureDensity_(T, xlCO2,
+                                                       Brine::liquidDensity(T, p, salinity, extrapolate),
+                                                       H2O::liquidDensity(T, p, extrapolate));
+                    const Scalar h = liquidEnthalpyBrineCO2_(T, p, salinity, XlCO2);
+
+                    const Scalar rsSatTab = tab.rsSat.eval(T, p, /*extrapolate=*/false);
+                    const Scalar rhoTab = mixtureDensity_(T, xlCO2,
+                                                          tab.brineDensity.eval(T, p, /*extrapolate=*/false),
+                                                          tab.waterDensity.eval(T, p, /*extrapolate=*/false));
+                    const Scalar hTab = tab.brineEnthalpy.eval(T, p, /*extrapolate=*/false)
+                        + XlCO2 * tab.co2Enthalpy.eval(T, p, /*extrapolate=*/false);
+
+                    error.rsSat = std::max(error.rsSat, relError(rsSatTab, rsSat));
+                    error.density = std::max(error.density, relError(rhoTab, rho));
+                    error.enthalpy = std::max(error.enthalpy, relError(hTab, h));
+                }
+            }
+        }
+
+        tables_ = std::move(tables);
+        return error;
+    }
+
+    /*!
+     * \brief Returns whether tabulate() has been called since the last change of
+     *        the PVT parameters.
+     */
+    bool isTabulated() const
+    { return !tables_.empty(); }
+
     /*!
      * \brief Returns the specific enthalpy [J/kg] of gas given a set of parameters.
      */
@@ -173,10 +283,11 @@ public:
         OPM_TIMEFUNCTION_LOCAL();
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature, pressure, saltConcentration);
         const Evaluation xlCO2 = convertRsToXoG_(Rs,regionIdx);
-        return (liquidEnthalpyBrineCO2_(temperature,
-                                       pressure,
-                                       salinity,
-                                       xlCO2)
+        return (liquidEnthalpy_(regionIdx,
+                                temperature,
+                                pressure,
+                                salinity,
+                                xlCO2)
         - pressure / density_(regionIdx, temperature, pressure, Rs, salinity ));
     }
     /*!
@@ -190,10 +301,11 @@ public:
     {
         OPM_TIMEFUNCTION_LOCAL();
         const Evaluation xlCO2 = convertRsToXoG_(Rs,regionIdx);
-        return (liquidEnthalpyBrineCO2_(temperature,
-                                       pressure,
-                                       Evaluation(salinity_[regionIdx]),
-                                       xlCO2)
+        return (liquidEnthalpy_(regionIdx,
+                                temperature,
+                                pressure,
+                                Evaluation(salinity_[regionIdx]),
+                                xlCO2)
         - pressure / density_(regionIdx, temperature, pressure, Rs, Evaluation(salinity_[regionIdx])));
     }
 
@@ -403,12 +515,31 @@ public:
     }
 
 private:
+    //! Tabulated quantities of a PVT region, see tabulate().
+    struct Tables
+    {
+        UniformTabulated2DFunction<Scalar> rsSat;
+        UniformTabulated2DFunction<Scalar> brineDensity;
+        UniformTabulated2DFunction<Scalar> waterDensity;
+        UniformTabulated2DFunction<Scalar> brineEnthalpy;
+        UniformTabulated2DFunction<Scalar> co2Enthalpy;
+    };
+
     std::vector<Scalar> brineReferenceDensity_;
     std::vector<Scalar> co2ReferenceDensity_;
     std::vector<Scalar> salinity_;
+    std::vector<Tables> tables_;
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
 
+    template <class LhsEval>
+    bool useTables_(unsigned regionIdx, const LhsEval& temperature, const LhsEval& pressure) const
+    {
+        return !tables_.empty()
+            && !enableSaltConcentration_
+            && tables_[regionIdx].rsSat.applies(temperature, pressure);
+    }
+
     template <class LhsEval>
     LhsEval density_(unsigned regionIdx,
                      const LhsEval& temperature,
@@ -418,7 +549,8 @@ private:
     {
         OPM_TIMEFUNCTION_LOCAL();
         LhsEval xlCO2 = convertXoGToxoG_(convertRsToXoG_(Rs,regionIdx), salinity);
-        LhsEval result = liquidDensity_(temperature,
+        LhsEval result = liquidDensity_(regionIdx,
+                                        temperature,
                                         pressure,
                                         xlCO2,
                                         salinity);
@@ -429,7 +561,8 @@ private:
 
 
     template <class LhsEval>
-    LhsEval liquidDensity_(const LhsEval& T,
+    LhsEval liquidDensity_(unsigned regionIdx,
+                           const LhsEval& T,
                            const LhsEval& pl,
                            const LhsEval& xlCO2,
                            const LhsEval& salinity) const
@@ -454,9 +587,25 @@ private:
             throw NumericalProblem(msg);
         }
 
-        const LhsEval& rho_brine = Brine::liquidDensity(T, pl, salinity, extrapolate);
-        const LhsEval& rho_pure = H2O::liquidDensity(T, pl, extrapolate);
-        const LhsEval& rho_lCO2 = liquidDensityWaterCO2_(T, pl, xlCO2);
+        if (useTables_(regionIdx, T, pl)) {
+            const auto& tab = tables_[regionIdx];
+            return mixtureDensity_(T, xlCO2,
+                                   tab.brineDensity.eval(T, pl, /*extrapolate=*/false),
+                                   tab.waterDensity.eval(T, pl, /*extrapolate=*/false));
+        }
+
+        return mixtureDensity_(T, xlCO2,
+                               Brine::liquidDensity(T, pl, salinity, extrapolate),
+                               H2O::liquidDensity(T, pl, extrapolate));
+    }
+
+    template <class LhsEval>
+    LhsEval mixtureDensity_(const LhsEval& T,
+                            const LhsEval& xlCO2,
+                            const LhsEval& rho_brine,
+                            const LhsEval& rho_pure) const
+    {
+        const LhsEval& rho_lCO2 = liquidDensityWaterCO2_(T, rho_pure, xlCO2);
         const LhsEval& contribCO2 = rho_lCO2 - rho_pure;
 
         return rho_brine + contribCO2;
@@ -464,15 +613,14 @@ private:
 
     template <class LhsEval>
     LhsEval liquidDensityWaterCO2_(const LhsEval& temperature,
-                                          const LhsEval& pl,
-                                          const LhsEval& xlCO2) const
+                                   const LhsEval& rho_pure,
+                                   const LhsEval& xlCO2) const
     {
         OPM_TIMEFUNCTION_LOCAL();
         Scalar M_CO2 = CO2::molarMass();
         Scalar M_H2O = H2O::molarMass();
 
         const LhsEval& tempC = temperature - 273.15;        /* tempC : temperature in °C */
-        const LhsEval& rho_pure = H2O::liquidDensity(temperature, pl, extrapolate);
         // calculate the mole fraction of CO2 in the liquid. note that xlH2O is available
         // as a function parameter, but in the case of a pure gas phase the value of M_T
         // for the virtual liquid phase can become very large
@@ -553,6 +701,18 @@ private:
         if (!enableDissolution_)
             return 0.0;
 
+        if (useTables_(regionIdx, temperature, pressure))
+            return tables_[regionIdx].rsSat.eval(temperature, pressure, /*extrapolate=*/false);
+
+        return rsSatAnalytic_(regionIdx, temperature, pressure, salinity);
+    }
+
+    template <class LhsEval>
+    LhsEval rsSatAnalytic_(unsigned regionIdx,
+                           const LhsEval& temperature,
+                           const LhsEval& pressure,
+                           const LhsEval& salinity) const
+    {
         // calulate the equilibrium composition for the given
         // temperature and pressure.
         LhsEval xgH2O;
@@ -571,6 +731,23 @@ private:
         return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
     }
 
+    template <class LhsEval>
+    LhsEval liquidEnthalpy_(unsigned regionIdx,
+                            const LhsEval& T,
+                            const LhsEval& p,
+                            const LhsEval& salinity,
+                            const LhsEval& X_CO2_w) const
+    {
+        // the enthalpy is linear in the mass fraction of CO2
+        if (useTables_(regionIdx, T, p)) {
+            const auto& tab = tables_[regionIdx];
+            return tab.brineEnthalpy.eval(T, p, /*extrapolate=*/false)
+                + X_CO2_w * tab.co2Enthalpy.eval(T, p, /*extrapolate=*/false);
+        }
+
+        return liquidEnthalpyBrineCO2_(T, p, salinity, X_CO2_w);
+    }
+
     template <class LhsEval>
     static LhsEval liquidEnthalpyBrineCO2_(const LhsEval& T,
                                            const LhsEval& p,
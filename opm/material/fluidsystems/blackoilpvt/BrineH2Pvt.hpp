@@ -27,6 +27,7 @@ copyright holders.
 #ifndef OPM_BRINE_H2_PVT_HPP
 #define OPM_BRINE_H2_PVT_HPP
 
+#include <opm/common/ErrorMacros.hpp>
 #include <opm/common/Exceptions.hpp>
 
 #include <opm/material/binarycoefficients/Brine_H2.hpp>
@@ -36,6 +37,9 @@ copyright holders.
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/Valgrind.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 #include <vector>
 
 namespace Opm {
@@ -86,6 +90,7 @@ public:
 
     void setNumRegions(size_t numRegions)
     {
+        tables_.clear();
         brineReferenceDensity_.resize(numRegions);
         h2ReferenceDensity_.resize(numRegions);
         salinity_.resize(numRegions);
@@ -103,6 +108,7 @@ public:
                                Scalar rhoRefH2,
                                Scalar /*rhoRefWater*/)
     {
+        tables_.clear();
         brineReferenceDensity_[regionIdx] = rhoRefBrine;
         h2ReferenceDensity_[regionIdx] = rhoRefH2;
     }
@@ -138,6 +144,105 @@ public:
     unsigned numRegions() const
     { return brineReferenceDensity_.size(); }
 
+    /*!
+    * \brief Maximum relative deviations of the tabulated quantities from the analytic expressions, see tabulate().
+    */
+    struct TabulationError
+    {
+        Scalar rsSat = 0.0;
+        Scalar density = 0.0;
+        Scalar enthalpy = 0.0;
+    };
+
+    /*!
+    * \brief Tabulate the H2 solubility, the brine and water densities and the enthalpy contributions over
+    * temperature and pressure.
+    *
+    * One set of tables is built per PVT region at the salinity of the region. The tables replace the analytic
+    * expressions whenever the salinity is not taken from the fluid state and (T, p) lies within the tabulated range.
+    * Any subsequent change of the reference densities or of the number of regions discards the tables.
+    *
+    * \return The largest relative deviation of the interpolated saturated dissolution factor, density and enthalpy
+    * from the analytic expressions, sampled at the centres of the table cells.
+    */
+    TabulationError tabulate(Scalar minT, Scalar maxT, unsigned numT,
+                             Scalar minP, Scalar maxP, unsigned numP)
+    {
+        if (numT < 2 || numP < 2 || !(minT < maxT) || !(minP < maxP)) {
+            OPM_THROW(std::invalid_argument,
+                      "Tabulating the brine-h2 PVT requires a non-empty range and "
+                      "at least two sampling points for both temperature and pressure");
+        }
+
+        tables_.clear();
+        std::vector<Tables> tables(numRegions());
+        for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+            auto& tab = tables[regionIdx];
+            for (auto* table : {&tab.rsSat, &tab.brineDensity, &tab.waterDensity,
+                                &tab.brineEnthalpy, &tab.h2Enthalpy}) {
+                table->resize(minT, maxT, numT, minP, maxP, numP);
+            }
+
+            const Scalar salinity = salinity_[regionIdx];
+            for (unsigned i = 0; i < numT; ++i) {
+                const Scalar T = tab.rsSat.iToX(i);
+                for (unsigned j = 0; j < numP; ++j) {
+                    const Scalar p = tab.rsSat.jToY(j);
+                    const Scalar hBrine = liquidEnthalpyBrineH2_(T, p, salinity, Scalar{0.0});
+                    tab.rsSat.setSamplePoint(i, j, rsSatAnalytic_(regionIdx, T, p, salinity));
+                    tab.brineDensity.setSamplePoint(i, j, Brine::liquidDensity(T, p, salinity, extrapolate));
+                    tab.waterDensity.setSamplePoint(i, j, H2O::liquidDensity(T, p, extrapolate));
+                    tab.brineEnthalpy.setSamplePoint(i, j, hBrine);
+                    tab.h2Enthalpy.setSamplePoint(i, j,
+                                                  liquidEnthalpyBrineH2_(T, p, salinity, Scalar{1.0}) - hBrine);
+                }
+            }
+        }
+
+        const auto relError = [](Scalar approx, Scalar exact)
+        { return std::abs(approx - exact) / std::max(std::abs(exact), Scalar{1e-30}); };
+
+        TabulationError error;
+        for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+            const auto& tab = tables[regionIdx];
+            const Scalar salinity = salinity_[regionIdx];
+            for (unsigned i = 0; i + 1 < numT; ++i) {
+                const Scalar T = (tab.rsSat.iToX(i) + tab.rsSat.iToX(i + 1)) / 2;
+                for (unsigned j = 0; j + 1 < numP; ++j) {
+                    const Scalar p = (tab.rsSat.jToY(j) + tab.rsSat.jToY(j + 1)) / 2;
+
+                    const Scalar rsSat = rsSatAnalytic_(regionIdx, T, p, salinity);
+                    const Scalar xlH2 = convertXoGToxoG_(convertRsToXoG_(rsSat, regionIdx), salinity);
+                    const Scalar XlH2 = convertRsToXoG_(rsSat, regionIdx);
+                    const Scalar rho = mixtureDensity_(T, p, xlH2,
+                                                       Brine::liquidDensity(T, p, salinity, extrapolate),
+                                                       H2O::liquidDensity(T, p, extrapolate));
+                    const Scalar h = liquidEnthalpyBrineH2_(T, p, salinity, XlH2);
+
+                    const Scalar rsSatTab = tab.rsSat.eval(T, p, /*extrapolate=*/false);
+                    const Scalar rhoTab = mixtureDensity_(T, p, xlH2,
+                                                          tab.brineDensity.eval(T, p, /*extrapolate=*/false),
+                                                          tab.waterDensity.eval(T, p, /*extrapolate=*/false));
+                    const Scalar hTab = tab.brineEnthalpy.eval(T, p, /*extrapolate=*/false)
+                        + XlH2 * tab.h2Enthalpy.eval(T, p, /*extrapolate=*/false);
+
+                    error.rsSat = std::max(error.rsSat, relError(rsSatTab, rsSat));
+                    error.density = std::max(error.density, relError(rhoTab, rho));
+                    error.enthalpy = std::max(error.enthalpy, relError(hTab, h));
+                }
+            }
+        }
+
+        tables_ = std::move(tables);
+        return error;
+    }
+
+    /*!
+    * \brief Returns whether tabulate() has been called since the last change of the PVT parameters.
+    */
+    bool isTabulated() const
+    { return !tables_.empty(); }
+
     /*!
     * \brief Returns the specific enthalpy [J/kg] of gas given a set of parameters.
     */
@@ -150,10 +255,11 @@ public:
     {
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature, pressure, saltConcentration);
         const Evaluation xlH2 = convertRsToXoG_(Rs,regionIdx);
-        return (liquidEnthalpyBrineH2_(temperature,
-                                       pressure,
-                                       salinity,
-                                       xlH2)
+        return (liquidEnthalpy_(regionIdx,
+                                temperature,
+                                pressure,
+                                salinity,
+                                xlH2)
             - pressure / density_(regionIdx, temperature, pressure, Rs, salinity ));
     }
 
@@ -167,10 +273,11 @@ public:
                         const Evaluation& Rs) const
     {
         const Evaluation xlH2 = convertRsToXoG_(Rs,regionIdx);
-        return (liquidEnthalpyBrineH2_(temperature,
-                                       pressure,
-                                       Evaluation(salinity_[regionIdx]),
-                                       xlH2)
+        return (liquidEnthalpy_(regionIdx,
+                                temperature,
+                                pressure,
+                                Evaluation(salinity_[regionIdx]),
+                                xlH2)
             - pressure / density_(regionIdx, temperature, pressure, Rs, Evaluation(salinity_[regionIdx])));
     }
 
@@ -390,12 +497,31 @@ public:
     }
 
 private:
+    //! Tabulated quantities of a PVT region, see tabulate().
+    struct Tables
+    {
+        UniformTabulated2DFunction<Scalar> rsSat;
+        UniformTabulated2DFunction<Scalar> brineDensity;
+        UniformTabulated2DFunction<Scalar> waterDensity;
+        UniformTabulated2DFunction<Scalar> brineEnthalpy;
+        UniformTabulated2DFunction<Scalar> h2Enthalpy;
+    };
+
     std::vector<Scalar> brineReferenceDensity_;
     std::vector<Scalar> h2ReferenceDensity_;
     std::vector<Scalar> salinity_;
+    std::vector<Tables> tables_;
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
 
+    template <class LhsEval>
+    bool useTables_(unsigned regionIdx, const LhsEval& temperature, const LhsEval& pressure) const
+    {
+        return !tables_.empty()
+            && !enableSaltConcentration_
+            && tables_[regionIdx].rsSat.applies(temperature, pressure);
+    }
+
     /*!
     * \brief Calculate density of aqueous solution (H2O-NaCl/brine and H2).
     * 
@@ -414,7 +540,8 @@ private:
         LhsEval xlH2 = convertXoGToxoG_(convertRsToXoG_(Rs,regionIdx), salinity);
 
         // calculate the density of solution
-        LhsEval result = liquidDensity_(temperature,
+        LhsEval result = liquidDensity_(regionIdx,
+                                        temperature,
                                         pressure,
                                         xlH2,
                                         salinity);
@@ -432,7 +559,8 @@ private:
     * \param xlH2 mole fraction H2 [-]
     */
     template <class LhsEval>
-    LhsEval liquidDensity_(const LhsEval& T,
+    LhsEval liquidDensity_(unsigned regionIdx,
+                           const LhsEval& T,
                            const LhsEval& pl,
                            const LhsEval& xlH2,
                            const LhsEval& salinity) const
@@ -458,10 +586,33 @@ private:
             throw NumericalProblem(msg);
         }
 
+        if (useTables_(regionIdx, T, pl)) {
+            const auto& tab = tables_[regionIdx];
+            return mixtureDensity_(T, pl, xlH2,
+                                   tab.brineDensity.eval(T, pl, /*extrapolate=*/false),
+                                   tab.waterDensity.eval(T, pl, /*extrapolate=*/false));
+        }
+
+        return mixtureDensity_(T, pl, xlH2,
+                               Brine::liquidDensity(T, pl, salinity, extrapolate),
+                               H2O::liquidDensity(T, pl, extrapolate));
+    }
+
+    /*!
+    * \brief Combine the densities of brine and pure water with the contribution of dissolved H2.
+    *
+    * \param rho_brine density of brine [kg/m3]
+    * \param rho_pure density of pure water [kg/m3]
+    */
+    template <class LhsEval>
+    LhsEval mixtureDensity_(const LhsEval& T,
+                            const LhsEval& pl,
+                            const LhsEval& xlH2,
+                            const LhsEval& rho_brine,
+                            const LhsEval& rho_pure) const
+    {
         // calculate individual contribution to density
-        const LhsEval& rho_brine = Brine::liquidDensity(T, pl, salinity, extrapolate);
-        const LhsEval& rho_pure = H2O::liquidDensity(T, pl, extrapolate);
-        const LhsEval& rho_lH2 = liquidDensityWaterH2_(T, pl, xlH2);
+        const LhsEval& rho_lH2 = liquidDensityWaterH2_(T, pl, rho_pure, xlH2);
         const LhsEval& contribH2 = rho_lH2 - rho_pure;
 
         return rho_brine + contribH2;
@@ -473,20 +624,19 @@ private:
     * 
     * \param temperature [K]
     * \param pl liquid pressure [Pa]
+    * \param rho_pure density of pure water [kg/m3]
     * \param xlH2 mole fraction [-]
     */
     template <class LhsEval>
     LhsEval liquidDensityWaterH2_(const LhsEval& temperature,
-                                          const LhsEval& pl,
-                                          const LhsEval& xlH2) const
+                                  const LhsEval& pl,
+                                  const LhsEval& rho_pure,
+                                  const LhsEval& xlH2) const
     {
         // molar masses
         Scalar M_H2 = H2::molarMass();
         Scalar M_H2O = H2O::molarMass();
 
-        // density of pure water
-        const LhsEval& rho_pure = H2O::liquidDensity(temperature, pl, extrapolate);
-
         // (apparent) molar volume of H2, Eq. (14) in Li et al. (2018)
         const LhsEval& A1 = 51.1904 - 0.208062*temperature + 3.4427e-4*(temperature*temperature);
         const LhsEval& A2 = -0.022;
@@ -577,6 +727,21 @@ private:
         if (!enableDissolution_)
             return 0.0;
 
+        if (useTables_(regionIdx, temperature, pressure))
+            return tables_[regionIdx].rsSat.eval(temperature, pressure, /*extrapolate=*/false);
+
+        return rsSatAnalytic_(regionIdx, temperature, pressure, salinity);
+    }
+
+    /*!
+    * \brief Saturated gas dissolution factor, Rs, from the mutual solubility model.
+    */
+    template <class LhsEval>
+    LhsEval rsSatAnalytic_(unsigned regionIdx,
+                           const LhsEval& temperature,
+                           const LhsEval& pressure,
+                           const LhsEval& salinity) const
+    {
         // calulate the equilibrium composition for the given temperature and pressure
         LhsEval xlH2 = BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure, salinity, extrapolate);
         
@@ -586,6 +751,23 @@ private:
         return convertXoGToRs(convertxoGToXoG(xlH2, salinity), regionIdx);
     }
 
+    template <class LhsEval>
+    LhsEval liquidEnthalpy_(unsigned regionIdx,
+                            const LhsEval& T,
+                            const LhsEval& p,
+                            const LhsEval& salinity,
+                            const LhsEval& X_H2_w) const
+    {
+        // the enthalpy is linear in the mass fraction of H2
+        if (useTables_(regionIdx, T, p)) {
+            const auto& tab = tables_[regionIdx];
+            return tab.brineEnthalpy.eval(T, p, /*extrapolate=*/false)
+                + X_H2_w * tab.h2Enthalpy.eval(T, p, /*extrapolate=*/false);
+        }
+
+        return liquidEnthalpyBrineH2_(T, p, salinity, X_H2_w);
+    }
+
     template <class LhsEval>
     static LhsEval liquidEnthalpyBrineH2_(const LhsEval& T,
                                            const LhsEval& p,
@@ -224,7 +224,7 @@ public:
     /*!
      * \brief Return the reference density which are considered by this PVT-object.
      */
-    const Scalar gasReferenceDensity(unsigned regionIdx)
+    const Scalar gasReferenceDensity(unsigned regionIdx) const
     { OPM_GAS_PVT_MULTIPLEXER_CALL(return pvtImpl.gasReferenceDensity(regionIdx)); return 2.; }
 
     /*!
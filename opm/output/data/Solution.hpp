@@ -58,6 +58,9 @@ class Solution : public std::map<std::string, data::CellData>
         void convertToSI( const UnitSystem& );
         void convertFromSI( const UnitSystem& );
 
+        /// Whether or not the data fields are in SI units.
+        bool isSI() const { return this->si; }
+
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
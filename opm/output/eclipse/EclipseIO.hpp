@@ -22,6 +22,7 @@
 #ifndef OPM_ECLIPSE_WRITER_HPP
 #define OPM_ECLIPSE_WRITER_HPP
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -191,6 +192,31 @@ public:
                         const bool write_double = false);
 
 
+    /*!
+     * \brief Perform the output of writeTimeStep() on a background thread.
+     *
+     * Once enabled, writeTimeStep() takes copies of the state objects and
+     * ownership of the RestartValue, queues the request and returns.  The
+     * summary evaluation, unit conversion, restart file aggregation and all
+     * file I/O are then done by a dedicated output thread, in the order in
+     * which the requests were submitted.  At most max_pending requests wait
+     * in the queue in addition to the one being written; writeTimeStep()
+     * blocks while the queue is full.
+     *
+     * The EclipseState and Schedule are read by the output thread, and must
+     * not be modified while output is pending.  An exception raised on the
+     * output thread is rethrown by the next call to writeTimeStep() or
+     * waitForOutput().
+     */
+    void enableAsyncOutput(std::size_t max_pending = 1);
+
+    /*!
+     * \brief Block until all output requested so far has been written.
+     *
+     * No-op unless asynchronous output is enabled.
+     */
+    void waitForOutput();
+
     /*
       Will load solution data and wellstate from the restart
       file. This method will consult the IOConfig object to get
@@ -20,6 +20,9 @@
 #ifndef ORIGINAL_OIP
 #define ORIGINAL_OIP
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -90,18 +93,56 @@ public:
     */
     std::vector<double> get_vector(const std::string& region, Phase phase) const;
 
+    /*
+      Compute region totals of per-cell values for several region sets, e.g.
+      FIPNUM and a number of FIPxxx arrays, in a single pass over the cells.
+      The regions argument maps region set name to the region number of each
+      cell, and cell_values maps phase to the value of each cell. All arrays
+      must have the same size. Cells with region number less than one are
+      ignored. Every region number from one to the largest number in a region
+      set is assigned, through add(), the sum over its cells of each phase -
+      zero for regions without cells.
+    */
+    void add_region_sums(const std::unordered_map<std::string, std::vector<int>>& regions,
+                         const std::unordered_map<Phase, std::vector<double>>& cell_values);
+
     static const std::vector<Phase>& phases();
 
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
-        serializer(phase_values);
+        serializer(region_names);
+        serializer(block_offset);
+        serializer(region_size);
+        serializer(max_ids);
+        serializer(phase_mask);
+        serializer(values);
+        serializer(defined);
     }
 
     bool operator==(const Inplace& rhs) const;
 
 private:
-    std::unordered_map<std::string, std::unordered_map<Phase, std::unordered_map<std::size_t, double>>> phase_values;
+    /*
+      All values are stored in one contiguous array, organised as
+      [region set][phase][region number]. The block of region set 'set'
+      starts at block_offset[set] and holds one row of region_size[set]
+      values for every phase. Rows are grown geometrically when a larger
+      region number is added.
+    */
+    std::vector<std::string> region_names;
+    std::vector<std::size_t> block_offset;
+    std::vector<std::size_t> region_size;
+    std::vector<std::size_t> max_ids;
+    std::vector<std::uint32_t> phase_mask;
+    std::vector<double> values;
+    std::vector<unsigned char> defined;
+
+    std::optional<std::size_t> region_set(const std::string& region) const;
+    std::size_t add_region_set(const std::string& region);
+    std::size_t index(std::size_t set, Phase phase, std::size_t region_id) const;
+    void ensure_region(std::size_t set, std::size_t region_id);
+    const double* find(const std::string& region, Phase phase, std::size_t region_id) const;
 };
 
 
@@ -20,9 +20,11 @@
 #ifndef OPM_REGION_CACHE_HPP
 #define OPM_REGION_CACHE_HPP
 
-#include <map>
+#include <cstddef>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -40,9 +42,16 @@ namespace out {
         // A well is assigned to the region_id where the first connection is
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
     private:
+        template <typename T>
+        using RegionArray = std::vector<std::vector<T>>;
+
         std::vector<std::pair<std::string,size_t>> connections_empty;
-        std::map<std::pair<std::string, int> , std::vector<std::pair<std::string,size_t>>> connection_map;
-        std::map<std::pair<std::string, int>, std::vector<std::string>> well_map;
+
+        // Index of each region set in connection_map and well_map, which
+        // are indexed by [region set][region id].
+        std::unordered_map<std::string, std::size_t> region_sets;
+        std::vector<RegionArray<std::pair<std::string,size_t>>> connection_map;
+        std::vector<RegionArray<std::string>> well_map;
     };
 }
 }
@@ -33,6 +33,7 @@
 
 namespace Opm {
 
+    class Box;
     class EclipseGrid;
     class EclipseState;
     class RestartKey;
@@ -40,10 +41,17 @@ namespace Opm {
     class Schedule;
     class UDQState;
     class SummaryState;
+    class UnitSystem;
     class WellTestState;
 
 } // namespace Opm
 
+namespace Opm { namespace data {
+
+    class Solution;
+
+}} // namespace Opm::data
+
 namespace Opm { namespace EclIO { namespace OutputStream {
 
     class Restart;
@@ -82,7 +90,7 @@ namespace Opm { namespace RestartIO {
     void save(EclIO::OutputStream::Restart&                 rstFile,
               int                                           report_step,
               double                                        seconds_elapsed,
-              RestartValue                                  value,
+              const RestartValue&                           value,
               const EclipseState&                           es,
               const EclipseGrid&                            grid,
               const Schedule&                               schedule,
@@ -104,6 +112,28 @@ namespace Opm { namespace RestartIO {
                       const Schedule&                schedule,
                       const std::vector<RestartKey>& extra_keys = {});
 
+    /*
+      Load solution vectors for a subset of the active cells without
+      loading the full report step.  Only the parts of the restart file
+      which hold the requested values are read.  Element 'i' of each
+      vector in the result pertains to active cell 'active_cells[i]', and
+      the values are converted to SI units.  Vectors are loaded as stored
+      in the file, i.e., there is no translation of ECLIPSE hysteresis
+      vectors as in load().  Throws if a required vector is missing.
+    */
+    data::Solution loadSolution(const std::string&             filename,
+                                int                            report_step,
+                                const std::vector<RestartKey>& solution_keys,
+                                const std::vector<int>&        active_cells,
+                                const UnitSystem&              units);
+
+    // As above, for the active cells of a box.
+    data::Solution loadSolution(const std::string&             filename,
+                                int                            report_step,
+                                const std::vector<RestartKey>& solution_keys,
+                                const Box&                     box,
+                                const UnitSystem&              units);
+
 }} // namespace Opm::RestartIO
 
 #endif  // RESTART_IO_HPP
@@ -0,0 +1,233 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/common/utility/SnapshotFile.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+
+#include <fmt/format.h>
+
+namespace {
+
+constexpr std::array<char, 8> magic { 'O', 'P', 'M', 'S', 'N', 'A', 'P', '\0' };
+constexpr std::uint64_t formatVersion = 1;
+
+struct InputFile
+{
+    std::string name;
+    std::uint64_t size;
+    std::uint64_t hash;
+};
+
+// 64-bit FNV-1a hash of file contents, or nullopt if the file can not be
+// read.
+std::optional<InputFile> hashFile(const std::string& name)
+{
+    std::ifstream is(name, std::ios::binary);
+    if (! is) {
+        return std::nullopt;
+    }
+
+    InputFile file { name, 0, 0xcbf29ce484222325ULL };
+
+    std::vector<char> chunk(1 << 20);
+    while (is) {
+        is.read(chunk.data(), chunk.size());
+        const auto n = static_cast<std::size_t>(is.gcount());
+
+        for (std::size_t i = 0; i < n; ++i) {
+            file.hash ^= static_cast<unsigned char>(chunk[i]);
+            file.hash *= 0x100000001b3ULL;
+        }
+
+        file.size += n;
+    }
+
+    if (! is.eof()) {
+        return std::nullopt;
+    }
+
+    return file;
+}
+
+void writeInt(std::ostream& os, const std::uint64_t value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+void writeString(std::ostream& os, const std::string& value)
+{
+    writeInt(os, value.size());
+    os.write(value.data(), value.size());
+}
+
+bool readInt(std::istream& is, std::uint64_t& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof value));
+}
+
+bool readString(std::istream& is, std::string& value)
+{
+    std::uint64_t size = 0;
+    if (! readInt(is, size) || (size > (1ULL << 20))) {
+        return false;
+    }
+
+    value.resize(size);
+    return static_cast<bool>(is.read(value.data(), size));
+}
+
+// Read snapshot header and check it against key and the current input
+// files.  Leaves stream positioned at payload size on success.
+bool checkHeader(std::istream& is, const std::string& key)
+{
+    auto fileMagic = magic;
+    if (! is.read(fileMagic.data(), fileMagic.size()) || (fileMagic != magic)) {
+        return false;
+    }
+
+    std::uint64_t version = 0;
+    std::string fileKey;
+    if (! readInt(is, version) || (version != formatVersion) ||
+        ! readString(is, fileKey) || (fileKey != key))
+    {
+        return false;
+    }
+
+    std::uint64_t numFiles = 0;
+    if (! readInt(is, numFiles)) {
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < numFiles; ++i) {
+        InputFile recorded;
+        if (! readString(is, recorded.name) ||
+            ! readInt(is, recorded.size) ||
+            ! readInt(is, recorded.hash))
+        {
+            return false;
+        }
+
+        // Cheap size check before hashing the contents.
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(recorded.name, ec);
+        if (ec || (size != recorded.size)) {
+            return false;
+        }
+
+        const auto current = hashFile(recorded.name);
+        if (! current.has_value() ||
+            (current->size != recorded.size) ||
+            (current->hash != recorded.hash))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+SnapshotFile::SnapshotFile(const std::string& fileName)
+    : fileName_(fileName)
+{}
+
+bool SnapshotFile::isValid(const std::string& key) const
+{
+    std::ifstream is(this->fileName_, std::ios::binary);
+    return is && checkHeader(is, key);
+}
+
+void SnapshotFile::write(const std::vector<std::string>& inputFiles,
+                         const std::string& key,
+                         const std::vector<char>& payload) const
+{
+    std::vector<InputFile> files;
+    files.reserve(inputFiles.size());
+    for (const auto& name : inputFiles) {
+        auto file = hashFile(name);
+        if (! file.has_value()) {
+            throw std::runtime_error(fmt::format("Can not read input file {} "
+                                                 "for snapshot {}", name, this->fileName_));
+        }
+
+        files.push_back(std::move(*file));
+    }
+
+    // Write to a temporary file which replaces the snapshot once complete,
+    // so concurrent readers never see a partial snapshot.
+    const auto tmpName = fmt::format("{}.{:x}.tmp", this->fileName_, std::random_device{}());
+    {
+        std::ofstream os(tmpName, std::ios::binary | std::ios::trunc);
+        if (! os) {
+            throw std::runtime_error(fmt::format("Can not create snapshot file {}", tmpName));
+        }
+
+        os.write(magic.data(), magic.size());
+        writeInt(os, formatVersion);
+        writeString(os, key);
+
+        writeInt(os, files.size());
+        for (const auto& file : files) {
+            writeString(os, file.name);
+            writeInt(os, file.size);
+            writeInt(os, file.hash);
+        }
+
+        writeInt(os, payload.size());
+        os.write(payload.data(), payload.size());
+
+        if (! os.flush()) {
+            std::filesystem::remove(tmpName);
+            throw std::runtime_error(fmt::format("Failed writing snapshot file {}", tmpName));
+        }
+    }
+
+    std::filesystem::rename(tmpName, this->fileName_);
+}
+
+bool SnapshotFile::read(const std::string& key, std::vector<char>& payload) const
+{
+    std::ifstream is(this->fileName_, std::ios::binary);
+    if (! is || ! checkHeader(is, key)) {
+        return false;
+    }
+
+    std::uint64_t size = 0;
+    if (! readInt(is, size) ||
+        (size > static_cast<std::uint64_t>(std::numeric_limits<int>::max())))
+    {
+        return false;
+    }
+
+    payload.resize(size);
+    return static_cast<bool>(is.read(payload.data(), size));
+}
+
+} // namespace Opm
@@ -21,27 +21,201 @@
 
 #include <opm/common/utility/shmatch.hpp>
 
+namespace {
 
-bool Opm::shmatch(const std::string& pattern, const std::string& symbol) {
-    // Shell patterns should implicitly be interpreted as anchored at beginning
-    // and end.
-    std::string re_pattern = "^" + pattern + "$";
+    std::regex compile_regex(const std::string& pattern) {
+        // Shell patterns should implicitly be interpreted as anchored at beginning
+        // and end.
+        std::string re_pattern = "^" + pattern + "$";
+
+        {
+            // Shell wildcard '*' should be regular expression arbitrary character '.'
+            // repeated arbitrary number of times '*'
+            std::regex re("\\*");
+            re_pattern = std::regex_replace(re_pattern, re, ".*");
+        }
+
+        {
+            // Shell wildcard '?' should be regular expression one arbitrary character
+            // '.'
+            std::regex re("\\?");
+            re_pattern = std::regex_replace(re_pattern, re, ".");
+        }
+
+        return std::regex(re_pattern);
+    }
+
+    bool is_regex_special(const char c) {
+        switch (c) {
+        case '.': case '+': case '(': case ')': case '{': case '}':
+        case '|': case '^': case '$': case '\\': case ']':
+            return true;
+        default:
+            return false;
+        }
+    }
+
+}
+
+
+struct Opm::ShellPattern::Regex {
+    std::regex regex;
+};
+
+
+Opm::ShellPattern::ShellPattern(const std::string& pattern)
+    : pattern_(pattern)
+{
+    if (! this->compile()) {
+        this->tokens_.clear();
+        this->classes_.clear();
+        this->has_wildcard_ = true;
+        this->prefix_.clear();
+        this->regex_ = std::make_shared<const Regex>(Regex { compile_regex(pattern) });
+    }
+}
+
+
+// Translate the pattern to tokens.  Returns false if the pattern uses
+// regular expression syntax which is not matched directly.
+bool Opm::ShellPattern::compile() {
+    const auto& pattern = this->pattern_;
+    std::size_t pos = 0;
+    while (pos < pattern.size()) {
+        const char c = pattern[pos];
+        if (c == '*') {
+            this->tokens_.push_back({ Kind::AnyString, c, 0 });
+            ++pos;
+        }
+        else if (c == '?') {
+            this->tokens_.push_back({ Kind::AnyChar, c, 0 });
+            ++pos;
+        }
+        else if (c == '[') {
+            std::bitset<256> chars;
+            bool negate = false;
+            ++pos;
+            if (pos < pattern.size() && pattern[pos] == '^') {
+                negate = true;
+                ++pos;
+            }
+
+            // An empty class, or a ']' first in the class, has special
+            // meaning in regular expressions.
+            if (pos >= pattern.size() || pattern[pos] == ']')
+                return false;
+
+            while (pos < pattern.size() && pattern[pos] != ']') {
+                const auto first = static_cast<unsigned char>(pattern[pos]);
+                if (first == '[' || first == '\\')
+                    return false;
+
+                if (pos + 2 < pattern.size() && pattern[pos + 1] == '-' && pattern[pos + 2] != ']') {
+                    const auto last = static_cast<unsigned char>(pattern[pos + 2]);
+                    if (last < first || last == '[' || last == '\\')
+                        return false;
+
+                    for (unsigned ch = first; ch <= last; ++ch)
+                        chars.set(ch);
 
-    {
-        // Shell wildcard '*' should be regular expression arbitrary character '.'
-        // repeated arbitrary number of times '*'
-        std::regex re("\\*");
-        re_pattern = std::regex_replace(re_pattern, re, ".*");
+                    pos += 3;
+                }
+                else {
+                    chars.set(first);
+                    ++pos;
+                }
+            }
+
+            if (pos == pattern.size())
+                return false;
+
+            ++pos;      // Closing ']'
+            if (negate)
+                chars.flip();
+
+            this->tokens_.push_back({ Kind::Class, '[', this->classes_.size() });
+            this->classes_.push_back(chars);
+        }
+        else if (is_regex_special(c)) {
+            return false;
+        }
+        else {
+            this->tokens_.push_back({ Kind::Char, c, 0 });
+            ++pos;
+        }
     }
 
-    {
-        // Shell wildcard '?' should be regular expression one arbitrary character
-        // '.'
-        std::regex re("\\?");
-        re_pattern = std::regex_replace(re_pattern, re, ".");
+    for (const auto& token : this->tokens_) {
+        if (token.kind != Kind::Char) {
+            this->has_wildcard_ = true;
+            break;
+        }
+
+        this->prefix_.push_back(token.ch);
     }
 
-    std::regex regexp(re_pattern);
-    return std::regex_search(symbol, regexp);
+    return true;
 }
 
+
+bool Opm::ShellPattern::matchToken(const Token& token, const char c) const {
+    switch (token.kind) {
+    case Kind::Char:
+        return token.ch == c;
+    case Kind::AnyChar:
+        return true;
+    case Kind::Class:
+        return this->classes_[token.class_index].test(static_cast<unsigned char>(c));
+    default:
+        return false;
+    }
+}
+
+
+bool Opm::ShellPattern::match(std::string_view symbol) const {
+    if (this->regex_)
+        return std::regex_search(symbol.begin(), symbol.end(), this->regex_->regex);
+
+    if (! this->has_wildcard_)
+        return symbol == this->pattern_;
+
+    // Wildcards in regular expressions do not match line terminators.
+    if (symbol.find_first_of("\n\r") != std::string_view::npos) {
+        const auto regex = compile_regex(this->pattern_);
+        return std::regex_search(symbol.begin(), symbol.end(), regex);
+    }
+
+    // Iterative matching, backtracking to the most recent '*' on mismatch.
+    constexpr auto npos = std::string_view::npos;
+    const auto num_tokens = this->tokens_.size();
+    std::size_t t = 0;
+    std::size_t i = 0;
+    std::size_t star_t = npos;
+    std::size_t star_i = 0;
+    while (i < symbol.size()) {
+        if (t < num_tokens && this->tokens_[t].kind == Kind::AnyString) {
+            star_t = t++;
+            star_i = i;
+        }
+        else if (t < num_tokens && this->matchToken(this->tokens_[t], symbol[i])) {
+            ++t;
+            ++i;
+        }
+        else if (star_t != npos) {
+            t = star_t + 1;
+            i = ++star_i;
+        }
+        else
+            return false;
+    }
+
+    while (t < num_tokens && this->tokens_[t].kind == Kind::AnyString)
+        ++t;
+
+    return t == num_tokens;
+}
+
+
+bool Opm::shmatch(const std::string& pattern, const std::string& symbol) {
+    return ShellPattern(pattern).match(symbol);
+}
@@ -18,6 +18,7 @@
 
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 
+#include <algorithm>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -82,6 +83,21 @@ const std::string& DeckTree::root() const {
     return this->root_file.value();
 }
 
+std::vector<std::string> DeckTree::files() const {
+    std::vector<std::string> fnames;
+    if (!this->root_file.has_value())
+        return fnames;
+
+    for (const auto& [fname, _] : this->nodes) {
+        if (fname != this->root_file.value())
+            fnames.push_back(fname);
+    }
+
+    std::sort(fnames.begin(), fnames.end());
+    fnames.insert(fnames.begin(), this->root_file.value());
+    return fnames;
+}
+
 void DeckTree::add_include(std::string parent_file, std::string include_file) {
     if (!this->root_file.has_value())
         return;
@@ -89,6 +89,52 @@ void apply_GRIDUNIT(const UnitSystem& deck_units, const UnitSystem& grid_units,
         v *= scale_factor;
 }
 
+/*
+  Cell quantities derived from the corner coordinates.  Shared between the
+  per cell accessors and EclipseGrid::precomputeGeometry() so that cached
+  and recomputed values are identical.
+*/
+
+double cell_thickness(const std::array<double,8>& Z) {
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return z2 - z1;
+}
+
+double cell_depth(const std::array<double,8>& Z) {
+    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+    return (z1 + z2)/2.0;
+}
+
+std::array<double, 3> cell_center(const std::array<double,8>& X,
+                                  const std::array<double,8>& Y,
+                                  const std::array<double,8>& Z) {
+    return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+                                    std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+                                    std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+}
+
+std::array<double, 3> cell_dims(const std::array<double,8>& X,
+                                const std::array<double,8>& Y,
+                                const std::array<double,8>& Z) {
+    // calculate dx
+    double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+    double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+    double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+    double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+    double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+
+    // calculate dy
+    x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+    y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+    x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+    y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+    double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+
+    return std::array<double,3> {{dx, dy, cell_thickness(Z)}};
+}
+
 }
 EclipseGrid::EclipseGrid()
     : GridDims(),
@@ -144,6 +190,7 @@ EclipseGrid::EclipseGrid(const GridDims& gd)
 {
     this->m_nactive = this->getCartesianSize();
     this->active_volume = std::nullopt;
+    this->active_geometry = std::nullopt;
     // Nothing else initialized. Leaving in particular as empty:
     // m_actnum,
     // m_global_to_active,
@@ -1465,6 +1512,9 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     const std::vector<double>& EclipseGrid::activeVolume() const {
+        if (this->active_geometry.has_value())
+            return this->active_geometry->volume;
+
         if (!this->active_volume.has_value()) {
             std::vector<double> volume(this->m_nactive);
 
@@ -1475,13 +1525,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 std::array<double,8> Z;
                 auto global_index = this->m_active_to_global[active_index];
                 this->getCellCorners(global_index, X, Y, Z );
-                if (m_rv && m_thetav) {
-                    const auto[i,j,k] = this->getIJK(global_index);
-                    auto& r = *m_rv;
-                    auto& t = *m_thetav;
-                    volume[active_index] = calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-                } else
-                    volume[active_index] = calculateCellVol(X, Y, Z);
+                volume[active_index] = this->computeCellVolume(global_index, X, Y, Z);
             }
 
             this->active_volume = std::move(volume);
@@ -1490,9 +1534,87 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         return this->active_volume.value();
     }
 
+    const EclipseGrid::ActiveGeometry& EclipseGrid::precomputeGeometry() const {
+        if (this->active_geometry.has_value())
+            return this->active_geometry.value();
+
+        const std::size_t nactive = this->m_active_to_global.size();
+
+        ActiveGeometry geometry;
+        geometry.volume.resize(nactive);
+        geometry.depth.resize(nactive);
+        geometry.thickness.resize(nactive);
+        for (std::size_t d = 0; d < 3; d++) {
+            geometry.center[d].resize(nactive);
+            geometry.dims[d].resize(nactive);
+        }
+
+        // Corners are extracted once per cell and all quantities derived
+        // from them; each thread fills a contiguous range of every array.
+        #pragma omp parallel for schedule(static)
+        for (std::size_t active_index = 0; active_index < nactive; active_index++) {
+            std::array<double,8> X;
+            std::array<double,8> Y;
+            std::array<double,8> Z;
+            const auto global_index = this->m_active_to_global[active_index];
+            this->getCellCorners(global_index, X, Y, Z );
+
+            const auto center = cell_center(X, Y, Z);
+            const auto dims = cell_dims(X, Y, Z);
+
+            geometry.volume[active_index] = this->computeCellVolume(global_index, X, Y, Z);
+            geometry.depth[active_index] = cell_depth(Z);
+            geometry.thickness[active_index] = dims[2];
+            for (std::size_t d = 0; d < 3; d++) {
+                geometry.center[d][active_index] = center[d];
+                geometry.dims[d][active_index] = dims[d];
+            }
+        }
+
+        this->active_volume = std::nullopt;
+        this->active_geometry = std::move(geometry);
+        return this->active_geometry.value();
+    }
+
+    void EclipseGrid::releaseGeometry() const {
+        if (!this->active_geometry.has_value())
+            return;
+
+        this->active_volume = std::move(this->active_geometry->volume);
+        this->active_geometry = std::nullopt;
+    }
+
+    const EclipseGrid::ActiveGeometry* EclipseGrid::activeGeometry() const {
+        return this->active_geometry.has_value() ? &this->active_geometry.value() : nullptr;
+    }
+
+    const EclipseGrid::ActiveGeometry* EclipseGrid::cachedGeometry(size_t globalIndex) const {
+        if (!this->active_geometry.has_value() || !this->cellActive(globalIndex))
+            return nullptr;
+
+        return &this->active_geometry.value();
+    }
+
+    double EclipseGrid::computeCellVolume(size_t globalIndex,
+                                          const std::array<double,8>& X,
+                                          const std::array<double,8>& Y,
+                                          const std::array<double,8>& Z) const {
+        if (m_rv && m_thetav) {
+            const auto[i,j,k] = this->getIJK(globalIndex);
+            auto& r = *m_rv;
+            auto& t = *m_thetav;
+            return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
+        } else {
+            return calculateCellVol(X, Y, Z);
+        }
+    }
+
 
     double EclipseGrid::getCellVolume(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (const auto* geometry = this->cachedGeometry(globalIndex); geometry != nullptr)
+            return geometry->volume[this->activeIndex(globalIndex)];
+
         if (this->cellActive(globalIndex) && this->active_volume.has_value()) {
             auto active_index = this->activeIndex(globalIndex);
             return this->active_volume.value()[active_index];
@@ -1502,14 +1624,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        if (m_rv && m_thetav) {
-            const auto[i,j,k] = this->getIJK(globalIndex);
-            auto& r = *m_rv;
-            auto& t = *m_thetav;
-           return calculateCylindricalCellVol(r[i], r[i+1], t[j], Z[4] - Z[0]);
-        } else {
-            return calculateCellVol(X, Y, Z);
-        }
+        return this->computeCellVolume(globalIndex, X, Y, Z);
     }
 
     double EclipseGrid::getCellVolume(size_t i , size_t j , size_t k) const {
@@ -1529,47 +1644,31 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     double EclipseGrid::getCellThickness(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (const auto* geometry = this->cachedGeometry(globalIndex); geometry != nullptr)
+            return geometry->thickness[this->activeIndex(globalIndex)];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-        return dz;
+        return cell_thickness(Z);
     }
 
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (const auto* geometry = this->cachedGeometry(globalIndex); geometry != nullptr) {
+            const auto active_index = this->activeIndex(globalIndex);
+            return std::array<double,3> {{ geometry->dims[0][active_index],
+                                           geometry->dims[1][active_index],
+                                           geometry->dims[2][active_index] }};
+        }
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        // calculate dx
-        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
-        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
-        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
-
-        // calculate dy
-        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
-        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
-        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
-
-        // calculate dz
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-
-
-        return std::array<double,3> {{dx, dy, dz}};
+        return cell_dims(X, Y, Z);
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t i , size_t j , size_t k) const {
@@ -1583,13 +1682,18 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
     std::array<double, 3> EclipseGrid::getCellCenter(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        if (const auto* geometry = this->cachedGeometry(globalIndex); geometry != nullptr) {
+            const auto active_index = this->activeIndex(globalIndex);
+            return std::array<double,3> {{ geometry->center[0][active_index],
+                                           geometry->center[1][active_index],
+                                           geometry->center[2][active_index] }};
+        }
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
-                                        std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
-                                        std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+        return cell_center(X, Y, Z);
     }
 
 
@@ -1684,14 +1788,14 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
     }
 
     double EclipseGrid::computeCellGeometricDepth(size_t globalIndex) const {
+        if (const auto* geometry = this->cachedGeometry(globalIndex); geometry != nullptr)
+            return geometry->depth[this->activeIndex(globalIndex)];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        return (z1 + z2)/2.0;
+        return cell_depth(Z);
     }
 
     double EclipseGrid::getCellDepth(size_t i, size_t j, size_t k) const {
@@ -1714,6 +1818,9 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
+        this->active_volume = std::nullopt;
+        this->active_geometry = std::nullopt;
+
         return mapper.fixupZCORN( m_zcorn );
     }
 
@@ -1842,6 +1949,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         std::iota(this->m_global_to_active.begin(), this->m_global_to_active.end(), 0);
         this->m_active_to_global = this->m_global_to_active;
         this->active_volume = std::nullopt;
+        this->active_geometry = std::nullopt;
     }
 
     void EclipseGrid::resetACTNUM(const int* actnum) {
@@ -1870,6 +1978,7 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
                 }
             }
             this->active_volume = std::nullopt;
+            this->active_geometry = std::nullopt;
         }
     }
 
@@ -281,6 +281,73 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info, const D
 }
 
 
+/*
+  A deck keyword which assigns the same value to all cells of the grid, e.g.
+  PORO 1000*0.25 /, does not need to expand a field which is stored as a
+  symbolic constant. Returns false if the field must be expanded instead.
+*/
+template <typename T>
+bool assign_deck_constant(const DeckKeyword& keyword, Fieldprops::FieldData<T>& field_data, const std::vector<T>& deck_data, const std::vector<value::status>& deck_status, const Box& box) {
+    if (!field_data.constant || !box.isGlobal())
+        return false;
+
+    verify_deck_data(keyword, deck_data, box);
+    if (deck_data.empty())
+        return false;
+
+    const auto all_deck_values = std::all_of(deck_status.begin(), deck_status.end(),
+                                             [](const value::status status) { return status == value::status::deck_value; });
+    if (!all_deck_values)
+        return false;
+
+    const auto& first = deck_data.front();
+    if (!std::all_of(deck_data.begin(), deck_data.end(), [&first](const T& v) { return v == first; }))
+        return false;
+
+    field_data.constant->value = first;
+    field_data.constant->status = value::status::deck_value;
+    return true;
+}
+
+/*
+  Scalar operations on all cells of the grid, e.g. MULTIPLY with the default
+  box, keep a symbolic constant field symbolic. Returns false if the field
+  must be expanded instead.
+*/
+template <typename T>
+bool apply_constant(Fieldprops::ScalarOperation op, Fieldprops::FieldData<T>& field_data, T scalar_value, const Box& box) {
+    if (!field_data.constant || !box.isGlobal())
+        return false;
+
+    auto& constant = *field_data.constant;
+    if (op == Fieldprops::ScalarOperation::EQUAL) {
+        constant.value = scalar_value;
+        constant.status = value::status::deck_value;
+        return true;
+    }
+
+    if (!value::has_value(constant.status))
+        return true;
+
+    switch (op) {
+    case Fieldprops::ScalarOperation::MUL:
+        constant.value *= scalar_value;
+        return true;
+    case Fieldprops::ScalarOperation::ADD:
+        constant.value += scalar_value;
+        return true;
+    case Fieldprops::ScalarOperation::MIN:
+        constant.value = std::max(constant.value, scalar_value);
+        return true;
+    case Fieldprops::ScalarOperation::MAX:
+        constant.value = std::min(constant.value, scalar_value);
+        return true;
+    default:
+        return false;
+    }
+}
+
+
 template <typename T>
 void assign_scalar(std::vector<T>& data, std::vector<value::status>& value_status, T value, const std::vector<Box::cell_index>& index_list) {
     for (const auto& cell_index : index_list) {
@@ -606,6 +673,7 @@ void FieldProps::reset_actnum(const std::vector<int>& new_actnum) {
 void FieldProps::distribute_toplayer(Fieldprops::FieldData<double>& field_data, const std::vector<double>& deck_data, const Box& box) {
     const std::size_t layer_size = this->nx * this->ny;
     Fieldprops::FieldData<double> toplayer(field_data.kw_info, layer_size, 0);
+    toplayer.materialize();
     for (const auto& cell_index : box.index_list()) {
         if (cell_index.global_index < layer_size) {
             toplayer.data[cell_index.global_index] = deck_data[cell_index.data_index];
@@ -670,40 +738,46 @@ bool FieldProps::supported<int>(const std::string& keyword) {
 
 
 template <>
-Fieldprops::FieldData<double>& FieldProps::init_get(const std::string& keyword_name, const Fieldprops::keywords::keyword_info<double>& kw_info) {
+Fieldprops::FieldData<double>& FieldProps::lazy_get(const std::string& keyword_name, const Fieldprops::keywords::keyword_info<double>& kw_info) {
     const std::string& keyword = Fieldprops::keywords::get_keyword_from_alias(keyword_name);
 
     auto iter = this->double_data.find(keyword);
     if (iter != this->double_data.end())
         return iter->second;
 
-    this->double_data[keyword] = Fieldprops::FieldData<double>(kw_info, this->active_size, kw_info.global ? this->global_size : 0);
+    auto& field_data = this->double_data[keyword];
+    field_data = Fieldprops::FieldData<double>(kw_info, this->active_size, kw_info.global ? this->global_size : 0);
 
-    if (keyword == ParserKeywords::PORV::keywordName)
-        this->init_porv(this->double_data[keyword]);
+    if (keyword == ParserKeywords::PORV::keywordName) {
+        field_data.materialize();
+        this->init_porv(field_data);
+    }
 
-    if (keyword == ParserKeywords::TEMPI::keywordName)
-        this->init_tempi(this->double_data[keyword]);
+    if (keyword == ParserKeywords::TEMPI::keywordName) {
+        field_data.materialize();
+        this->init_tempi(field_data);
+    }
 
     if ((Fieldprops::keywords::PROPS::satfunc.count(keyword) == 1) ||
         is_capillary_pressure(keyword))
     {
-        this->init_satfunc(keyword, this->double_data[keyword]);
+        field_data.materialize();
+        this->init_satfunc(keyword, field_data);
     }
 
-    return this->double_data[keyword];
+    return field_data;
 }
 
 template <>
-Fieldprops::FieldData<double>& FieldProps::init_get(const std::string& keyword,
+Fieldprops::FieldData<double>& FieldProps::lazy_get(const std::string& keyword,
                                         bool allow_unsupported) {
     Fieldprops::keywords::keyword_info<double> kw_info = Fieldprops::keywords::global_kw_info<double>(keyword, allow_unsupported);
-    return this->init_get(keyword, kw_info);
+    return this->lazy_get(keyword, kw_info);
 }
 
 
 template <>
-Fieldprops::FieldData<int>& FieldProps::init_get(const std::string& keyword, const Fieldprops::keywords::keyword_info<int>& kw_info) {
+Fieldprops::FieldData<int>& FieldProps::lazy_get(const std::string& keyword, const Fieldprops::keywords::keyword_info<int>& kw_info) {
     auto iter = this->int_data.find(keyword);
     if (iter != this->int_data.end())
         return iter->second;
@@ -713,14 +787,14 @@ Fieldprops::FieldData<int>& FieldProps::init_get(const std::string& keyword, con
 }
 
 template <>
-Fieldprops::FieldData<int>& FieldProps::init_get(const std::string& keyword, bool) {
+Fieldprops::FieldData<int>& FieldProps::lazy_get(const std::string& keyword, bool) {
     if (Fieldprops::keywords::isFipxxx(keyword)) {
         auto kw_info = Fieldprops::keywords::keyword_info<int>{};
         kw_info.init(1);
-        return this->init_get(this->canonical_fipreg_name(keyword), kw_info);
+        return this->lazy_get(this->canonical_fipreg_name(keyword), kw_info);
     } else {
         const Fieldprops::keywords::keyword_info<int>& kw_info = Fieldprops::keywords::global_kw_info<int>(keyword);
-        return this->init_get(keyword, kw_info);
+        return this->lazy_get(keyword, kw_info);
     }
 }
 
@@ -816,7 +890,7 @@ template <>
 std::vector<int> FieldProps::extract<int>(const std::string& keyword) {
     auto field_iter = this->int_data.find(keyword);
     auto field = std::move(field_iter->second);
-    std::vector<int> data = std::move( field.data );
+    std::vector<int> data = field.constant ? field.view().to_vector() : std::move( field.data );
     this->int_data.erase( field_iter );
     return data;
 }
@@ -825,12 +899,30 @@ template <>
 std::vector<double> FieldProps::extract<double>(const std::string& keyword) {
     auto field_iter = this->double_data.find(keyword);
     auto field = std::move(field_iter->second);
-    std::vector<double> data = std::move( field.data );
+    std::vector<double> data = field.constant ? field.view().to_vector() : std::move( field.data );
     this->double_data.erase( field_iter );
     return data;
 }
 
 
+std::vector<Fieldprops::MemoryUsage> FieldProps::memory_usage() const {
+    std::vector<Fieldprops::MemoryUsage> usage;
+    for (const auto& [key, field] : this->int_data)
+        usage.push_back({key, field.memory_usage(), field.constant.has_value()});
+
+    for (const auto& [key, field] : this->double_data)
+        usage.push_back({key, field.memory_usage(), field.constant.has_value()});
+
+    std::sort(usage.begin(), usage.end(),
+              [](const Fieldprops::MemoryUsage& u1, const Fieldprops::MemoryUsage& u2)
+              {
+                  return (u1.bytes > u2.bytes) || ((u1.bytes == u2.bytes) && (u1.keyword < u2.keyword));
+              });
+
+    return usage;
+}
+
+
 
 
 
@@ -858,30 +950,40 @@ double FieldProps::getSIValue(ScalarOperation op, const std::string& keyword, do
 
 
 void FieldProps::handle_int_keyword(const Fieldprops::keywords::keyword_info<int>& kw_info, const DeckKeyword& keyword, const Box& box) {
-    auto& field_data = this->init_get<int>(keyword.name());
+    auto& field_data = this->lazy_get<int>(keyword.name());
     const auto& deck_data = keyword.getIntData();
     const auto& deck_status = keyword.getValueStatus();
+    if (assign_deck_constant(keyword, field_data, deck_data, deck_status, box))
+        return;
+
+    field_data.materialize();
     assign_deck(kw_info, keyword, field_data, deck_data, deck_status, box);
 }
 
 
 void FieldProps::handle_double_keyword(Section section, const Fieldprops::keywords::keyword_info<double>& kw_info, const DeckKeyword& keyword, const std::string& keyword_name, const Box& box) {
-    auto& field_data = this->init_get<double>(keyword_name, kw_info);
+    auto& field_data = this->lazy_get<double>(keyword_name, kw_info);
     const auto& deck_data = keyword.getSIDoubleData();
     const auto& deck_status = keyword.getValueStatus();
 
-    if ((section == Section::EDIT || section == Section::SCHEDULE) && kw_info.multiplier)
+    if ((section == Section::EDIT || section == Section::SCHEDULE) && kw_info.multiplier) {
+        field_data.materialize();
         multiply_deck(kw_info, keyword, field_data, deck_data, deck_status, box);
-    else
+    }
+    else if (! assign_deck_constant(keyword, field_data, deck_data, deck_status, box)) {
+        field_data.materialize();
         assign_deck(kw_info, keyword, field_data, deck_data, deck_status, box);
+    }
 
 
     if (section == Section::GRID) {
         if (field_data.valid())
             return;
 
-        if (kw_info.top)
+        if (kw_info.top) {
+            field_data.materialize();
             this->distribute_toplayer(field_data, deck_data, box);
+        }
     }
 }
 
@@ -1065,8 +1167,11 @@ void FieldProps::handle_operation(const DeckKeyword& keyword, Box box) {
             } else
                 kw_info = Fieldprops::keywords::global_kw_info<double>(target_kw);
 
-            auto& field_data = this->init_get<double>(unique_name, kw_info);
+            auto& field_data = this->lazy_get<double>(unique_name, kw_info);
+            if (apply_constant(operation, field_data, scalar_value, box))
+                continue;
 
+            field_data.materialize();
             FieldProps::apply(operation, field_data.data, field_data.value_status, scalar_value, box.index_list());
             if (field_data.global_data)
                 FieldProps::apply(operation, *field_data.global_data, *field_data.global_value_status, scalar_value, box.global_index_list());
@@ -1077,7 +1182,11 @@ void FieldProps::handle_operation(const DeckKeyword& keyword, Box box) {
 
         if (FieldProps::supported<int>(target_kw)) {
             int scalar_value = static_cast<int>(record.getItem(1).get<double>(0));
-            auto& field_data = this->init_get<int>(target_kw);
+            auto& field_data = this->lazy_get<int>(target_kw);
+            if (apply_constant(fromString(keyword.name()), field_data, scalar_value, box))
+                continue;
+
+            field_data.materialize();
             FieldProps::apply(fromString(keyword.name()), field_data.data, field_data.value_status, scalar_value, box.index_list());
             continue;
         }
@@ -1321,7 +1430,7 @@ void FieldProps::scanGRIDSectionOnlyACTNUM(const GRIDSection& grid_section) {
     if (iter == this->int_data.end()) {
         m_actnum.assign(this->grid_ptr->getCartesianSize(), 1);
     } else {
-        m_actnum = iter->second.data;
+        m_actnum = iter->second.view().to_vector();
     }
 }
 
@@ -1437,7 +1546,7 @@ void FieldProps::handle_schedule_keywords(const std::vector<DeckKeyword>& keywor
     for (const auto& [kw, _] : Fieldprops::keywords::SCHEDULE::double_keywords) {
         (void)_;
         if (this->has<double>(kw)) {
-            auto& field_data = this->init_get<double>(kw);
+            auto& field_data = this->lazy_get<double>(kw);
             field_data.default_assign(1.0);
         }
     }
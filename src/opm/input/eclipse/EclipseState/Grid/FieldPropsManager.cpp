@@ -88,6 +88,18 @@ FieldPropsManager::get_double_field_data(const std::string& keyword,
     throw std::out_of_range("Invalid field data requested.");
 }
 
+Fieldprops::FieldView<int> FieldPropsManager::get_int_view(const std::string& keyword) const {
+    return this->fp->get_view<int>(keyword);
+}
+
+Fieldprops::FieldView<double> FieldPropsManager::get_double_view(const std::string& keyword) const {
+    return this->fp->get_view<double>(keyword);
+}
+
+std::vector<Fieldprops::MemoryUsage> FieldPropsManager::memory_usage() const {
+    return this->fp->memory_usage();
+}
+
 template <typename T>
 std::vector<T> FieldPropsManager::get_global(const std::string& keyword) const {
     return this->fp->get_global<T>(keyword);
@@ -168,32 +180,34 @@ void apply_tran(const std::unordered_map<std::string, Fieldprops::TranCalculator
 {
     const auto& calculator = tran.at(keyword);
     for (const auto& action : calculator) {
-        const auto& action_data = double_data.at(action.field);
+        const auto& field_data = double_data.at(action.field);
+        const auto action_data = field_data.view();
+        const auto action_status = field_data.status_view();
 
         for (std::size_t index = 0; index < active_size; index++) {
 
-            if (!value::has_value(action_data.value_status[index]))
+            if (!value::has_value(action_status[index]))
                 continue;
 
             switch (action.op) {
             case Fieldprops::ScalarOperation::EQUAL:
-                data[index] = action_data.data[index];
+                data[index] = action_data[index];
                 break;
 
             case Fieldprops::ScalarOperation::MUL:
-                data[index] *= action_data.data[index];
+                data[index] *= action_data[index];
                 break;
 
             case Fieldprops::ScalarOperation::ADD:
-                data[index] += action_data.data[index];
+                data[index] += action_data[index];
                 break;
 
             case Fieldprops::ScalarOperation::MAX:
-                data[index] = std::min(action_data.data[index], data[index]);
+                data[index] = std::min(action_data[index], data[index]);
                 break;
 
             case Fieldprops::ScalarOperation::MIN:
-                data[index] = std::max(action_data.data[index], data[index]);
+                data[index] = std::max(action_data[index], data[index]);
                 break;
 
             default:
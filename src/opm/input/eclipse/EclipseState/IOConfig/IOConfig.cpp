@@ -101,6 +101,7 @@ namespace Opm {
         result.m_nosim = true;
         result.m_base_name = "test3";
         result.ecl_compatible_rst = false;
+        result.m_esmry_layout = ExtSmryLayout::Chunked;
 
         return result;
     }
@@ -179,6 +180,16 @@ namespace Opm {
     }
 
 
+    ExtSmryLayout IOConfig::getEsmryLayout() const {
+        return this->m_esmry_layout;
+    }
+
+
+    void IOConfig::setEsmryLayout(ExtSmryLayout layout) {
+        this->m_esmry_layout = layout;
+    }
+
+
     void IOConfig::overrideNOSIM(bool nosim) {
         m_nosim = nosim;
     }
@@ -298,7 +309,8 @@ namespace Opm {
                this->getOutputDir() == data.getOutputDir() &&
                this->initOnly() == data.initOnly() &&
                this->getBaseName() == data.getBaseName() &&
-               this->getEclCompatibleRST() == data.getEclCompatibleRST();
+               this->getEclCompatibleRST() == data.getEclCompatibleRST() &&
+               this->getEsmryLayout() == data.getEsmryLayout();
     }
 
 
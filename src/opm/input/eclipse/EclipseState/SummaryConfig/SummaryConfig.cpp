@@ -1881,8 +1881,9 @@ const SummaryConfigNode& SummaryConfig::operator[](std::size_t index) const {
 
 
 bool SummaryConfig::match(const std::string& keywordPattern) const {
+    const auto pattern = ShellPattern { keywordPattern };
     for (const auto& keyword : this->short_keywords) {
-        if (shmatch(keywordPattern, keyword))
+        if (pattern.match(keyword))
             return true;
     }
     return false;
@@ -1892,11 +1893,12 @@ SummaryConfig::keyword_list
 SummaryConfig::keywords(const std::string& keywordPattern) const
 {
     auto kw_list = keyword_list{};
+    const auto pattern = ShellPattern { keywordPattern };
 
     std::copy_if(this->m_keywords.begin(), this->m_keywords.end(),
                  std::back_inserter(kw_list),
-                 [&keywordPattern](const auto& kw)
-                 { return shmatch(keywordPattern, kw.keyword()); });
+                 [&pattern](const auto& kw)
+                 { return pattern.match(kw.keyword()); });
 
     return kw_list;
 }
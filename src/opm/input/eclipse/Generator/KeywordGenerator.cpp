@@ -17,17 +17,23 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <filesystem>
 #include <iostream>
+#include <map>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <cctype>
+#include <vector>
 #include <fmt/format.h>
 
 #include <opm/json/JsonObject.hpp>
 #include <opm/input/eclipse/Generator/KeywordGenerator.hpp>
 #include <opm/input/eclipse/Generator/KeywordLoader.hpp>
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
 
@@ -185,51 +191,61 @@ void Builtin::emplace{}() const {{
     void KeywordGenerator::updateInitSource(const KeywordLoader& loader , const std::string& sourceFile,
                                             const std::string& sourcePath ) const {
         std::filesystem::path parserInitSource(sourceFile);
-        std::string stem = parserInitSource.stem();
-        std::filesystem::path parentPath = parserInitSource.parent_path();
         std::stringstream newSource;
         newSource << R"(
-#include <opm/input/eclipse/Parser/Parser.hpp>
-#include <opm/input/eclipse/Parser/ParserKeywords/Builtin.hpp>
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
 )";
 
+        // Keyword descriptors pr. first character, and the descriptor
+        // referenced by each deck name.  Later keywords take precedence
+        // for duplicate deck names, as when adding keywords to a Parser.
+        std::vector<std::string> keyword_refs;
+        std::map<std::string, std::string> deck_names;
+
         for(const auto& kw_pair : loader) {
             const auto& first_char = kw_pair.first;
+            const auto& keywords = kw_pair.second;
             const std::string header = fmt::format(R"(
 #ifndef OPM_PARSER_INIT_{0}_HH
 #define OPM_PARSER_INIT_{0}_HH
 
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
+
 namespace Opm {{
-class Parser;
 namespace ParserKeywords {{
-void addDefaultKeywords{0}(Parser& p);
+extern const BuiltinKeywordTable::Keyword builtinKeywords{0}[{1}];
 }}
 }}
 #endif
 )",
-                                                   first_char);
+                                                   first_char, keywords.size());
             auto charHeaderFile = parserInitSource;
             charHeaderFile.replace_filename(
                 fmt::format("include/opm/input/eclipse/Parser/ParserKeywords/ParserInit{}.hpp", first_char));
             write_file(header, charHeaderFile, m_verbose, fmt::format("init header for {}", first_char));
             std::stringstream sourceStr;
             sourceStr << fmt::format(R"(
-#include <opm/input/eclipse/Parser/Parser.hpp>
-#include<opm/input/eclipse/Parser/ParserKeywords/ParserInit{0}.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/ParserInit{0}.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/{0}.hpp>
 
 namespace Opm {{
 namespace ParserKeywords {{
-void addDefaultKeywords{0}([[maybe_unused]] Parser& p){{
-    //Builtin keywords;
+const BuiltinKeywordTable::Keyword builtinKeywords{0}[{1}] = {{
 )",
-                                     first_char);
-                const auto& keywords = kw_pair.second;
-                for (const auto& kw : keywords)
-                    sourceStr << fmt::format("    p.addParserKeyword( {}() );", kw.className()) << std::endl;
-            sourceStr << R"(
-
-}
+                                     first_char, keywords.size());
+                for (std::size_t i = 0; i < keywords.size(); ++i) {
+                    const auto& kw = keywords[i];
+                    const auto code_end = kw.isCodeKeyword() ? kw.codeEnd() : std::string{};
+                    sourceStr << fmt::format("    {{ {}, \"{}\", \"{}\", {}, &createBuiltinKeyword<{}> }},",
+                                             keyword_refs.size(), kw.getName(), code_end,
+                                             kw.hasMatchRegex(), kw.className()) << std::endl;
+
+                    const auto ref = fmt::format("&builtinKeywords{}[{}]", first_char, i);
+                    keyword_refs.push_back(ref);
+                    for (const auto& deck_name : kw.deck_names())
+                        deck_names[deck_name] = ref;
+                }
+            sourceStr << R"(};
 }
 }
 )";
@@ -240,25 +256,89 @@ void addDefaultKeywords{0}([[maybe_unused]] Parser& p){{
                                      first_char);
         }
 
+        // Perfect hash of the deck names.  Buckets are placed in order of
+        // decreasing size, searching for a seed which maps all names of the
+        // bucket to distinct free slots.
+        const std::size_t num_slots = deck_names.size() + deck_names.size() / 8 + 1;
+        const std::size_t num_seeds = deck_names.size() / 4 + 1;
+
+        std::vector<std::vector<std::string>> buckets(num_seeds);
+        for (const auto& [deck_name, ref] : deck_names)
+            buckets[BuiltinKeywordTable::hash(deck_name, 0) % num_seeds].push_back(deck_name);
+
+        std::vector<std::size_t> bucket_order(num_seeds);
+        std::iota(bucket_order.begin(), bucket_order.end(), std::size_t{0});
+        std::stable_sort(bucket_order.begin(), bucket_order.end(),
+                         [&buckets](std::size_t b1, std::size_t b2)
+                         { return buckets[b1].size() > buckets[b2].size(); });
+
+        std::vector<std::uint32_t> seeds(num_seeds, 0);
+        std::vector<std::string> slots(num_slots);
+        for (const auto b : bucket_order) {
+            const auto& bucket = buckets[b];
+            if (bucket.empty())
+                break;
+
+            std::vector<std::size_t> bucket_slots;
+            std::uint32_t seed = 1;
+            for (; seed < (1U << 24); ++seed) {
+                bucket_slots.clear();
+                for (const auto& deck_name : bucket) {
+                    const auto slot = BuiltinKeywordTable::hash(deck_name, seed) % num_slots;
+                    if (!slots[slot].empty() ||
+                        std::find(bucket_slots.begin(), bucket_slots.end(), slot) != bucket_slots.end())
+                        break;
+
+                    bucket_slots.push_back(slot);
+                }
+
+                if (bucket_slots.size() == bucket.size())
+                    break;
+            }
+
+            if (bucket_slots.size() != bucket.size())
+                throw std::runtime_error("Failed to create perfect hash of builtin keyword names");
+
+            seeds[b] = seed;
+            for (std::size_t i = 0; i < bucket.size(); ++i)
+                slots[bucket_slots[i]] = bucket[i];
+        }
+
         newSource << R"(
 namespace Opm {
 namespace ParserKeywords {
-void addDefaultKeywords(Parser& p);
-void addDefaultKeywords(Parser& p) {
+namespace {
+const BuiltinKeywordTable::Keyword* const keywords[] = {
 )";
-
-        for(const auto& [first_char, keywords] : loader) {
-                newSource << fmt::format("    addDefaultKeywords{}(p);", first_char) << std::endl;
+        for (const auto& ref : keyword_refs)
+            newSource << fmt::format("    {},", ref) << std::endl;
+
+        newSource << "};\n\nconst std::uint32_t seeds[] = {\n";
+        for (const auto seed : seeds)
+            newSource << fmt::format("    {},", seed) << std::endl;
+
+        newSource << "};\n\nconst BuiltinKeywordTable::Slot slots[] = {\n";
+        for (const auto& deck_name : slots) {
+            if (deck_name.empty())
+                newSource << "    { {}, nullptr }," << std::endl;
+            else
+                newSource << fmt::format("    {{ \"{}\", {} }},", deck_name, deck_names.at(deck_name)) << std::endl;
         }
 
-        newSource << R"(
-}
-}
-void Parser::addDefaultKeywords() {
-    ParserKeywords::addDefaultKeywords(*this);
-}
-}
-)";
+        newSource << fmt::format(R"(}};
+}}
+
+const BuiltinKeywordTable& builtinKeywordTable()
+{{
+    static const BuiltinKeywordTable table {{
+        keywords, {}, seeds, {}, slots, {}, {}
+    }};
+
+    return table;
+}}
+}}
+}}
+)", keyword_refs.size(), num_seeds, num_slots, deck_names.size());
 
         write_file(newSource, sourceFile, m_verbose, "init");
     }
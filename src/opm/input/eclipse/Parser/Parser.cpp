@@ -23,6 +23,7 @@
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
@@ -58,11 +59,15 @@
 #include "raw/StarToken.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstdio>
+#include <exception>
 #include <filesystem>
 #include <iostream>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stack>
 #include <stdexcept>
@@ -73,6 +78,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace {
     /// \brief Whether a keyword is a global keyword.
     ///
@@ -1053,7 +1062,14 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
 
             if (str::isTerminatedRecordString(record_buffer)) {
                 std::size_t size = std::distance(record_buffer.begin(), record_buffer.end()) - 1;
-                RawRecord record( std::string_view{ record_buffer.begin(), size }, rawKeyword->location());
+                std::string_view record_string{ record_buffer.begin(), size };
+
+                // Data records, which may be huge, are not split into items
+                // here.  ParserRecord::parse() scans numeric data directly,
+                // possibly on a worker thread, see PendingDataKeywords.
+                RawRecord record = parserKeyword->isDataKeyword()
+                    ? RawRecord( record_string, RawRecord::DeferTokenize{} )
+                    : RawRecord( record_string, rawKeyword->location() );
                 if (rawKeyword->addRecord(record))
                     return rawKeyword;
 
@@ -1088,7 +1104,141 @@ std::string_view advance_parser_state( ParserState& parserState, const std::stri
     return line;
 }
 
-bool parseState( ParserState& parserState, const Parser& parser ) {
+void logReadingKeyword(const RawKeyword& rawKeyword, const std::size_t deck_index)
+{
+    const auto& location = rawKeyword.location();
+    auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", deck_index, rawKeyword.getKeywordName(), location.filename, location.lineno);
+    OpmLog::info(msg);
+}
+
+[[noreturn]] void rethrowParseError(const std::exception& e, const RawKeyword& rawKeyword)
+{
+    /*
+      This catch-all of parsing errors is to be able to write a good
+      error message; the parser is quite confused at this state and
+      we should not be tempted to continue the parsing.
+
+      We log a error message with the name of the problematic
+      keyword and the location in the input deck. We rethrow the
+      same exception without updating the what() message of the
+      exception.
+    */
+    const OpmInputError opm_error { e, rawKeyword.location() } ;
+
+    OpmLog::error(opm_error.what());
+
+    std::throw_with_nested(opm_error);
+}
+
+/*
+  Large data keywords, e.g. COORD, ZCORN and PERMX, which have been read
+  but not yet converted to DeckKeywords.  Consecutive keywords of this
+  kind--also across INCLUDE files--are collected and then tokenized and
+  converted concurrently when the next keyword of any other kind is
+  encountered.  The results are added to the deck in input order, and the
+  first failing keyword in input order determines the error reported, so
+  the resulting deck and diagnostics do not depend on the number of
+  threads.
+
+  Conversion of data keywords does not consult the ParseContext; the
+  single data item consumes the whole record.  The unit systems are only
+  read through private copies, after all dimensions used by the pending
+  keywords have been resolved in the deck's unit systems on the calling
+  thread.
+*/
+class PendingDataKeywords {
+public:
+    // Smaller keywords are converted immediately.
+    static constexpr std::size_t min_data_size = 64 * 1024;
+
+    PendingDataKeywords() {
+#ifdef _OPENMP
+        this->enabled = omp_get_max_threads() > 1;
+#endif
+    }
+
+    bool accepts(const RawKeyword& rawKeyword, const ParserKeyword& parserKeyword) const {
+        return this->enabled
+            && parserKeyword.isDataKeyword()
+            && (rawKeyword.dataSize() >= min_data_size);
+    }
+
+    void add(std::unique_ptr<RawKeyword> rawKeyword, const ParserKeyword& parserKeyword) {
+        this->pending.push_back({ std::move(rawKeyword), &parserKeyword, std::nullopt, nullptr });
+    }
+
+    std::size_t size() const {
+        return this->pending.size();
+    }
+
+    void flush(ParserState& parserState);
+
+private:
+    struct Pending {
+        std::unique_ptr<RawKeyword> raw;
+        const ParserKeyword* parserKeyword;
+        std::optional<DeckKeyword> keyword;
+        std::exception_ptr error;
+    };
+
+    bool enabled = false;
+    std::vector<Pending> pending;
+};
+
+void PendingDataKeywords::flush(ParserState& parserState) {
+    if (this->pending.empty())
+        return;
+
+    auto& active_unitsystem = parserState.deck.getActiveUnitSystem();
+    auto& default_unitsystem = parserState.deck.getDefaultUnitSystem();
+    for (const auto& kw : this->pending) {
+        for (const auto& item : kw.parserKeyword->getRecord(0)) {
+            if ((item.dataType() != type_tag::fdouble) && (item.dataType() != type_tag::uda))
+                continue;
+
+            for (const auto& dim_string : item.dimensions()) {
+                active_unitsystem.getNewDimension(dim_string);
+                default_unitsystem.getNewDimension(dim_string);
+            }
+        }
+    }
+
+    const auto num_pending = static_cast<int>(this->pending.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num_pending; ++i) {
+        auto& kw = this->pending[i];
+        try {
+            auto active = active_unitsystem;
+            auto dflt = default_unitsystem;
+
+            kw.keyword = kw.parserKeyword->parse(parserState.parseContext,
+                                                 parserState.errors,
+                                                 *kw.raw, active, dflt);
+        } catch (...) {
+            kw.error = std::current_exception();
+        }
+    }
+
+    auto pending_keywords = std::move(this->pending);
+    this->pending.clear();
+
+    for (auto& kw : pending_keywords) {
+        if (kw.error) {
+            try {
+                std::rethrow_exception(kw.error);
+            } catch (const OpmInputError&) {
+                throw;
+            } catch (const std::exception& e) {
+                rethrowParseError(e, *kw.raw);
+            }
+        }
+
+        parserState.deck.addKeyword(std::move(*kw.keyword));
+    }
+}
+
+bool parseKeywords( ParserState& parserState, const Parser& parser, PendingDataKeywords& pending ) {
     std::string filename = parserState.current_path().string();
 
     auto ignore = parserState.get_ignore();
@@ -1110,6 +1260,22 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if( !rawKeyword )
             continue;
 
+        if (parser.isRecognizedKeyword(rawKeyword->getKeywordName())) {
+            const auto& parserKeyword = parser.getParserKeywordFromDeckName( rawKeyword->getKeywordName() );
+            if (pending.accepts(*rawKeyword, parserKeyword)) {
+                logReadingKeyword(*rawKeyword, parserState.deck.size() + pending.size());
+                pending.add(std::move(rawKeyword), parserKeyword);
+                continue;
+            }
+        }
+
+        // INCLUDE, ENDINC and PATHS do not add to the deck, so pending
+        // data keywords may continue across INCLUDE files.
+        if ((rawKeyword->getKeywordName() != Opm::RawConsts::include) &&
+            (rawKeyword->getKeywordName() != Opm::RawConsts::endinclude) &&
+            (rawKeyword->getKeywordName() != Opm::RawConsts::paths))
+            pending.flush(parserState);
+
         std::string_view keyw = rawKeyword->getKeywordName();
 
         if ((ignore_grid) && (keyw=="GRID"))
@@ -1164,11 +1330,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if( parser.isRecognizedKeyword( rawKeyword->getKeywordName() ) ) {
             const auto& kwname = rawKeyword->getKeywordName();
             const auto& parserKeyword = parser.getParserKeywordFromDeckName( kwname );
-            {
-                const auto& location = rawKeyword->location();
-                auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
-                OpmLog::info(msg);
-            }
+            logReadingKeyword(*rawKeyword, parserState.deck.size());
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
                     if (parserState.python) {
@@ -1198,21 +1360,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             } catch (const OpmInputError& opm_error) {
                 throw;
             } catch (const std::exception& e) {
-                /*
-                  This catch-all of parsing errors is to be able to write a good
-                  error message; the parser is quite confused at this state and
-                  we should not be tempted to continue the parsing.
-
-                  We log a error message with the name of the problematic
-                  keyword and the location in the input deck. We rethrow the
-                  same exception without updating the what() message of the
-                  exception.
-                */
-                const OpmInputError opm_error { e, rawKeyword->location() } ;
-
-                OpmLog::error(opm_error.what());
-
-                std::throw_with_nested(opm_error);
+                rethrowParseError(e, *rawKeyword);
             }
         } else {
             const std::string msg = "The keyword " + rawKeyword->getKeywordName() + " is not recognized - ignored";
@@ -1224,6 +1372,21 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     return true;
 }
 
+bool parseState( ParserState& parserState, const Parser& parser ) {
+    PendingDataKeywords pending;
+
+    try {
+        const auto status = parseKeywords(parserState, parser, pending);
+        pending.flush(parserState);
+        return status;
+    } catch (...) {
+        // Errors in pending keywords, which precede the failing keyword in
+        // the input, take precedence.
+        pending.flush(parserState);
+        throw;
+    }
+}
+
 }
 
 
@@ -1235,15 +1398,59 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                  str::find_terminator( str.begin(), str.end(), str::find_comment() ) };
     }
 
-    Parser::Parser(bool addDefault) {
-        // The addDefaultKeywords() method is implemented in a source file
-        // ${PROJECT_BINARY_DIR}/ParserInit.cpp which is generated by the build
-        // system.
+    struct Parser::BuiltinKeywords
+    {
+        explicit BuiltinKeywords(const BuiltinKeywordTable& table_arg)
+            : table(table_arg)
+            , created(std::make_unique<std::atomic<const ParserKeyword*>[]>(table.num_keywords))
+        {}
+
+        // Keywords may be requested concurrently, e.g., from parallel
+        // conversion of data keywords.
+        const ParserKeyword& get(const BuiltinKeywordTable::Keyword& keyword)
+        {
+            auto& ptr = this->created[keyword.index];
+            if (const auto* kw = ptr.load(std::memory_order_acquire); kw != nullptr)
+                return *kw;
+
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (const auto* kw = ptr.load(std::memory_order_relaxed); kw != nullptr)
+                return *kw;
+
+            this->storage.push_back(keyword.create());
+            ptr.store(&this->storage.back(), std::memory_order_release);
+            return this->storage.back();
+        }
+
+        const BuiltinKeywordTable& table;
+        std::unique_ptr<std::atomic<const ParserKeyword*>[]> created;
+        std::mutex mutex;
+        std::list<ParserKeyword> storage;
+    };
 
+    Parser::Parser(bool addDefault) {
         if (addDefault)
             this->addDefaultKeywords();
     }
 
+    void Parser::addDefaultKeywords() {
+        // The keyword table is implemented in a source file
+        // ${PROJECT_BINARY_DIR}/ParserInit.cpp which is generated by the build
+        // system.  Only keywords matched by regular expressions are created
+        // up front, the others when first looked up.
+        const auto& table = ParserKeywords::builtinKeywordTable();
+        this->builtin_keywords = std::make_shared<BuiltinKeywords>(table);
+
+        for (std::size_t i = 0; i < table.num_keywords; ++i) {
+            const auto& keyword = *table.keywords[i];
+            if (keyword.wildcard)
+                m_wildCardKeywords[keyword.name] = &this->builtin_keywords->get(keyword);
+
+            if (! keyword.code_end.empty())
+                this->code_keywords.emplace_back(keyword.name, keyword.code_end);
+        }
+    }
+
 
     /*
      About INCLUDE: Observe that the ECLIPSE parser is slightly unlogical
@@ -1375,7 +1582,36 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     }
 
     size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        auto num_names = m_deckParserKeywords.size();
+        if (this->builtin_keywords) {
+            const auto& table = this->builtin_keywords->table;
+            num_names += table.num_deck_names;
+            for (const auto& [deck_name, keyword] : m_deckParserKeywords) {
+                if (table.find(deck_name) != nullptr)
+                    --num_names;
+            }
+        }
+
+        return num_names;
+    }
+
+    bool Parser::hasDeckName(std::string_view name) const {
+        return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+            || (this->builtin_keywords && (this->builtin_keywords->table.find(name) != nullptr));
+    }
+
+    const ParserKeyword* Parser::findKeyword(std::string_view name) const {
+        auto candidate = m_deckParserKeywords.find(name);
+        if (candidate != m_deckParserKeywords.end())
+            return candidate->second;
+
+        if (this->builtin_keywords) {
+            const auto* keyword = this->builtin_keywords->table.find(name);
+            if (keyword != nullptr)
+                return &this->builtin_keywords->get(*keyword);
+        }
+
+        return nullptr;
     }
 
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const {
@@ -1396,14 +1632,14 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             return false;
         }
 
-        return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+        return this->hasDeckName(name)
             || (this->matchingKeyword(name) != nullptr);
     }
 
     bool Parser::isBaseRecognizedKeyword(std::string_view name) const
     {
         return ParserKeyword::validDeckName(name)
-            && (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end());
+            && this->hasDeckName(name);
     }
 
 void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
@@ -1446,8 +1682,7 @@ void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
 }
 
 bool Parser::hasKeyword( const std::string& name ) const {
-    return this->m_deckParserKeywords.find( std::string_view( name ) )
-        != this->m_deckParserKeywords.end();
+    return this->hasDeckName( name );
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1455,9 +1690,9 @@ const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
 }
 
 const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view& name ) const {
-    auto candidate = m_deckParserKeywords.find( name );
+    const auto* candidate = this->findKeyword( name );
 
-    if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
+    if( candidate != nullptr ) return *candidate;
 
     const auto* wildCardKeyword = matchingKeyword( name );
 
@@ -1472,6 +1707,15 @@ std::vector<std::string> Parser::getAllDeckNames () const {
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
+    if (this->builtin_keywords) {
+        const auto& table = this->builtin_keywords->table;
+        for (std::size_t i = 0; i < table.num_slots; ++i) {
+            const auto& deck_name = table.slots[i].deck_name;
+            if ((table.slots[i].keyword != nullptr) && (m_deckParserKeywords.count(deck_name) == 0))
+                keywords.emplace_back(deck_name);
+        }
+        std::sort(keywords.begin(), keywords.end());
+    }
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
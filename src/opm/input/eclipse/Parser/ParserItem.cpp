@@ -17,10 +17,14 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <charconv>
 #include <ostream>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <string_view>
+#include <system_error>
 
 #include <opm/json/JsonObject.hpp>
 
@@ -29,6 +33,7 @@
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include "raw/RawConsts.hpp"
 #include "raw/RawRecord.hpp"
 #include "raw/StarToken.hpp"
 
@@ -455,8 +460,67 @@ std::string ParserItem::createCode(const std::string& indent) const {
 
 namespace {
 
+/// Scans a single token, possibly of the form N*value, of an item
+/// consuming the rest of the record.
+template< typename T >
+void scan_token( DeckItem& deck_item, const ParserItem& parser_item, std::string_view token ) {
+    std::string_view countString;
+    std::string_view valueString;
+
+    if( !isStarToken( token, countString, valueString ) ) {
+        deck_item.push_back( readValueToken< T >( token ) );
+        return;
+    }
+
+    // Common case N*value with N > 0 without creating a StarToken.
+    if( !countString.empty() && !valueString.empty() ) {
+        int count = 0;
+        const auto [ptr, ec] = std::from_chars( countString.data(), countString.data() + countString.size(), count );
+        if( (ec == std::errc{}) && (ptr == countString.data() + countString.size()) && (count > 0) ) {
+            deck_item.push_back( readValueToken< T >( valueString ), count );
+            return;
+        }
+    }
+
+    StarToken st(token, std::string(countString), std::string(valueString));
+
+    if( st.hasValue() ) {
+        deck_item.push_back( readValueToken< T >( st.valueString() ), st.count() );
+        return;
+    }
+
+    if (parser_item.hasDefault()) {
+        auto value = parser_item.getDefault< T >();
+        deck_item.push_backDefault( value, st.count());
+    } else {
+        deck_item.push_backDummyDefault<T>(st.count());
+    }
+}
+
+/// Scans all values of a numeric data item directly from the string of a
+/// record which has not been split into items.  Equivalent to splitting
+/// the record and scanning all the items, but without materialising the
+/// list of items.  Quoted items are not supported.
+template< typename T >
+void scan_record_string( DeckItem& deck_item, const ParserItem& parser_item, std::string_view record ) {
+    const auto is_separator = RawConsts::is_separator();
+    const auto end = record.end();
+
+    auto current = std::find_if_not( record.begin(), end, is_separator );
+    while( current != end ) {
+        const auto token_end = std::find_if( current, end, is_separator );
+        scan_token< T >( deck_item, parser_item, { &*current, static_cast<std::size_t>( token_end - current ) } );
+        current = std::find_if_not( token_end, end, is_separator );
+    }
+}
+
 template< typename T >
 void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
+    if( !record.isTokenized() ) {
+        scan_record_string< T >( deck_item, parser_item, record.getRecordView() );
+        return;
+    }
+
     bool parse_raw = parser_item.parseRaw();
 
     if( parser_item.sizeType() == ParserItem::item_size::ALL ) {
@@ -470,31 +534,8 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
             return;
         }
 
-        while( record.size() > 0 ) {
-            auto token = record.pop_front();
-
-            std::string countString;
-            std::string valueString;
-
-            if( !isStarToken( token, countString, valueString ) ) {
-                deck_item.push_back( readValueToken< T >( token ) );
-                continue;
-            }
-
-            StarToken st(token, countString, valueString);
-
-            if( st.hasValue() ) {
-                deck_item.push_back( readValueToken< T >( st.valueString() ), st.count() );
-                continue;
-            }
-
-            if (parser_item.hasDefault()) {
-                auto value = parser_item.getDefault< T >();
-                deck_item.push_backDefault( value, st.count());
-            } else {
-                deck_item.push_backDummyDefault<T>(st.count());
-            }
-        }
+        while( record.size() > 0 )
+            scan_token< T >( deck_item, parser_item, record.pop_front() );
 
         return;
     }
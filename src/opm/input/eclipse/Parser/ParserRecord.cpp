@@ -28,6 +28,7 @@
 
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 
+#include "raw/RawConsts.hpp"
 #include "raw/RawRecord.hpp"
 
 #include <ostream>
@@ -42,6 +43,22 @@ namespace {
             return x.name() == this->name;
         }
     };
+
+    /*
+      Numeric data records without quotes are scanned directly from the
+      record string by ParserItem::scan(), all other records are split
+      into items first.
+    */
+    bool scan_record_string(const ParserRecord& parserRecord, const RawRecord& rawRecord) {
+        if (!parserRecord.isDataRecord())
+            return false;
+
+        const auto data_type = parserRecord.get(0).dataType();
+        if ((data_type != type_tag::integer) && (data_type != type_tag::fdouble))
+            return false;
+
+        return rawRecord.getRecordView().find(RawConsts::quote) == std::string_view::npos;
+    }
 }
 
     ParserRecord::ParserRecord()
@@ -124,6 +141,9 @@ namespace {
     }
 
     DeckRecord ParserRecord::parse(const ParseContext& parseContext , ErrorGuard& errors , RawRecord& rawRecord, UnitSystem& active_unitsystem, UnitSystem& default_unitsystem, const KeywordLocation& location) const {
+        if (!rawRecord.isTokenized() && !scan_record_string(*this, rawRecord))
+            rawRecord.tokenize(location);
+
         std::vector< DeckItem > items;
         items.reserve( this->size() );
         for( const auto& parserItem : *this )
@@ -177,6 +177,15 @@ namespace {
     }
 
 
+    std::size_t RawKeyword::dataSize() const {
+        std::size_t data_size = 0;
+        for (const auto& record : this->m_records)
+            data_size += record.recordStringSize();
+
+        return data_size;
+    }
+
+
     bool RawKeyword::can_complete() const {
         if (this->m_sizeType == Raw::UNKNOWN)
             return true;
@@ -54,6 +54,9 @@ namespace Opm {
         const KeywordLocation& location() const;
         bool can_complete() const;
 
+        // Total number of characters in all record strings.
+        std::size_t dataSize() const;
+
         using const_iterator = std::vector< RawRecord >::const_iterator;
         using iterator = std::vector< RawRecord >::iterator;
 
@@ -101,6 +101,23 @@ inline bool even_quotes( const T& str ) {
         RawRecord(singleRecordString, location, false)
     {}
 
+    RawRecord::RawRecord(const std::string_view& singleRecordString, DeferTokenize) :
+        m_sanitizedRecordString( singleRecordString ),
+        m_max_size( 0 ),
+        m_tokenized( false )
+    {}
+
+    void RawRecord::tokenize(const KeywordLocation& location) {
+        if (this->m_tokenized)
+            return;
+
+        *this = RawRecord(this->m_sanitizedRecordString, location, false);
+    }
+
+    std::size_t RawRecord::recordStringSize() const {
+        return this->m_sanitizedRecordString.size();
+    }
+
     void RawRecord::push_front( std::string_view tok, std::size_t count ) {
         this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
         this->m_max_size += count;
@@ -38,6 +38,26 @@ class KeywordLocation;
         RawRecord( const std::string_view&, const KeywordLocation&, bool text);
         explicit RawRecord( const std::string_view&, const KeywordLocation&);
 
+        /// Tag type for records whose splitting into items is deferred
+        /// until tokenize() is called.  Used for data records which may
+        /// then be split on a worker thread, or scanned directly without
+        /// splitting.  The record has no items until it is tokenized.
+        struct DeferTokenize {};
+        RawRecord( const std::string_view&, DeferTokenize );
+
+        /// Split deferred record into items.  No-op for records which are
+        /// already split.
+        void tokenize( const KeywordLocation& );
+
+        /// Whether the record has been split into items.
+        bool isTokenized() const { return this->m_tokenized; }
+
+        /// Record string without copying.
+        std::string_view getRecordView() const { return this->m_sanitizedRecordString; }
+
+        /// Number of characters in the record string.
+        std::size_t recordStringSize() const;
+
         inline std::string_view pop_front();
         inline std::string_view front() const;
         void push_front( std::string_view token, std::size_t count );
@@ -51,6 +71,7 @@ class KeywordLocation;
         std::string_view m_sanitizedRecordString;
         std::deque< std::string_view > m_recordItems;
         std::size_t m_max_size;
+        bool m_tokenized = true;
     };
 
     /*
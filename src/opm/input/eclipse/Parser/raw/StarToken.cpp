@@ -20,9 +20,11 @@
 #include <array>
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <string>
 #include <stdexcept>
 #include <cstdlib>
+#include <system_error>
 
 #include <boost/spirit/include/qi.hpp>
 
@@ -35,18 +37,19 @@ namespace qi = boost::spirit::qi;
 namespace Opm {
 
     bool isStarToken(const std::string_view& token,
-                           std::string& countString,
-                           std::string& valueString) {
+                           std::string_view& countString,
+                           std::string_view& valueString) {
         // find first character which is not a digit
         size_t pos = 0;
         for (; pos < token.length(); ++pos)
-            if (!std::isdigit(token[pos]))
+            if (!std::isdigit(static_cast<unsigned char>(token[pos])))
                 break;
 
         // if no such character exists or if this character is not a star, the token is
         // not a "star token" (i.e. it is not a "repeat this value N times" token.
         if (pos >= token.size() || token[pos] != '*')
             return false;
+
         // Quote from the Eclipse Reference Manual: "An asterisk by
         // itself is not sufficent". However, our experience is that
         // Eclipse accepts such tokens and we therefore interpret "*"
@@ -57,22 +60,38 @@ namespace Opm {
         // StarToken<T>. (Because Eclipse does not seem to
         // accept these and we would stay as closely to the spec as
         // possible.)
-        else if (pos == 0) {
-            countString = "";
-            valueString = std::string(token.substr(pos + 1));
-            return true;
-        }
-
+        //
         // if a star is prefixed by an unsigned integer N, then this should be
         // interpreted as "repeat value after star N times"
-        countString = std::string(token.substr(0, pos));
-        valueString = std::string(token.substr(pos + 1));
+        countString = token.substr(0, pos);
+        valueString = token.substr(pos + 1);
+        return true;
+    }
+
+    bool isStarToken(const std::string_view& token,
+                           std::string& countString,
+                           std::string& valueString) {
+        std::string_view count, value;
+        if (!isStarToken(token, count, value))
+            return false;
+
+        countString = std::string(count);
+        valueString = std::string(value);
         return true;
     }
 
     template<>
     int readValueToken< int >( std::string_view view ) {
         int n = 0;
+
+        // Fast path for plain integers.  Leading '+' and malformed tokens
+        // are left to the full parser below.
+        {
+            const auto [ptr, ec] = std::from_chars(view.data(), view.data() + view.size(), n);
+            if ((ec == std::errc{}) && (ptr == view.data() + view.size()))
+                return n;
+        }
+
         auto cursor = view.begin();
         const bool ok = qi::parse( cursor, view.end(), qi::int_, n );
 
@@ -98,6 +117,18 @@ namespace Opm {
     template<>
     double readValueToken< double >( std::string_view view ) {
         double n = 0;
+
+#if defined(__cpp_lib_to_chars)
+        // Fast path for plain decimal numbers.  Fortran exponents ('D'),
+        // leading '+', out of range values and malformed tokens are left
+        // to the full parser below.
+        {
+            const auto [ptr, ec] = std::from_chars(view.data(), view.data() + view.size(), n);
+            if ((ec == std::errc{}) && (ptr == view.data() + view.size()))
+                return n;
+        }
+#endif
+
         qi::real_parser< double, fortran_double< double > > double_;
         auto cursor = view.begin();
         const auto ok = qi::parse( cursor, view.end(), double_, n );
@@ -22,6 +22,7 @@
 
 #include <cctype>
 #include <string>
+#include <string_view>
 
 #include <opm/input/eclipse/Utility/Typetools.hpp>
 
@@ -30,6 +31,11 @@ namespace Opm {
                            std::string& countString,
                            std::string& valueString);
 
+    // As above, but countString and valueString are views into token.
+    bool isStarToken(const std::string_view& token,
+                           std::string_view& countString,
+                           std::string_view& valueString);
+
     template <class T>
     T readValueToken( std::string_view );
 
@@ -20,13 +20,18 @@
 #include <cmath>
 
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 #include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 #include <opm/input/eclipse/Schedule/Well/WList.hpp>
 #include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
 #include <opm/common/utility/shmatch.hpp>
 
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace {
     std::string strip_quotes(const std::string& s) {
@@ -44,6 +49,37 @@ namespace {
         return strings;
     }
 
+    bool is_comparison(TokenType op) {
+        return (op == TokenType::op_eq) || (op == TokenType::op_ne) ||
+               (op == TokenType::op_ge) || (op == TokenType::op_le) ||
+               (op == TokenType::op_gt) || (op == TokenType::op_lt);
+    }
+
+    bool compare(double lhs, TokenType op, double rhs) {
+        switch (op) {
+        case TokenType::op_eq: return lhs == rhs;
+        case TokenType::op_ne: return lhs != rhs;
+        case TokenType::op_ge: return lhs >= rhs;
+        case TokenType::op_le: return lhs <= rhs;
+        case TokenType::op_gt: return lhs > rhs;
+        case TokenType::op_lt: return lhs < rhs;
+        default:
+            throw std::invalid_argument("Incorrect operator type - expected comparison");
+        }
+    }
+
+    bool same_values(const std::vector<double>& v1, const std::vector<double>& v2) {
+        if (v1.size() != v2.size())
+            return false;
+
+        for (std::size_t i = 0; i < v1.size(); i++) {
+            if ((v1[i] != v2[i]) && !(std::isnan(v1[i]) && std::isnan(v2[i])))
+                return false;
+        }
+
+        return true;
+    }
+
 }
 
 namespace Opm {
@@ -124,8 +160,9 @@ Action::Value ASTNode::value(const Action::Context& context) const {
                 const auto& wlm = context.wlist_manager();
                 wnames = wlm.wells(well_arg);
             } else {
+                const auto pattern = ShellPattern { well_arg };
                 for (const auto& well : context.wells(this->func)) {
-                    if (shmatch(well_arg, well))
+                    if (pattern.match(well))
                         wnames.push_back(well);
                 }
             }
@@ -149,43 +186,232 @@ Action::Value ASTNode::value(const Action::Context& context) const {
 }
 
 
+struct ASTNode::EvalCache {
+    enum class Kind {
+        Number,    // Constant.
+        Scalar,    // Single summary value, e.g. FOPR or GOPR G1.
+        Well,      // Single well value, e.g. WOPR OP1.
+        WellList   // Well pattern or well list, e.g. WOPR 'OP*'.
+    };
+
+    struct Operand {
+        Kind kind = Kind::Number;
+        double number = 0.0;
+
+        // Summary key of Scalar and Well operands.
+        std::string key;
+
+        // WellList operands: summary variable, well pattern and the
+        // candidate wells from the previous evaluation along with the
+        // matching wells and their summary keys.
+        std::string func;
+        std::string pattern;
+        std::vector<std::string> candidates;
+        std::vector<std::string> wells;
+        std::vector<std::string> keys;
+    };
+
+    bool compiled = false;
+    Operand lhs;
+    Operand rhs;
+
+    std::vector<double> inputs;
+    std::vector<double> previous_inputs;
+    std::optional<Action::Result> result;
+};
+
+
 Action::Result ASTNode::eval(const Action::Context& context) const {
+    bool changed = false;
+    return this->eval(context, changed);
+}
+
+
+const Action::Result& ASTNode::eval(const Action::Context& context, bool& changed) const {
     if (this->children.size() == 0)
         throw std::invalid_argument("ASTNode::eval() should not reach leafnodes");
 
+    if (!this->cache)
+        this->cache = std::make_shared<EvalCache>();
+
+    auto& eval_cache = *this->cache;
+    auto update_result = [&eval_cache, &changed](Action::Result&& result) -> const Action::Result&
+    {
+        changed = !eval_cache.result.has_value() || !(*eval_cache.result == result);
+        eval_cache.result = std::move(result);
+        return *eval_cache.result;
+    };
+
     if (this->type == TokenType::op_or || this->type == TokenType::op_and) {
+        bool children_changed = false;
+        for (const auto& child : this->children) {
+            bool child_changed = false;
+            child.eval(context, child_changed);
+            children_changed = children_changed || child_changed;
+        }
+
+        if (!children_changed && eval_cache.result.has_value())
+            return *eval_cache.result;
+
         Action::Result result(this->type == TokenType::op_and);
         for (const auto& child : this->children) {
             if (this->type == TokenType::op_or)
-                result |= child.eval(context);
+                result |= *child.cache->result;
             else
-                result &= child.eval(context);
+                result &= *child.cache->result;
         }
-        return result;
+        return update_result(std::move(result));
     }
 
-    auto v1 = this->children[0].value(context);
-    Action::Value v2;
+    if (!eval_cache.compiled)
+        this->compile(eval_cache);
+
+    this->read_inputs(context, eval_cache);
+    if (eval_cache.result.has_value() &&
+        same_values(eval_cache.inputs, eval_cache.previous_inputs))
+        return *eval_cache.result;
+
+    const auto& lhs = eval_cache.lhs;
+    const auto& inputs = eval_cache.inputs;
+    const double rhs = (eval_cache.rhs.kind == EvalCache::Kind::Number)
+        ? eval_cache.rhs.number
+        : inputs.back();
+
+    std::optional<Action::Result> result;
+    switch (lhs.kind) {
+    case EvalCache::Kind::Number:
+        result.emplace(compare(lhs.number, this->type, rhs));
+        break;
+
+    case EvalCache::Kind::Scalar:
+        result.emplace(compare(inputs[0], this->type, rhs));
+        break;
+
+    case EvalCache::Kind::Well:
+    case EvalCache::Kind::WellList: {
+        std::vector<std::string> wells;
+        for (std::size_t index = 0; index < lhs.wells.size(); index++) {
+            if (compare(inputs[index], this->type, rhs))
+                wells.push_back(lhs.wells[index]);
+        }
+        result.emplace(!wells.empty(), wells);
+        break;
+    }
+    }
 
-    /*
-      Special casing of MONTH comparisons where in addition symbolic month names
-      we can compare with numeric months, in the case of numeric months the
-      numerical value should be rounded before comparison - i.e.
+    std::swap(eval_cache.inputs, eval_cache.previous_inputs);
+    return update_result(*std::move(result));
+}
+
+
+/*
+  Resolve the operands of a comparison node once; this mirrors the case
+  analysis in ASTNode::value().
+*/
+void ASTNode::compile(EvalCache& eval_cache) const {
+    auto operand = [](const ASTNode& node) {
+        if (node.children.size() != 0)
+            throw std::invalid_argument("value() method should only reach leafnodes");
+
+        EvalCache::Operand op;
+        if (node.type == TokenType::number) {
+            op.kind = EvalCache::Kind::Number;
+            op.number = node.number;
+        }
+        else if (node.arg_list.size() == 0) {
+            op.kind = EvalCache::Kind::Scalar;
+            op.key = node.func;
+        }
+        else if ((node.arg_list.size() == 1) && (node.arg_list[0].find("*") != std::string::npos)) {
+            if (node.func_type != FuncType::well)
+                throw std::logic_error(": attempted to action-evaluate list not of type well.");
+
+            op.kind = EvalCache::Kind::WellList;
+            op.func = node.func;
+            op.pattern = node.arg_list[0];
+        }
+        else {
+            op.key = node.func;
+            for (const auto& arg : node.arg_list)
+                op.key += ":" + arg;
+
+            if (node.func_type == FuncType::well) {
+                op.kind = EvalCache::Kind::Well;
+                op.wells = { node.arg_list[0] };
+            }
+            else
+                op.kind = EvalCache::Kind::Scalar;
+        }
+        return op;
+    };
+
+    auto lhs = operand(this->children[0]);
+    auto rhs = operand(this->children[1]);
 
-        MNTH = 4.3
+    if (!is_comparison(this->type))
+        throw std::invalid_argument("Invalid operator");
 
-      Should evaluate to true for the month April.
-     */
-    if (this->children[0].func_type == FuncType::time_month) {
-        const auto& rhs = this->children[1];
-        if (rhs.type == TokenType::number) {
-            v2 = Action::Value(std::round(rhs.number));
-        } else
-            v2 = rhs.value(context);
-    } else
-        v2 = this->children[1].value(context);
+    if ((rhs.kind == EvalCache::Kind::Well) || (rhs.kind == EvalCache::Kind::WellList))
+        throw std::invalid_argument("The right hand side must be a scalar value");
 
-    return v1.eval_cmp(this->type, v2);
+    // Numeric months are rounded before comparison, see ASTNode::value().
+    if ((this->children[0].func_type == FuncType::time_month) && (rhs.kind == EvalCache::Kind::Number))
+        rhs.number = std::round(rhs.number);
+
+    eval_cache.lhs = std::move(lhs);
+    eval_cache.rhs = std::move(rhs);
+    eval_cache.compiled = true;
+}
+
+
+/*
+  Read the current values of the comparison operands into eval_cache.inputs.
+  If the set of wells matching a well pattern or well list has changed since
+  the previous evaluation the previous result is discarded.
+*/
+void ASTNode::read_inputs(const Action::Context& context, EvalCache& eval_cache) const {
+    auto& inputs = eval_cache.inputs;
+    inputs.clear();
+
+    for (auto* op : { &eval_cache.lhs, &eval_cache.rhs }) {
+        switch (op->kind) {
+        case EvalCache::Kind::Number:
+            break;
+
+        case EvalCache::Kind::Scalar:
+        case EvalCache::Kind::Well:
+            inputs.push_back(context.get(op->key));
+            break;
+
+        case EvalCache::Kind::WellList: {
+            const bool is_wlist = (op->pattern[0] == '*') && (op->pattern.size() > 1);
+            auto candidates = is_wlist
+                ? context.wlist_manager().wells(op->pattern)
+                : context.wells(op->func);
+
+            if (candidates != op->candidates) {
+                op->wells.clear();
+                op->keys.clear();
+
+                const auto pattern = ShellPattern { op->pattern };
+                for (const auto& well : candidates) {
+                    if (is_wlist || pattern.match(well)) {
+                        op->wells.push_back(well);
+                        op->keys.push_back(op->func + ":" + well);
+                    }
+                }
+
+                op->candidates = std::move(candidates);
+                eval_cache.result.reset();
+            }
+
+            for (const auto& key : op->keys)
+                inputs.push_back(context.get(key));
+
+            break;
+        }
+        }
+    }
 }
 
 
@@ -48,6 +48,7 @@
 #include <opm/input/eclipse/Schedule/OilVaporizationProperties.hpp>
 #include <opm/input/eclipse/Schedule/RFTConfig.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
+#include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Tuning.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
@@ -105,7 +106,7 @@
 
 #include <fmt/format.h>
 
-#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
+#include <external/resinsight/ReservoirDataModel/RigWellLogExtractor.h>
 
 namespace Opm {
 
@@ -254,32 +255,67 @@ namespace {
     void Schedule::handleCOMPTRAJ(HandlerContext& handlerContext)  {
         // Keyword WELTRAJ must be read first
         std::unordered_set<std::string> wells;
-        external::cvf::ref<external::cvf::BoundingBoxTree> cellSearchTree = nullptr; 
+
+        struct TrajectoryJob {
+            const DeckRecord* record;
+            std::string well;
+            const WellConnections* connections;
+            std::vector<external::WellPathCellIntersectionInfo> intersections{};
+            std::exception_ptr error{};
+        };
+
+        std::vector<TrajectoryJob> jobs;
         for (const auto& record : handlerContext.keyword) {
             const std::string& wellNamePattern = record.getItem("WELL").getTrimmedString(0);
-            auto wellnames = this->wellNames(wellNamePattern, handlerContext );
+            for (const auto& name : this->wellNames(wellNamePattern, handlerContext))
+                jobs.push_back({ &record, name, &this->snapshots.back().wells.get(name).getConnections() });
+        }
 
-            for (const auto& name : wellnames) {
-                auto well2 = this->snapshots.back().wells.get(name);
-                auto connections = std::make_shared<WellConnections>(WellConnections(well2.getConnections()));
-                // cellsearchTree is calculated only once and is used to calculated cell intersections of the perforations specified in COMPTRAJ 
-                connections->loadCOMPTRAJ(record, handlerContext.grid, name, handlerContext.keyword.location(), cellSearchTree);
-                // In the case that defaults are used in WELSPECS for headI/J the headI/J are calculated based on the well trajectory data
-                well2.updateHead(connections->getHeadI(), connections->getHeadJ());
-                if (well2.updateConnections(connections, handlerContext.grid)) {
-                    this->snapshots.back().wells.update( well2 );
-                    wells.insert( name );
-                }
+        // The trajectory/grid intersections depend only on the WELTRAJ
+        // data and the COMPTRAJ record, so they are computed for all wells
+        // in parallel against the shared cell search tree, which is built
+        // once up front.  The connections are then updated serially in
+        // keyword order.
+        if (! jobs.empty())
+            handlerContext.grid.cellSearchTree();
 
-                if (connections->empty() && well2.getConnections().empty()) {
-                    const auto& location = handlerContext.keyword.location();
-                    auto msg = fmt::format("Problem with COMPTRAJ/{}\n"
-                                           "In {} line {}\n"
-                                           "Well {} is not connected to grid - will remain SHUT", name, location.filename, location.lineno, name);
-                    OpmLog::warning(msg);
-                }
-                this->snapshots.back().wellgroup_events().addEvent( name, ScheduleEvents::COMPLETION_CHANGE);
+#pragma omp parallel for schedule(dynamic)
+        for (int jobIdx = 0; jobIdx < static_cast<int>(jobs.size()); ++jobIdx) {
+            auto& job = jobs[jobIdx];
+            try {
+                job.intersections = job.connections->trajectoryIntersections(*job.record, handlerContext.grid);
+            }
+            catch (...) {
+                job.error = std::current_exception();
+            }
+        }
+
+        for (const auto& job : jobs) {
+            if (job.error)
+                std::rethrow_exception(job.error);
+        }
+
+        for (const auto& job : jobs) {
+            const auto& record = *job.record;
+            const auto& name = job.well;
+            auto well2 = this->snapshots.back().wells.get(name);
+            auto connections = std::make_shared<WellConnections>(WellConnections(well2.getConnections()));
+            connections->loadCOMPTRAJ(record, handlerContext.grid, name, handlerContext.keyword.location(), job.intersections);
+            // In the case that defaults are used in WELSPECS for headI/J the headI/J are calculated based on the well trajectory data
+            well2.updateHead(connections->getHeadI(), connections->getHeadJ());
+            if (well2.updateConnections(connections, handlerContext.grid)) {
+                this->snapshots.back().wells.update( well2 );
+                wells.insert( name );
+            }
+
+            if (connections->empty() && well2.getConnections().empty()) {
+                const auto& location = handlerContext.keyword.location();
+                auto msg = fmt::format("Problem with COMPTRAJ/{}\n"
+                                       "In {} line {}\n"
+                                       "Well {} is not connected to grid - will remain SHUT", name, location.filename, location.lineno, name);
+                OpmLog::warning(msg);
             }
+            this->snapshots.back().wellgroup_events().addEvent( name, ScheduleEvents::COMPLETION_CHANGE);
         }
         this->snapshots.back().events().addEvent(ScheduleEvents::COMPLETION_CHANGE);
 
@@ -23,7 +23,9 @@
 
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/MemPacker.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/Serializer.hpp>
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/numeric/cmp.hpp>
 #include <opm/common/utility/shmatch.hpp>
@@ -34,6 +36,7 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ASTNode.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
 #include <opm/input/eclipse/Schedule/Action/State.hpp>
@@ -57,17 +60,22 @@
 #include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/Tuning.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQActive.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
 #include <opm/input/eclipse/Schedule/Well/WList.hpp>
 #include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellBrineProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellEconProductionLimits.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellFoamProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellMICPProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellPolymerProperties.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellTestConfig.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTracerProperties.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPDP.hpp>
+#include <opm/input/eclipse/Schedule/Well/WVFPEXP.hpp>
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
@@ -111,10 +119,6 @@
 
 namespace {
 
-    bool name_match(const std::string& pattern, const std::string& name) {
-        return Opm::shmatch(pattern, name);
-    }
-
     double sumthin_summary_section(const Opm::SUMMARYSection& section) {
         const auto entries = section.getKeywordList<Opm::ParserKeywords::SUMTHIN>();
 
@@ -142,6 +146,80 @@ namespace {
         return rptonly;
     }
 
+    // Serializer which only computes the packed size of objects.
+    class PackSizeSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+    {
+    public:
+        PackSizeSerializer()
+            : Opm::Serializer<Opm::Serialization::MemPacker>(packer())
+        {}
+
+        template <class T>
+        std::size_t size(const T& data)
+        {
+            m_op = Operation::PACKSIZE;
+            m_packSize = 0;
+            (*this)(data);
+            return m_packSize;
+        }
+
+    private:
+        static const Opm::Serialization::MemPacker& packer()
+        {
+            static const Opm::Serialization::MemPacker memPacker{};
+            return memPacker;
+        }
+    };
+
+    // Accumulates the memory used by one ScheduleState member over all
+    // report steps.  Objects are identified by address, so objects shared
+    // between report steps are counted once.  The size of an object is
+    // estimated from its serialized size.
+    class MemoryCounter
+    {
+    public:
+        explicit MemoryCounter(const std::string& member)
+        {
+            this->usage_.member = member;
+        }
+
+        template <class T>
+        void add(const T* object)
+        {
+            if (object == nullptr)
+                return;
+
+            ++this->usage_.references;
+            if (this->seen_.insert(object).second) {
+                ++this->usage_.instances;
+                this->usage_.bytes += sizeof(T) + this->serializer_.size(*object);
+            }
+        }
+
+        template <class Storage>
+        void addStorage(const Storage& storage)
+        {
+            storage.visitNodes([this](const void* node, const std::size_t bytes)
+            {
+                if (! this->seen_.insert(node).second)
+                    return false;
+
+                this->usage_.bytes += bytes;
+                return true;
+            });
+        }
+
+        const Opm::Schedule::MemberMemoryUsage& usage() const
+        {
+            return this->usage_;
+        }
+
+    private:
+        Opm::Schedule::MemberMemoryUsage usage_{};
+        std::unordered_set<const void*> seen_{};
+        PackSizeSerializer serializer_{};
+    };
+
     std::optional<Opm::OilVaporizationProperties>
     vappars_solution_section(const Opm::SOLUTIONSection& section, const int numpvt) {
         if (section.hasKeyword("VAPPARS")) {
@@ -1287,9 +1365,10 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
+            const auto shell_pattern = ShellPattern { pattern };
             std::vector<std::string> names;
             for (const auto& gname : group_order) {
-                if (name_match(pattern, gname))
+                if (shell_pattern.match(gname))
                     names.push_back(gname);
             }
             return names;
@@ -1874,6 +1953,86 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
      }
 
 
+    std::vector<Schedule::MemberMemoryUsage> Schedule::memoryUsage() const {
+        std::vector<MemberMemoryUsage> report;
+
+        auto add_member = [this, &report](const std::string& member, auto get_ptr) {
+            MemoryCounter counter(member);
+            for (const auto& state : this->snapshots)
+                counter.add(get_ptr(state));
+
+            report.push_back(counter.usage());
+        };
+
+        {
+            MemoryCounter counter("state");
+            for (const auto& state : this->snapshots)
+                counter.add(&state);
+
+            report.push_back(counter.usage());
+        }
+
+        {
+            MemoryCounter wells("wells");
+            MemoryCounter connections("well_connections");
+            MemoryCounter segments("well_segments");
+            for (const auto& state : this->snapshots) {
+                wells.addStorage(state.wells.storage());
+                for (const auto& [_, well] : state.wells) {
+                    (void)_;
+                    wells.add(well.get());
+                    connections.add(&well->getConnections());
+                    if (well->isMultiSegment())
+                        segments.add(&well->getSegments());
+                }
+            }
+
+            report.push_back(wells.usage());
+            report.push_back(connections.usage());
+            report.push_back(segments.usage());
+        }
+
+        auto add_map = [this, &report](const std::string& member, auto get_map) {
+            MemoryCounter counter(member);
+            for (const auto& state : this->snapshots) {
+                const auto& map = get_map(state);
+                counter.addStorage(map.storage());
+                for (const auto& [_, value] : map) {
+                    (void)_;
+                    counter.add(value.get());
+                }
+            }
+
+            report.push_back(counter.usage());
+        };
+
+        add_map("groups", [](const ScheduleState& state) -> const auto& { return state.groups; });
+        add_map("vfpprod", [](const ScheduleState& state) -> const auto& { return state.vfpprod; });
+        add_map("vfpinj", [](const ScheduleState& state) -> const auto& { return state.vfpinj; });
+
+        add_member("pavg", [](const ScheduleState& state) { return state.pavg.get_ptr(); });
+        add_member("wtest_config", [](const ScheduleState& state) { return state.wtest_config.get_ptr(); });
+        add_member("gconsale", [](const ScheduleState& state) { return state.gconsale.get_ptr(); });
+        add_member("gconsump", [](const ScheduleState& state) { return state.gconsump.get_ptr(); });
+        add_member("gecon", [](const ScheduleState& state) { return state.gecon.get_ptr(); });
+        add_member("guide_rate", [](const ScheduleState& state) { return state.guide_rate.get_ptr(); });
+        add_member("wlist_manager", [](const ScheduleState& state) { return state.wlist_manager.get_ptr(); });
+        add_member("well_order", [](const ScheduleState& state) { return state.well_order.get_ptr(); });
+        add_member("group_order", [](const ScheduleState& state) { return state.group_order.get_ptr(); });
+        add_member("actions", [](const ScheduleState& state) { return state.actions.get_ptr(); });
+        add_member("udq", [](const ScheduleState& state) { return state.udq.get_ptr(); });
+        add_member("udq_active", [](const ScheduleState& state) { return state.udq_active.get_ptr(); });
+        add_member("glo", [](const ScheduleState& state) { return state.glo.get_ptr(); });
+        add_member("network", [](const ScheduleState& state) { return state.network.get_ptr(); });
+        add_member("network_balance", [](const ScheduleState& state) { return state.network_balance.get_ptr(); });
+        add_member("rpt_config", [](const ScheduleState& state) { return state.rpt_config.get_ptr(); });
+        add_member("rft_config", [](const ScheduleState& state) { return state.rft_config.get_ptr(); });
+        add_member("rst_config", [](const ScheduleState& state) { return state.rst_config.get_ptr(); });
+
+        return report;
+    }
+
+
     std::string Schedule::formatDate(std::time_t t) {
         const auto ts { TimeStampUTC(t) } ;
         return fmt::format("{:04d}-{:02d}-{:02d}" , ts.year(), ts.month(), ts.day());
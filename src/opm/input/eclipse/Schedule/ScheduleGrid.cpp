@@ -22,6 +22,7 @@
 #include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/Schedule/WellTraj/RigEclipseWellLogExtractor.hpp>
 
 Opm::ScheduleGrid::ScheduleGrid(const Opm::EclipseGrid& ecl_grid, const Opm::FieldPropsManager& fpm, Opm::CompletedCells& completed_cells)
     : grid(&ecl_grid)
@@ -76,3 +77,10 @@ const Opm::CompletedCells::Cell& Opm::ScheduleGrid::get_cell(std::size_t i, std:
 const Opm::EclipseGrid* Opm::ScheduleGrid::get_grid() const {
       return this->grid;
 }
+
+const external::cvf::BoundingBoxTree& Opm::ScheduleGrid::cellSearchTree() const {
+    if (this->searchTree.isNull())
+        this->searchTree = external::RigEclipseWellLogExtractor::buildCellSearchTree(*this->grid);
+
+    return *this->searchTree;
+}
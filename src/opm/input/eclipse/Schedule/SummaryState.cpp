@@ -23,14 +23,19 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
+#include <charconv>
 #include <cstddef>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
+#include <numeric>
+#include <optional>
 #include <ostream>
-#include <set>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -63,55 +68,565 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
-    template <class T>
-    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
+    std::string entity_key(const std::string& var, const std::string& entity)
+    {
+        return var + ':' + entity;
+    }
 
-    template <class T>
-    bool has_var(const map2<T>& values, const std::string& var1, const std::string& var2) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return false;
+    std::string indexed_key(const std::string& var, const std::string& well, const std::size_t index)
+    {
+        return var + ':' + well + ':' + std::to_string(index);
+    }
+
+    // Parts of a colon separated key 'VAR:NAME' or 'VAR:NAME:INDEX'.
+    struct KeyParts
+    {
+        std::string var;
+        std::string name;
+        std::optional<std::size_t> index;
+    };
+
+    std::optional<KeyParts> split_key(const std::string& key)
+    {
+        const auto sep_pos = key.find(':');
+        if ((sep_pos == 0) || (sep_pos == std::string::npos) || (sep_pos + 1 == key.size()))
+            return std::nullopt;
+
+        auto parts = KeyParts { key.substr(0, sep_pos), key.substr(sep_pos + 1), std::nullopt };
+
+        const auto index_pos = parts.name.rfind(':');
+        if (index_pos != std::string::npos) {
+            const auto* first = parts.name.data() + index_pos + 1;
+            const auto* last  = parts.name.data() + parts.name.size();
+
+            auto index = std::size_t{0};
+            const auto [ptr, ec] = std::from_chars(first, last, index);
+            if ((first == last) || (ec != std::errc{}) || (ptr != last))
+                return std::nullopt;
+
+            parts.index = index;
+            parts.name.resize(index_pos);
+        }
+
+        return parts;
+    }
+
+    template <class Cells>
+    auto lower_bound(Cells& cells, const std::size_t index)
+    {
+        return std::lower_bound(cells.begin(), cells.end(), index,
+                                [](const auto& cell, const std::size_t i)
+                                { return cell.index < i; });
+    }
+
+    void check_batch_size(const std::size_t num_names, const std::size_t num_values)
+    {
+        if (num_names != num_values) {
+            throw std::invalid_argument {
+                "Batched summary update with " + std::to_string(num_names)
+                + " names and " + std::to_string(num_values) + " values"
+            };
+        }
+    }
+
+} // Anonymous namespace
+
+
+namespace Opm
+{
+
+    std::size_t SummaryState::NameIndex::intern(const std::string& name)
+    {
+        const auto& [pos, inserted] = this->ids_.emplace(name, this->names_.size());
+        if (inserted)
+            this->names_.push_back(name);
+
+        return pos->second;
+    }
+
+    std::optional<std::size_t> SummaryState::NameIndex::find(const std::string& name) const
+    {
+        const auto pos = this->ids_.find(name);
+        if (pos == this->ids_.end())
+            return std::nullopt;
+
+        return pos->second;
+    }
+
+    // ---------------------------------------------------------------------
+
+    std::size_t SummaryState::EntityValues::variable_id(const std::string& var)
+    {
+        const auto id = this->variables.intern(var);
+        if (id == this->columns.size()) {
+            this->columns.emplace_back();
+            this->total.push_back(::is_total(var));
+            this->num_defined_var.push_back(0);
+        }
+
+        return id;
+    }
+
+    std::size_t SummaryState::EntityValues::entity_id(const std::string& entity)
+    {
+        const auto id = this->entities.intern(entity);
+        if (id == this->listed.size())
+            this->listed.push_back(false);
+
+        return id;
+    }
+
+    const SummaryState::Cell*
+    SummaryState::EntityValues::find(const std::size_t var, const std::size_t entity) const
+    {
+        if (var >= this->columns.size())
+            return nullptr;
+
+        const auto& column = this->columns[var];
+        if ((entity >= column.size()) || !column[entity].defined)
+            return nullptr;
+
+        return &column[entity];
+    }
+
+    const SummaryState::Cell*
+    SummaryState::EntityValues::find(const std::string& var, const std::string& entity) const
+    {
+        const auto var_id = this->variables.find(var);
+        if (! var_id.has_value())
+            return nullptr;
+
+        const auto entity_id = this->entities.find(entity);
+        if (! entity_id.has_value())
+            return nullptr;
+
+        return this->find(*var_id, *entity_id);
+    }
+
+    bool SummaryState::EntityValues::has_variable(const std::string& var) const
+    {
+        const auto var_id = this->variables.find(var);
+        return var_id.has_value() && (this->num_defined_var[*var_id] > 0);
+    }
+
+    // Returns the resulting value and whether or not it was previously
+    // undefined.
+    std::pair<double, bool>
+    SummaryState::EntityValues::update(const std::size_t var,
+                                       const std::size_t entity,
+                                       const double      value)
+    {
+        auto& column = this->columns[var];
+        if (column.size() <= entity)
+            column.resize(this->entities.size(), Cell{});
+
+        auto& cell = column[entity];
+        const auto is_new = ! cell.defined;
+        if (is_new)
+            ++this->num_defined_var[var];
+
+        cell.value = (! is_new && this->total[var]) ? cell.value + value : value;
+        cell.defined = true;
+
+        this->set_listed(entity, true);
+
+        return { cell.value, is_new };
+    }
+
+    void SummaryState::EntityValues::set_listed(const std::size_t entity, const bool is_listed)
+    {
+        if (this->listed[entity] == is_listed)
+            return;
+
+        this->listed[entity] = is_listed;
 
-        const auto& var2_iter = var1_iter->second.find(var2);
-        if (var2_iter == var1_iter->second.end())
+        const auto& name = this->entities.name(entity);
+        const auto pos = std::lower_bound(this->sorted_names.begin(), this->sorted_names.end(), name);
+        if (is_listed) {
+            ++this->num_listed;
+            this->sorted_names.insert(pos, name);
+        }
+        else {
+            --this->num_listed;
+            this->sorted_names.erase(pos);
+        }
+    }
+
+    bool SummaryState::EntityValues::erase(const std::string& var, const std::string& entity)
+    {
+        const auto* cell = this->find(var, entity);
+        if (cell == nullptr)
             return false;
 
+        const auto entity_id = *this->entities.find(entity);
+        const auto var_id = *this->variables.find(var);
+        this->columns[var_id][entity_id].defined = false;
+        --this->num_defined_var[var_id];
+
+        const auto still_listed =
+            std::any_of(this->columns.begin(), this->columns.end(),
+                        [entity_id](const auto& col)
+                        { return (entity_id < col.size()) && col[entity_id].defined; });
+
+        if (! still_listed)
+            this->set_listed(entity_id, false);
+
         return true;
     }
 
-    template <class T>
-    void erase_var(map2<T>& values, std::set<std::string>& var2_set, const std::string& var1, const std::string& var2) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return;
+    void SummaryState::EntityValues::append(const EntityValues& other)
+    {
+        for (std::size_t other_var = 0; other_var < other.columns.size(); ++other_var) {
+            const auto var = this->variable_id(other.variables.name(other_var));
+            for (auto& cell : this->columns[var])
+                cell = Cell{};
+
+            this->num_defined_var[var] = 0;
 
-        var1_iter->second.erase(var2);
-        var2_set.clear();
-        for (const auto& [_, var2_map] : values) {
-            (void)_;
-            for (const auto& [v2, __] : var2_map) {
-                (void)__;
-                var2_set.insert(v2);
+            const auto& other_column = other.columns[other_var];
+            for (std::size_t other_entity = 0; other_entity < other_column.size(); ++other_entity) {
+                if (! other_column[other_entity].defined)
+                    continue;
+
+                const auto entity = this->entity_id(other.entities.name(other_entity));
+                auto& column = this->columns[var];
+                if (column.size() <= entity)
+                    column.resize(this->entities.size(), Cell{});
+
+                column[entity] = Cell { other_column[other_entity].value, true };
+                ++this->num_defined_var[var];
             }
         }
+
+        for (std::size_t other_entity = 0; other_entity < other.listed.size(); ++other_entity) {
+            if (! other.listed[other_entity])
+                continue;
+
+            this->set_listed(this->entity_id(other.entities.name(other_entity)), true);
+        }
     }
 
-    template <class T>
-    std::vector<std::string> var2_list(const map2<T>& values, const std::string& var1) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
+    std::vector<std::string> SummaryState::EntityValues::names(const std::string& var) const
+    {
+        const auto var_id = this->variables.find(var);
+        if (! var_id.has_value())
             return {};
 
         std::vector<std::string> l;
-        for (const auto& pair : var1_iter->second)
-            l.push_back(pair.first);
+        const auto& column = this->columns[*var_id];
+        for (std::size_t entity = 0; entity < column.size(); ++entity) {
+            if (column[entity].defined)
+                l.push_back(this->entities.name(entity));
+        }
+
         return l;
     }
 
-} // Anonymous namespace
+    const std::vector<std::string>& SummaryState::EntityValues::names() const
+    {
+        return this->sorted_names;
+    }
 
-namespace Opm
-{
+    std::size_t SummaryState::EntityValues::num_defined() const
+    {
+        return std::accumulate(this->num_defined_var.begin(),
+                               this->num_defined_var.end(), std::size_t{0});
+    }
+
+    // Compares contents only, irrespective of the order in which the names
+    // have been interned.
+    bool SummaryState::EntityValues::operator==(const EntityValues& other) const
+    {
+        if ((this->variables.size() != other.variables.size()) ||
+            (this->num_defined() != other.num_defined()) ||
+            (this->names() != other.names()))
+        {
+            return false;
+        }
+
+        for (std::size_t var = 0; var < this->columns.size(); ++var) {
+            const auto& var_name = this->variables.name(var);
+            if (! other.variables.find(var_name).has_value())
+                return false;
+
+            const auto& column = this->columns[var];
+            for (std::size_t entity = 0; entity < column.size(); ++entity) {
+                if (! column[entity].defined)
+                    continue;
+
+                const auto* other_cell = other.find(var_name, this->entities.name(entity));
+                if ((other_cell == nullptr) || (other_cell->value != column[entity].value))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    // ---------------------------------------------------------------------
+
+    std::size_t SummaryState::IndexedValues::variable_id(const std::string& var)
+    {
+        const auto id = this->variables.intern(var);
+        if (id == this->cells.size()) {
+            this->cells.emplace_back();
+            this->total.push_back(::is_total(var));
+        }
+
+        return id;
+    }
+
+    std::size_t SummaryState::IndexedValues::well_id(const std::string& well)
+    {
+        return this->wells.intern(well);
+    }
+
+    const SummaryState::IndexedCell*
+    SummaryState::IndexedValues::find(const std::size_t var,
+                                      const std::size_t well,
+                                      const std::size_t index) const
+    {
+        if ((var >= this->cells.size()) || (well >= this->cells[var].size()))
+            return nullptr;
+
+        const auto& flat = this->cells[var][well];
+        const auto pos = lower_bound(flat, index);
+        if ((pos == flat.end()) || (pos->index != index))
+            return nullptr;
+
+        return &*pos;
+    }
+
+    const SummaryState::IndexedCell*
+    SummaryState::IndexedValues::find(const std::string& var,
+                                      const std::string& well,
+                                      const std::size_t  index) const
+    {
+        const auto var_id = this->variables.find(var);
+        if (! var_id.has_value())
+            return nullptr;
+
+        const auto well_id = this->wells.find(well);
+        if (! well_id.has_value())
+            return nullptr;
+
+        return this->find(*var_id, *well_id, index);
+    }
+
+    // Returns the resulting value and whether or not it was previously
+    // undefined.
+    std::pair<double, bool>
+    SummaryState::IndexedValues::update(const std::size_t var,
+                                        const std::size_t well,
+                                        const std::size_t index,
+                                        const double      value)
+    {
+        auto& per_well = this->cells[var];
+        if (per_well.size() <= well)
+            per_well.resize(this->wells.size());
+
+        auto& flat = per_well[well];
+        auto pos = lower_bound(flat, index);
+        if ((pos == flat.end()) || (pos->index != index)) {
+            flat.insert(pos, IndexedCell { index, value });
+            return { value, true };
+        }
+
+        pos->value = this->total[var] ? pos->value + value : value;
+        return { pos->value, false };
+    }
+
+    bool SummaryState::IndexedValues::erase(const std::string& var,
+                                            const std::string& well,
+                                            const std::size_t  index)
+    {
+        const auto var_id = this->variables.find(var);
+        const auto well_id = this->wells.find(well);
+        if (! var_id.has_value() || ! well_id.has_value() ||
+            (*well_id >= this->cells[*var_id].size()))
+        {
+            return false;
+        }
+
+        auto& flat = this->cells[*var_id][*well_id];
+        const auto pos = lower_bound(flat, index);
+        if ((pos == flat.end()) || (pos->index != index))
+            return false;
+
+        flat.erase(pos);
+        return true;
+    }
+
+    void SummaryState::IndexedValues::append(const IndexedValues& other)
+    {
+        for (std::size_t other_var = 0; other_var < other.cells.size(); ++other_var) {
+            auto& per_well = this->cells[this->variable_id(other.variables.name(other_var))];
+            per_well.clear();
+
+            const auto& other_per_well = other.cells[other_var];
+            for (std::size_t other_well = 0; other_well < other_per_well.size(); ++other_well) {
+                const auto well = this->well_id(other.wells.name(other_well));
+                if (per_well.size() <= well)
+                    per_well.resize(this->wells.size());
+
+                per_well[well] = other_per_well[other_well];
+            }
+        }
+    }
+
+    std::size_t SummaryState::IndexedValues::num_defined() const
+    {
+        std::size_t n = 0;
+        for (const auto& per_well : this->cells) {
+            for (const auto& flat : per_well)
+                n += flat.size();
+        }
+
+        return n;
+    }
+
+    bool SummaryState::IndexedValues::operator==(const IndexedValues& other) const
+    {
+        if ((this->variables.size() != other.variables.size()) ||
+            (this->num_defined() != other.num_defined()))
+        {
+            return false;
+        }
+
+        for (std::size_t var = 0; var < this->cells.size(); ++var) {
+            const auto& var_name = this->variables.name(var);
+            if (! other.variables.find(var_name).has_value())
+                return false;
+
+            const auto& per_well = this->cells[var];
+            for (std::size_t well = 0; well < per_well.size(); ++well) {
+                for (const auto& cell : per_well[well]) {
+                    const auto* other_cell = other.find(var_name, this->wells.name(well), cell.index);
+                    if ((other_cell == nullptr) || (other_cell->value != cell.value))
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // ---------------------------------------------------------------------
+
+    SummaryState::const_iterator::const_iterator(const SummaryState& st_arg, const Table table_arg)
+        : st        { &st_arg }
+        , table     { table_arg }
+        , value_pos { (table_arg == Table::Values) ? st_arg.values.begin() : st_arg.values.end() }
+    {
+        this->settle();
+    }
+
+    SummaryState::const_iterator& SummaryState::const_iterator::operator++()
+    {
+        switch (this->table) {
+        case Table::Values:
+            ++this->value_pos;
+            break;
+
+        case Table::Wells:
+        case Table::Groups:
+            ++this->name;
+            break;
+
+        case Table::Connections:
+        case Table::Segments:
+            ++this->index;
+            break;
+
+        case Table::End:
+            return *this;
+        }
+
+        this->settle();
+        return *this;
+    }
+
+    SummaryState::const_iterator SummaryState::const_iterator::operator++(int)
+    {
+        auto prev = *this;
+        ++(*this);
+        return prev;
+    }
+
+    bool SummaryState::const_iterator::operator==(const const_iterator& other) const
+    {
+        return (this->table == other.table)
+            && (this->value_pos == other.value_pos)
+            && (this->var == other.var)
+            && (this->name == other.name)
+            && (this->index == other.index);
+    }
+
+    // Moves forward to the first defined value at or after the current
+    // position, and forms its key.
+    void SummaryState::const_iterator::settle()
+    {
+        if (this->table == Table::Values) {
+            if (this->value_pos != this->st->values.end()) {
+                this->current = *this->value_pos;
+                return;
+            }
+
+            this->table = Table::Wells;
+        }
+
+        while ((this->table == Table::Wells) || (this->table == Table::Groups)) {
+            const auto& entities = (this->table == Table::Wells)
+                ? this->st->well_values : this->st->group_values;
+
+            if (this->var >= entities.columns.size()) {
+                this->table = (this->table == Table::Wells) ? Table::Groups : Table::Connections;
+                this->var = this->name = 0;
+            }
+            else if (this->name >= entities.columns[this->var].size()) {
+                ++this->var;
+                this->name = 0;
+            }
+            else if (! entities.columns[this->var][this->name].defined) {
+                ++this->name;
+            }
+            else {
+                this->current = {
+                    entity_key(entities.variables.name(this->var), entities.entities.name(this->name)),
+                    entities.columns[this->var][this->name].value
+                };
+                return;
+            }
+        }
+
+        while ((this->table == Table::Connections) || (this->table == Table::Segments)) {
+            const auto& indexed = (this->table == Table::Connections)
+                ? this->st->conn_values : this->st->segment_values;
+
+            if (this->var >= indexed.cells.size()) {
+                this->table = (this->table == Table::Connections) ? Table::Segments : Table::End;
+                this->var = this->name = this->index = 0;
+            }
+            else if (this->name >= indexed.cells[this->var].size()) {
+                ++this->var;
+                this->name = this->index = 0;
+            }
+            else if (this->index >= indexed.cells[this->var][this->name].size()) {
+                ++this->name;
+                this->index = 0;
+            }
+            else {
+                const auto& cell = indexed.cells[this->var][this->name][this->index];
+                this->current = {
+                    indexed_key(indexed.variables.name(this->var), indexed.wells.name(this->name), cell.index),
+                    cell.value
+                };
+                return;
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------
 
     SummaryState::SummaryState(time_point sim_start_arg)
         : sim_start(sim_start_arg)
@@ -125,123 +640,85 @@ namespace Opm
 
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        if (auto* dense_value = this->find_dense(key); dense_value != nullptr)
+            *dense_value = value;
+        else
+            this->values.insert_or_assign(key, value);
     }
 
     bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+        return (this->values.erase(key) > 0) || this->erase_dense(key);
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
     {
-        std::string key = var + ":" + well;
-        if (!this->erase(key))
-            return false;
-
-        erase_var(this->well_values, this->m_wells, var, well);
-        this->well_names.reset();
-        return true;
+        return this->well_values.erase(var, well)
+            || (this->values.erase(entity_key(var, well)) > 0);
     }
 
     bool SummaryState::erase_group_var(const std::string& group, const std::string& var)
     {
-        std::string key = var + ":" + group;
-        if (!this->erase(key))
-            return false;
-
-        erase_var(this->group_values, this->m_groups, var, group);
-        this->group_names.reset();
-        return true;
+        return this->group_values.erase(var, group)
+            || (this->values.erase(entity_key(var, group)) > 0);
     }
 
     bool SummaryState::has(const std::string& key) const
     {
-        return this->values.find(key) != this->values.end();
+        return (this->values.find(key) != this->values.end())
+            || (this->find_dense(key) != nullptr);
     }
 
     bool SummaryState::has_well_var(const std::string& well, const std::string& var) const
     {
-        return has_var(this->well_values, var, well);
+        return this->well_values.find(var, well) != nullptr;
     }
 
     bool SummaryState::has_well_var(const std::string& var) const
     {
-        return this->well_values.count(var) != 0;
+        return this->well_values.has_variable(var);
     }
 
     bool SummaryState::has_group_var(const std::string& group, const std::string& var) const
     {
-        return has_var(this->group_values, var, group);
+        return this->group_values.find(var, group) != nullptr;
     }
 
     bool SummaryState::has_group_var(const std::string& var) const
     {
-        return this->group_values.count(var) != 0;
+        return this->group_values.has_variable(var);
     }
 
     bool SummaryState::has_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const
     {
-        if (!has_var(this->conn_values, var, well))
-            return false;
-
-        const auto& index_map = this->conn_values.at(var).at(well);
-        return (index_map.count(global_index) > 0);
+        return this->conn_values.find(var, well, global_index) != nullptr;
     }
 
     bool SummaryState::has_segment_var(const std::string& well,
                                        const std::string& var,
                                        const std::size_t  segment) const
     {
-        // Segment Values = [var][well][segment] -> double
-
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return false;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return false;
-        }
-
-        return wellPos->second.find(segment) != wellPos->second.end();
+        return this->segment_values.find(var, well, segment) != nullptr;
     }
 
-    void SummaryState::update(const std::string& key, double value) {
-        if (is_total(key))
-            this->values[key] += value;
-        else
-            this->values[key] = value;
+    double SummaryState::update(const std::string& key, double value) {
+        auto* current = this->find_dense(key);
+        if (current == nullptr)
+            current = &this->values.try_emplace(key, 0.0).first->second;
+
+        *current = is_total(key) ? *current + value : value;
+        return *current;
     }
 
-    void SummaryState::update_well_var(const std::string& well, const std::string& var, double value) {
-        std::string key = var + ":" + well;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->well_values[var][well] += value;
-        } else {
-            this->values[key] = value;
-            this->well_values[var][well] = value;
-        }
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+    double SummaryState::update_well_var(const std::string& well, const std::string& var, double value) {
+        const auto var_id = this->well_values.variable_id(var);
+        return this->update_entity(this->well_values, var_id,
+                                   this->well_values.entity_id(well), value);
     }
 
-    void SummaryState::update_group_var(const std::string& group, const std::string& var, double value) {
-        std::string key = var + ":" + group;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->group_values[var][group] += value;
-        } else {
-            this->values[key] = value;
-            this->group_values[var][group] = value;
-        }
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+    double SummaryState::update_group_var(const std::string& group, const std::string& var, double value) {
+        const auto var_id = this->group_values.variable_id(var);
+        return this->update_entity(this->group_values, var_id,
+                                   this->group_values.entity_id(group), value);
     }
 
     void SummaryState::update_elapsed(double delta)
@@ -251,37 +728,46 @@ namespace Opm
 
     void SummaryState::update_udq(const UDQSet& udq_set, double undefined_value)
     {
-        const auto var_type = udq_set.var_type();
-        if (var_type == UDQVarType::WELL_VAR) {
-            const std::vector<std::string> wells = this->wells(); // Intentional copy
-            for (const auto& well : wells) {
-                if (! udq_set.has(well)) {
-                    this->update_well_var(well, udq_set.name(), undefined_value);
+        // Single pass over the UDQ set, rather than a name lookup in the
+        // set for each listed entity.  The first element of a given name
+        // wins, and listed entities missing from the set are undefined.
+        const auto update_listed = [this, &udq_set, undefined_value]
+            (EntityValues& table)
+        {
+            const auto var = table.variable_id(udq_set.name());
+
+            auto assigned = std::vector<bool>(table.listed.size(), false);
+            for (const auto& value : udq_set) {
+                const auto entity = table.entities.find(value.wgname());
+                if (! entity.has_value() || ! table.listed[*entity] || assigned[*entity]) {
                     continue;
                 }
 
-                const auto& udq_value = udq_set[well].value();
-                this->update_well_var(well, udq_set.name(), udq_value.value_or(undefined_value));
+                assigned[*entity] = true;
+                this->update_entity(table, var, *entity,
+                                    value.value().value_or(undefined_value));
             }
-        }
-        else if (var_type == UDQVarType::GROUP_VAR) {
-            const std::vector<std::string> groups = this->groups(); // Intentional copy
-            for (const auto& group : groups) {
-                if (! udq_set.has(group)) {
-                    this->update_group_var(group, udq_set.name(), undefined_value);
-                    continue;
-                }
 
-                const auto& udq_value = udq_set[group].value();
-                this->update_group_var(group, udq_set.name(), udq_value.value_or(undefined_value));
+            for (std::size_t entity = 0; entity < table.listed.size(); ++entity) {
+                if (table.listed[entity] && ! assigned[entity]) {
+                    this->update_entity(table, var, entity, undefined_value);
+                }
             }
+        };
+
+        const auto var_type = udq_set.var_type();
+        if (var_type == UDQVarType::WELL_VAR) {
+            update_listed(this->well_values);
+        }
+        else if (var_type == UDQVarType::GROUP_VAR) {
+            update_listed(this->group_values);
         }
         else if (var_type == UDQVarType::SEGMENT_VAR) {
-            for (const auto& udq_value : udq_set) {
-                this->update_segment_var(udq_value.wgname(),
+            for (const auto& value : udq_set) {
+                this->update_segment_var(value.wgname(),
                                          udq_set.name(),
-                                         udq_value.number(),
-                                         udq_value.value().value_or(undefined_value));
+                                         value.number(),
+                                         value.value().value_or(undefined_value));
             }
         }
         else {
@@ -290,51 +776,148 @@ namespace Opm
         }
     }
 
-    void SummaryState::update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value)
+    double SummaryState::update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value)
+    {
+        const auto var_id = this->conn_values.variable_id(var);
+        return this->update_indexed(this->conn_values, var_id,
+                                    this->conn_values.well_id(well), global_index, value);
+    }
+
+    double SummaryState::update_segment_var(const std::string& well,
+                                            const std::string& var,
+                                            const std::size_t  segment,
+                                            const double       value)
+    {
+        const auto var_id = this->segment_values.variable_id(var);
+        return this->update_indexed(this->segment_values, var_id,
+                                    this->segment_values.well_id(well), segment, value);
+    }
+
+    std::size_t SummaryState::well_id(const std::string& well)
+    {
+        return this->well_values.entity_id(well);
+    }
+
+    std::size_t SummaryState::well_var_id(const std::string& var)
     {
-        std::string key = var + ":" + well + ":" + std::to_string(global_index);
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->conn_values[var][well][global_index] += value;
-        } else {
-            this->values[key] = value;
-            this->conn_values[var][well][global_index] = value;
+        return this->well_values.variable_id(var);
+    }
+
+    std::size_t SummaryState::group_id(const std::string& group)
+    {
+        return this->group_values.entity_id(group);
+    }
+
+    std::size_t SummaryState::group_var_id(const std::string& var)
+    {
+        return this->group_values.variable_id(var);
+    }
+
+    std::optional<std::size_t> SummaryState::find_well_id(const std::string& well) const
+    {
+        return this->well_values.entities.find(well);
+    }
+
+    std::optional<std::size_t> SummaryState::find_well_var_id(const std::string& var) const
+    {
+        return this->well_values.variables.find(var);
+    }
+
+    std::optional<std::size_t> SummaryState::find_group_id(const std::string& group) const
+    {
+        return this->group_values.entities.find(group);
+    }
+
+    std::optional<std::size_t> SummaryState::find_group_var_id(const std::string& var) const
+    {
+        return this->group_values.variables.find(var);
+    }
+
+    void SummaryState::update_well_vars(const std::string&              var,
+                                        const std::vector<std::string>& wells,
+                                        const std::vector<double>&      well_vals)
+    {
+        check_batch_size(wells.size(), well_vals.size());
+
+        const auto var_id = this->well_values.variable_id(var);
+        for (std::size_t i = 0; i < wells.size(); ++i) {
+            this->update_entity(this->well_values, var_id,
+                                this->well_values.entity_id(wells[i]), well_vals[i]);
         }
     }
 
-    void SummaryState::update_segment_var(const std::string& well,
-                                          const std::string& var,
-                                          const std::size_t  segment,
-                                          const double       value)
+    void SummaryState::update_well_vars(const std::size_t               var_id,
+                                        const std::vector<std::size_t>& well_ids,
+                                        const std::vector<double>&      well_vals)
     {
-        auto& val_ref  = this->values[var + ':' + well + ':' + std::to_string(segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
+        check_batch_size(well_ids.size(), well_vals.size());
 
-        if (is_total(var)) {
-            val_ref  += value;
-            sval_ref += value;
+        const auto num_wells = this->well_values.entities.size();
+        if ((var_id >= this->well_values.variables.size()) ||
+            std::any_of(well_ids.begin(), well_ids.end(),
+                        [num_wells](const std::size_t id) { return id >= num_wells; }))
+        {
+            throw std::out_of_range("Invalid well or variable ID in batched summary update");
         }
-        else {
-            val_ref = sval_ref = value;
+
+        for (std::size_t i = 0; i < well_ids.size(); ++i) {
+            this->update_entity(this->well_values, var_id,
+                                well_ids[i], well_vals[i]);
+        }
+    }
+
+    void SummaryState::update_group_vars(const std::string&              var,
+                                         const std::vector<std::string>& groups,
+                                         const std::vector<double>&      group_vals)
+    {
+        check_batch_size(groups.size(), group_vals.size());
+
+        const auto var_id = this->group_values.variable_id(var);
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            this->update_entity(this->group_values, var_id,
+                                this->group_values.entity_id(groups[i]), group_vals[i]);
+        }
+    }
+
+    void SummaryState::update_group_vars(const std::size_t               var_id,
+                                         const std::vector<std::size_t>& group_ids,
+                                         const std::vector<double>&      group_vals)
+    {
+        check_batch_size(group_ids.size(), group_vals.size());
+
+        const auto num_groups = this->group_values.entities.size();
+        if ((var_id >= this->group_values.variables.size()) ||
+            std::any_of(group_ids.begin(), group_ids.end(),
+                        [num_groups](const std::size_t id) { return id >= num_groups; }))
+        {
+            throw std::out_of_range("Invalid group or variable ID in batched summary update");
+        }
+
+        for (std::size_t i = 0; i < group_ids.size(); ++i) {
+            this->update_entity(this->group_values, var_id,
+                                group_ids[i], group_vals[i]);
         }
     }
 
     double SummaryState::get(const std::string& key) const
     {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        if (const auto iter = this->values.find(key); iter != this->values.end())
+            return iter->second;
+
+        const auto* dense_value = this->find_dense(key);
+        if (dense_value == nullptr)
             throw std::out_of_range("No such key: " + key);
 
-        return iter->second;
+        return *dense_value;
     }
 
     double SummaryState::get(const std::string& key, double default_value) const
     {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
-            return default_value;
+        if (const auto iter = this->values.find(key); iter != this->values.end())
+            return iter->second;
 
-        return iter->second;
+        const auto* dense_value = this->find_dense(key);
+        return (dense_value == nullptr) ? default_value : *dense_value;
     }
 
     double SummaryState::get_elapsed() const
@@ -344,47 +927,58 @@ namespace Opm
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var) const
     {
-        return this->well_values.at(var).at(well);
+        const auto* cell = this->well_values.find(var, well);
+        if (cell == nullptr)
+            throw std::out_of_range("No such well variable: " + entity_key(var, well));
+
+        return cell->value;
     }
 
     double SummaryState::get_group_var(const std::string& group, const std::string& var) const
     {
-        return this->group_values.at(var).at(group);
+        const auto* cell = this->group_values.find(var, group);
+        if (cell == nullptr)
+            throw std::out_of_range("No such group variable: " + entity_key(var, group));
+
+        return cell->value;
     }
 
     double SummaryState::get_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const
     {
-        return this->conn_values.at(var).at(well).at(global_index);
+        const auto* cell = this->conn_values.find(var, well, global_index);
+        if (cell == nullptr)
+            throw std::out_of_range("No such connection variable: " + indexed_key(var, well, global_index));
+
+        return cell->value;
     }
 
     double SummaryState::get_segment_var(const std::string& well,
                                          const std::string& var,
                                          const std::size_t  segment) const
     {
-        return this->segment_values.at(var).at(well).at(segment);
+        const auto* cell = this->segment_values.find(var, well, segment);
+        if (cell == nullptr)
+            throw std::out_of_range("No such segment variable: " + indexed_key(var, well, segment));
+
+        return cell->value;
     }
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var, double default_value) const
     {
-        if (this->has_well_var(well, var))
-            return this->get_well_var(well, var);
-
-        return default_value;
+        const auto* cell = this->well_values.find(var, well);
+        return (cell == nullptr) ? default_value : cell->value;
     }
 
     double SummaryState::get_group_var(const std::string& group, const std::string& var, double default_value) const
     {
-        if (this->has_group_var(group, var))
-            return this->get_group_var(group, var);
-
-        return default_value;
+        const auto* cell = this->group_values.find(var, group);
+        return (cell == nullptr) ? default_value : cell->value;
     }
 
     double SummaryState::get_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double default_value) const
     {
-        if (this->has_conn_var(well, var, global_index))
-            return this->get_conn_var(well, var, global_index);
-        return default_value;
+        const auto* cell = this->conn_values.find(var, well, global_index);
+        return (cell == nullptr) ? default_value : cell->value;
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -392,147 +986,188 @@ namespace Opm
                                          const std::size_t  segment,
                                          const double       default_value) const
     {
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return default_value;
-        }
+        const auto* cell = this->segment_values.find(var, well, segment);
+        return (cell == nullptr) ? default_value : cell->value;
+    }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
+    double SummaryState::get_well_var(const std::size_t var_id, const std::size_t well_id, const double default_value) const
+    {
+        const auto* cell = this->well_values.find(var_id, well_id);
+        return (cell == nullptr) ? default_value : cell->value;
+    }
 
-        auto valPos = wellPos->second.find(segment);
-        return (valPos == wellPos->second.end())
-            ? default_value
-            : valPos->second;
+    double SummaryState::get_group_var(const std::size_t var_id, const std::size_t group_id, const double default_value) const
+    {
+        const auto* cell = this->group_values.find(var_id, group_id);
+        return (cell == nullptr) ? default_value : cell->value;
     }
 
     const std::vector<std::string>& SummaryState::wells() const
     {
-        if (!this->well_names) {
-            this->well_names = std::vector<std::string>(this->m_wells.begin(), this->m_wells.end());
-        }
-
-        return *this->well_names;
+        return this->well_values.names();
     }
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
-        return var2_list(this->well_values, var);
+        return this->well_values.names(var);
     }
 
     const std::vector<std::string>& SummaryState::groups() const
     {
-        if (!this->group_names) {
-            this->group_names = std::vector<std::string>(this->m_groups.begin(), this->m_groups.end());
-        }
-
-        return *this->group_names;
+        return this->group_values.names();
     }
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const
     {
-        return var2_list(this->group_values, var);
+        return this->group_values.names(var);
     }
 
     void SummaryState::append(const SummaryState& buffer)
     {
+
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
         this->values = buffer.values;
-        this->well_names.reset();
-        this->group_names.reset();
-
-        this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
-        }
 
-        this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
-        }
-
-        for (const auto& [var, vals] : buffer.conn_values) {
-            this->conn_values.insert_or_assign(var, vals);
-        }
-
-        for (const auto& [var, vals] : buffer.segment_values) {
-            this->segment_values.insert_or_assign(var, vals);
-        }
+        this->well_values.append(buffer.well_values);
+        this->group_values.append(buffer.group_values);
+        this->conn_values.append(buffer.conn_values);
+        this->segment_values.append(buffer.segment_values);
     }
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return const_iterator { *this, const_iterator::Table::Values };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return const_iterator { *this, const_iterator::Table::End };
     }
 
     std::size_t SummaryState::num_wells() const
     {
-        return this->m_wells.size();
+        return this->well_values.num_listed;
     }
 
     std::size_t SummaryState::size() const
     {
-        return this->values.size();
+        return this->values.size()
+            + this->well_values.num_defined()
+            + this->group_values.num_defined()
+            + this->conn_values.num_defined()
+            + this->segment_values.num_defined();
     }
 
     bool SummaryState::operator==(const SummaryState& other) const
     {
+
         return (this->sim_start == other.sim_start)
             && (this->elapsed == other.elapsed)
             && (this->values == other.values)
             && (this->well_values == other.well_values)
-            && (this->m_wells == other.m_wells)
-            && (this->wells() == other.wells())
             && (this->group_values == other.group_values)
-            && (this->m_groups == other.m_groups)
-            && (this->groups() == other.groups())
             && (this->conn_values == other.conn_values)
             && (this->segment_values == other.segment_values);
     }
 
-    SummaryState SummaryState::serializationTestObject()
+    const double* SummaryState::find_dense(const std::string& key) const
     {
-        auto st = SummaryState{TimeService::from_time_t(101)};
+        const auto parts = split_key(key);
+        if (! parts.has_value())
+            return nullptr;
+
+        if (parts->index.has_value()) {
+            for (const auto* table : { &this->conn_values, &this->segment_values }) {
+                const auto* cell = table->find(parts->var, parts->name, *parts->index);
+                if (cell != nullptr)
+                    return &cell->value;
+            }
 
-        st.elapsed = 1.0;
-        st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
-        st.m_wells = {"test4"};
-        st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
-        st.m_groups = {"test7"};
-        st.group_names = {"test8"},
-        st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
+            return nullptr;
+        }
 
-        {
-            auto& sval = st.segment_values["SU1"];
-            sval.emplace("W1", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 1},  123.456   },
-                    { std::size_t{ 2},   17.29    },
-                    { std::size_t{10}, -  2.71828 },
-                });
+        for (const auto* table : { &this->well_values, &this->group_values }) {
+            const auto* cell = table->find(parts->var, parts->name);
+            if (cell != nullptr)
+                return &cell->value;
+        }
+
+        return nullptr;
+    }
+
+    double* SummaryState::find_dense(const std::string& key)
+    {
+        return const_cast<double*>(std::as_const(*this).find_dense(key));
+    }
 
-            sval.emplace("W6", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 7}, 3.1415926535 },
-                });
+    bool SummaryState::erase_dense(const std::string& key)
+    {
+        const auto parts = split_key(key);
+        if (! parts.has_value())
+            return false;
+
+        if (parts->index.has_value()) {
+            return this->conn_values.erase(parts->var, parts->name, *parts->index)
+                || this->segment_values.erase(parts->var, parts->name, *parts->index);
         }
 
-        {
-            auto& sval = st.segment_values["SUVIS"];
-            sval.emplace("I2", std::unordered_map<std::size_t, double> {
-                    { std::size_t{17},  29.0   },
-                    { std::size_t{42}, - 1.618 },
-                });
+        return this->well_values.erase(parts->var, parts->name)
+            || this->group_values.erase(parts->var, parts->name);
+    }
+
+    // A value is stored in either the dense tables or the general map,
+    // never both.  The key string is therefore only formed when a value
+    // is first defined, in case it was assigned through set() or update()
+    // before.
+    double SummaryState::update_entity(EntityValues&     table,
+                                       const std::size_t var,
+                                       const std::size_t entity,
+                                       const double      value)
+    {
+        const auto [new_value, is_new] = table.update(var, entity, value);
+        if (is_new && ! this->values.empty()) {
+            this->values.erase(entity_key(table.variables.name(var),
+                                          table.entities.name(entity)));
         }
 
+        return new_value;
+    }
+
+    double SummaryState::update_indexed(IndexedValues&    table,
+                                        const std::size_t var,
+                                        const std::size_t well,
+                                        const std::size_t index,
+                                        const double      value)
+    {
+        const auto [new_value, is_new] = table.update(var, well, index, value);
+        if (is_new && ! this->values.empty()) {
+            this->values.erase(indexed_key(table.variables.name(var),
+                                           table.wells.name(well),
+                                           index));
+        }
+
+        return new_value;
+    }
+
+    SummaryState SummaryState::serializationTestObject()
+    {
+        auto st = SummaryState{TimeService::from_time_t(101)};
+
+        st.elapsed = 1.0;
+        st.values = {{"test1", 2.0}};
+        st.update_well_var("test4", "test2", 3.0);
+        st.update_well_var("test5", "test3", 5.0);
+        st.update_group_var("test7", "test6", 4.0);
+        st.update_conn_var("test10", "test9", 5, 6.0);
+
+        st.update_segment_var("W1", "SU1",  1,  123.456);
+        st.update_segment_var("W1", "SU1",  2,   17.29);
+        st.update_segment_var("W1", "SU1", 10, -  2.71828);
+        st.update_segment_var("W6", "SU1",  7, 3.1415926535);
+        st.update_segment_var("I2", "SUVIS", 17,  29.0);
+        st.update_segment_var("I2", "SUVIS", 42, - 1.618);
+
         return st;
     }
 
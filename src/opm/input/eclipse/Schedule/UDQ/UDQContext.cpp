@@ -27,9 +27,11 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -176,6 +178,86 @@ namespace Opm {
         };
     }
 
+    void UDQContext::well_values(const std::string&   var,
+                                 std::vector<double>& well_values) const
+    {
+        const auto wells = this->wells();
+
+        well_values.resize(wells.size());
+        if (wells.empty()) {
+            return;
+        }
+
+        constexpr auto undefined = std::numeric_limits<double>::quiet_NaN();
+
+        if (is_udq(var)) {
+            std::transform(wells.begin(), wells.end(), well_values.begin(),
+                           [this, &var](const std::string& well)
+                           {
+                               return this->udq_state.has_well_var(well, var)
+                                   ? this->udq_state.get_well_var(well, var)
+                                   : undefined;
+                           });
+            return;
+        }
+
+        if (! this->summary_state.has_well_var(var)) {
+            throw std::logic_error {
+                fmt::format("Summary well variable: {} not registered", var)
+            };
+        }
+
+        const auto var_id = *this->summary_state.find_well_var_id(var);
+        std::transform(wells.begin(), wells.end(), well_values.begin(),
+                       [this, var_id](const std::string& well)
+                       {
+                           const auto well_id = this->summary_state.find_well_id(well);
+                           return well_id.has_value()
+                               ? this->summary_state.get_well_var(var_id, *well_id, undefined)
+                               : undefined;
+                       });
+    }
+
+    void UDQContext::group_values(const std::string&   var,
+                                  std::vector<double>& group_values) const
+    {
+        const auto groups = this->groups();
+
+        group_values.resize(groups.size());
+        if (groups.empty()) {
+            return;
+        }
+
+        constexpr auto undefined = std::numeric_limits<double>::quiet_NaN();
+
+        if (is_udq(var)) {
+            std::transform(groups.begin(), groups.end(), group_values.begin(),
+                           [this, &var](const std::string& group)
+                           {
+                               return this->udq_state.has_group_var(group, var)
+                                   ? this->udq_state.get_group_var(group, var)
+                                   : undefined;
+                           });
+            return;
+        }
+
+        if (! this->summary_state.has_group_var(var)) {
+            throw std::logic_error {
+                fmt::format("Summary group variable: {} not registered", var)
+            };
+        }
+
+        const auto var_id = *this->summary_state.find_group_var_id(var);
+        std::transform(groups.begin(), groups.end(), group_values.begin(),
+                       [this, var_id](const std::string& group)
+                       {
+                           const auto group_id = this->summary_state.find_group_id(group);
+                           return group_id.has_value()
+                               ? this->summary_state.get_group_var(var_id, *group_id, undefined)
+                               : undefined;
+                       });
+    }
+
     const UDT&
     UDQContext::get_udt(const std::string& name) const
     {
@@ -25,6 +25,7 @@
 #include <opm/input/eclipse/Schedule/MSW/SegmentMatcher.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQToken.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
@@ -267,6 +268,8 @@ UDQDefine::UDQDefine(const UDQParams&                udq_params,
                           this->m_tokens,
                           parseContext,
                           errors));
+
+    this->compile();
 }
 
 void UDQDefine::update_status(const UDQUpdate   update,
@@ -290,6 +293,26 @@ UDQDefine UDQDefine::serializationTestObject()
     return result;
 }
 
+void UDQDefine::compile()
+{
+    this->program.reset();
+
+    if (this->ast == nullptr) {
+        return;
+    }
+
+    if (auto compiled = UDQProgram::compile(*this->ast, this->m_var_type);
+        compiled.has_value())
+    {
+        this->program = std::make_shared<const UDQProgram>(*std::move(compiled));
+    }
+}
+
+bool UDQDefine::compiled() const
+{
+    return this->program != nullptr;
+}
+
 void UDQDefine::required_summary(std::unordered_set<std::string>& summary_keys) const
 {
     this->ast->required_summary(summary_keys);
@@ -299,7 +322,14 @@ UDQSet UDQDefine::eval(const UDQContext& context) const
 {
     std::optional<UDQSet> res;
     try {
-        res = this->ast->eval(this->m_var_type, context);
+        if (this->program != nullptr) {
+            res = this->program->eval(this->m_keyword, context);
+        }
+
+        if (! res.has_value()) {
+            res = this->ast->eval(this->m_var_type, context);
+        }
+
         res->name(this->m_keyword);
 
         if (!dynamic_type_check(this->var_type(), res->var_type())) {
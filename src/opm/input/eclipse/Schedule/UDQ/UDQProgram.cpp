@@ -0,0 +1,578 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+
+constexpr double undefined = std::numeric_limits<double>::quiet_NaN();
+
+// UDQScalar::assign() treats all non-finite values as undefined.
+double defined_or_nan(const double x)
+{
+    return std::isfinite(x) ? x : undefined;
+}
+
+double checked_log(const double x, double (*logfunc)(double), const char* name)
+{
+    if (std::isnan(x)) {
+        return x;
+    }
+
+    if (! (x > 0.0)) {
+        throw std::invalid_argument {
+            "Argument: " + std::to_string(x) + " invalid for function " + name
+        };
+    }
+
+    return logfunc(x);
+}
+
+// Element-wise operation on two operands, one of which may be a scalar.
+// Result stored in lhs.  Returns false if a scalar operand is undefined,
+// which the syntax tree reports as an error when broadcasting it.
+template <class BinOp>
+bool broadcast(std::vector<double>& lhs, const bool lhs_set,
+               const std::vector<double>& rhs, const bool rhs_set,
+               const std::size_t size, BinOp&& op)
+{
+    if (lhs_set == rhs_set) {
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            lhs[i] = op(lhs[i], rhs[i]);
+        }
+
+        return true;
+    }
+
+    if (lhs_set) {
+        const auto scalar = rhs.front();
+        if (std::isnan(scalar)) {
+            return false;
+        }
+
+        for (auto& x : lhs) {
+            x = op(x, scalar);
+        }
+
+        return true;
+    }
+
+    const auto scalar = lhs.front();
+    if (std::isnan(scalar)) {
+        return false;
+    }
+
+    lhs.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        lhs[i] = op(scalar, rhs[i]);
+    }
+
+    return true;
+}
+
+// Semantics of udq_union() followed by an operation on the elements
+// defined in both operands.
+template <class BinOp>
+double union_op(const double lhs, const double rhs, BinOp&& op)
+{
+    if (std::isnan(lhs)) {
+        return rhs;
+    }
+
+    if (std::isnan(rhs)) {
+        return lhs;
+    }
+
+    return defined_or_nan(op(lhs, rhs));
+}
+
+// Reduction over the defined values of an operand.  Returns false if
+// there are no defined values, in which case the syntax tree produces an
+// empty set.
+template <class Reduce>
+bool reduce(std::vector<double>& arg, Reduce&& reduce_op)
+{
+    auto result = 0.0;
+    auto count = std::size_t{0};
+    for (const auto& x : arg) {
+        if (! std::isnan(x)) {
+            result = (count == 0) ? x : reduce_op(result, x);
+            ++count;
+        }
+    }
+
+    if (count == 0) {
+        return false;
+    }
+
+    arg.assign(1, result);
+    return true;
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+UDQProgram::UDQProgram(const UDQVarType target)
+    : target_type(target)
+{}
+
+std::optional<UDQProgram>
+UDQProgram::compile(const UDQASTNode& ast, const UDQVarType target)
+{
+    if ((target != UDQVarType::WELL_VAR) &&
+        (target != UDQVarType::GROUP_VAR))
+    {
+        return std::nullopt;
+    }
+
+    auto program = UDQProgram { target };
+    auto stack = std::vector<bool>{};
+    if (! program.compile_node(ast, stack) || (stack.size() != 1)) {
+        return std::nullopt;
+    }
+
+    return program;
+}
+
+void UDQProgram::push(const OpCode       op,
+                      const bool         is_set,
+                      std::vector<bool>& stack,
+                      const double       value,
+                      const std::string& var,
+                      const std::string& wgname)
+{
+    auto name_index = [this](const std::string& name)
+    {
+        auto pos = std::find(this->names.begin(), this->names.end(), name);
+        if (pos == this->names.end()) {
+            pos = this->names.insert(pos, name);
+        }
+
+        return static_cast<std::size_t>(pos - this->names.begin());
+    };
+
+    auto instr = Instruction { op, is_set, false, false, value, 0, 0 };
+
+    if (! var.empty()) {
+        instr.var = name_index(var);
+    }
+
+    if (! wgname.empty()) {
+        instr.wgname = name_index(wgname);
+    }
+
+    switch (op) {
+    case OpCode::LoadSet: case OpCode::LoadWell: case OpCode::LoadGroup:
+    case OpCode::LoadField: case OpCode::LoadScalar: case OpCode::Constant:
+        stack.push_back(is_set);
+        break;
+
+    case OpCode::Add: case OpCode::Sub: case OpCode::Mul: case OpCode::Div:
+    case OpCode::Pow: case OpCode::UAdd: case OpCode::UMul: case OpCode::UMin:
+    case OpCode::UMax:
+        instr.rhs_set = stack.back();
+        stack.pop_back();
+        instr.lhs_set = stack.back();
+        stack.back() = is_set;
+        break;
+
+    default:
+        instr.lhs_set = stack.back();
+        stack.back() = is_set;
+        break;
+    }
+
+    this->max_depth = std::max(this->max_depth, stack.size());
+    this->code.push_back(instr);
+}
+
+bool UDQProgram::compile_node(const UDQASTNode& node, std::vector<bool>& stack)
+{
+    const auto type = node.type;
+
+    if (type == UDQTokenType::number) {
+        // UDQASTNode::eval_number() creates a full set for well and group
+        // targets.
+        this->push(OpCode::Constant, true, stack, std::get<double>(node.value));
+    }
+    else if (type == UDQTokenType::ecl_expr) {
+        if (! this->compile_expression(node, stack)) {
+            return false;
+        }
+    }
+    else if (UDQ::scalarFunc(type)) {
+        if ((node.left == nullptr) || ! this->compile_node(*node.left, stack)) {
+            return false;
+        }
+
+        switch (type) {
+        case UDQTokenType::scalar_func_sum:  this->push(OpCode::Sum,  false, stack); break;
+        case UDQTokenType::scalar_func_prod: this->push(OpCode::Prod, false, stack); break;
+        case UDQTokenType::scalar_func_min:  this->push(OpCode::Min,  false, stack); break;
+        case UDQTokenType::scalar_func_max:  this->push(OpCode::Max,  false, stack); break;
+        case UDQTokenType::scalar_func_avea: this->push(OpCode::Avea, false, stack); break;
+        default:
+            return false;
+        }
+    }
+    else if (UDQ::elementalUnaryFunc(type)) {
+        if ((node.left == nullptr) || ! this->compile_node(*node.left, stack)) {
+            return false;
+        }
+
+        const auto is_set = stack.back();
+        switch (type) {
+        case UDQTokenType::elemental_func_abs:  this->push(OpCode::Abs,  is_set, stack); break;
+        case UDQTokenType::elemental_func_def:  this->push(OpCode::Def,  is_set, stack); break;
+        case UDQTokenType::elemental_func_exp:  this->push(OpCode::Exp,  is_set, stack); break;
+        case UDQTokenType::elemental_func_idv:  this->push(OpCode::Idv,  is_set, stack); break;
+        case UDQTokenType::elemental_func_ln:   this->push(OpCode::Ln,   is_set, stack); break;
+        case UDQTokenType::elemental_func_log:  this->push(OpCode::Log,  is_set, stack); break;
+        case UDQTokenType::elemental_func_nint: this->push(OpCode::Nint, is_set, stack); break;
+        default:
+            return false;
+        }
+    }
+    else if (UDQ::binaryFunc(type)) {
+        if ((node.left == nullptr) || (node.right == nullptr) ||
+            ! this->compile_node(*node.left, stack) ||
+            ! this->compile_node(*node.right, stack))
+        {
+            return false;
+        }
+
+        const auto lhs_set = stack[stack.size() - 2];
+        const auto rhs_set = stack.back();
+        const auto is_set = lhs_set || rhs_set;
+
+        // Only the arithmetic operators broadcast scalars to sets.
+        const auto same_shape = lhs_set == rhs_set;
+
+        switch (type) {
+        case UDQTokenType::binary_op_add: this->push(OpCode::Add, is_set, stack); break;
+        case UDQTokenType::binary_op_sub: this->push(OpCode::Sub, is_set, stack); break;
+        case UDQTokenType::binary_op_mul: this->push(OpCode::Mul, is_set, stack); break;
+        case UDQTokenType::binary_op_div: this->push(OpCode::Div, is_set, stack); break;
+        case UDQTokenType::binary_op_pow:
+            if (! same_shape) return false;
+            this->push(OpCode::Pow, is_set, stack);
+            break;
+        case UDQTokenType::binary_op_uadd:
+            if (! same_shape) return false;
+            this->push(OpCode::UAdd, is_set, stack);
+            break;
+        case UDQTokenType::binary_op_umul:
+            if (! same_shape) return false;
+            this->push(OpCode::UMul, is_set, stack);
+            break;
+        case UDQTokenType::binary_op_umin:
+            if (! same_shape) return false;
+            this->push(OpCode::UMin, is_set, stack);
+            break;
+        case UDQTokenType::binary_op_umax:
+            if (! same_shape) return false;
+            this->push(OpCode::UMax, is_set, stack);
+            break;
+        default:
+            return false;
+        }
+    }
+    else {
+        return false;
+    }
+
+    if (node.sign != 1.0) {
+        this->push(OpCode::Scale, stack.back(), stack, node.sign);
+    }
+
+    return true;
+}
+
+bool UDQProgram::compile_expression(const UDQASTNode& node, std::vector<bool>& stack)
+{
+    const auto& var = std::get<std::string>(node.value);
+    const auto data_type = UDQ::targetType(var);
+
+    if ((data_type == UDQVarType::WELL_VAR) ||
+        (data_type == UDQVarType::GROUP_VAR))
+    {
+        if (node.selector.empty()) {
+            // Full set, combined element-wise with sets of the target
+            // type only.
+            if (data_type != this->target_type) {
+                return false;
+            }
+
+            this->push(OpCode::LoadSet, true, stack, 0.0, var);
+            return true;
+        }
+
+        const auto& wgname = node.selector.front();
+        if (wgname.find('*') != std::string::npos) {
+            return false;
+        }
+
+        // Fully qualified well or group name evaluates to a scalar.
+        this->push((data_type == UDQVarType::WELL_VAR) ? OpCode::LoadWell : OpCode::LoadGroup,
+                   false, stack, 0.0, var, wgname);
+        return true;
+    }
+
+    if (data_type == UDQVarType::SEGMENT_VAR) {
+        return false;
+    }
+
+    this->push((data_type == UDQVarType::FIELD_VAR) ? OpCode::LoadField : OpCode::LoadScalar,
+               false, stack, 0.0, var);
+    return true;
+}
+
+std::optional<UDQSet>
+UDQProgram::eval(const std::string& keyword, const UDQContext& context) const
+{
+    const auto is_well = this->target_type == UDQVarType::WELL_VAR;
+    const auto wgnames = is_well ? context.wells() : context.groups();
+    const auto size = wgnames.size();
+
+    // Scratch space reused between evaluations.  The entries keep their
+    // capacity, so repeated evaluations do not allocate.
+    thread_local std::vector<std::vector<double>> stack;
+    if (stack.size() < this->max_depth) {
+        stack.resize(this->max_depth);
+    }
+
+    auto top = std::size_t{0};
+    for (const auto& instr : this->code) {
+        switch (instr.op) {
+        case OpCode::LoadSet: {
+            auto& out = stack[top++];
+            if (is_well) {
+                context.well_values(this->names[instr.var], out);
+            }
+            else {
+                context.group_values(this->names[instr.var], out);
+            }
+
+            for (auto& x : out) {
+                x = defined_or_nan(x);
+            }
+            break;
+        }
+
+        case OpCode::LoadWell:
+        case OpCode::LoadGroup: {
+            const auto& var = this->names[instr.var];
+            const auto& wgname = this->names[instr.wgname];
+            const auto value = (instr.op == OpCode::LoadWell)
+                ? context.get_well_var(wgname, var)
+                : context.get_group_var(wgname, var);
+
+            stack[top++].assign(1, defined_or_nan(value.value_or(undefined)));
+            break;
+        }
+
+        case OpCode::LoadField:
+        case OpCode::LoadScalar: {
+            const auto value = context.get(this->names[instr.var]);
+            if ((instr.op == OpCode::LoadScalar) && ! value.has_value()) {
+                return std::nullopt;
+            }
+
+            stack[top++].assign(1, defined_or_nan(value.value_or(undefined)));
+            break;
+        }
+
+        case OpCode::Constant:
+            stack[top++].assign(size, defined_or_nan(instr.value));
+            break;
+
+        case OpCode::Add: case OpCode::Sub: case OpCode::Mul: case OpCode::Div: {
+            auto& lhs = stack[top - 2];
+            const auto& rhs = stack[top - 1];
+
+            auto ok = true;
+            switch (instr.op) {
+            case OpCode::Add:
+                ok = broadcast(lhs, instr.lhs_set, rhs, instr.rhs_set, size,
+                               [](const double a, const double b) { return defined_or_nan(a + b); });
+                break;
+            case OpCode::Sub:
+                ok = broadcast(lhs, instr.lhs_set, rhs, instr.rhs_set, size,
+                               [](const double a, const double b) { return defined_or_nan(a - b); });
+                break;
+            case OpCode::Mul:
+                ok = broadcast(lhs, instr.lhs_set, rhs, instr.rhs_set, size,
+                               [](const double a, const double b) { return defined_or_nan(a * b); });
+                break;
+            default:
+                ok = broadcast(lhs, instr.lhs_set, rhs, instr.rhs_set, size,
+                               [](const double a, const double b) { return defined_or_nan(a / b); });
+                break;
+            }
+
+            if (! ok) {
+                return std::nullopt;
+            }
+
+            --top;
+            break;
+        }
+
+        case OpCode::Pow: {
+            // UDQBinaryFunction::POW() retains the left hand side where
+            // the right hand side is undefined.
+            auto& lhs = stack[top - 2];
+            const auto& rhs = stack[top - 1];
+            for (std::size_t i = 0; i < lhs.size(); ++i) {
+                if (! std::isnan(lhs[i]) && ! std::isnan(rhs[i])) {
+                    lhs[i] = defined_or_nan(std::pow(lhs[i], rhs[i]));
+                }
+            }
+
+            --top;
+            break;
+        }
+
+        case OpCode::UAdd: case OpCode::UMul: case OpCode::UMin: case OpCode::UMax: {
+            auto& lhs = stack[top - 2];
+            const auto& rhs = stack[top - 1];
+            for (std::size_t i = 0; i < lhs.size(); ++i) {
+                switch (instr.op) {
+                case OpCode::UAdd:
+                    lhs[i] = union_op(lhs[i], rhs[i], [](const double a, const double b) { return a + b; });
+                    break;
+                case OpCode::UMul:
+                    lhs[i] = union_op(lhs[i], rhs[i], [](const double a, const double b) { return a * b; });
+                    break;
+                case OpCode::UMin:
+                    lhs[i] = union_op(lhs[i], rhs[i], [](const double a, const double b) { return std::min(a, b); });
+                    break;
+                default:
+                    lhs[i] = union_op(lhs[i], rhs[i], [](const double a, const double b) { return std::max(a, b); });
+                    break;
+                }
+            }
+
+            --top;
+            break;
+        }
+
+        case OpCode::Abs:
+            for (auto& x : stack[top - 1]) { x = std::fabs(x); }
+            break;
+
+        case OpCode::Def:
+            for (auto& x : stack[top - 1]) { x = std::isnan(x) ? x : 1.0; }
+            break;
+
+        case OpCode::Exp:
+            for (auto& x : stack[top - 1]) { x = defined_or_nan(std::exp(x)); }
+            break;
+
+        case OpCode::Idv:
+            for (auto& x : stack[top - 1]) { x = std::isnan(x) ? 0.0 : 1.0; }
+            break;
+
+        case OpCode::Ln:
+            for (auto& x : stack[top - 1]) { x = defined_or_nan(checked_log(x, std::log, "LN")); }
+            break;
+
+        case OpCode::Log:
+            for (auto& x : stack[top - 1]) { x = defined_or_nan(checked_log(x, std::log10, "LOG")); }
+            break;
+
+        case OpCode::Nint:
+            for (auto& x : stack[top - 1]) { x = std::nearbyint(x); }
+            break;
+
+        case OpCode::Sum: case OpCode::Prod: case OpCode::Min: case OpCode::Max: case OpCode::Avea: {
+            auto& arg = stack[top - 1];
+
+            auto ok = true;
+            switch (instr.op) {
+            case OpCode::Sum:
+                ok = reduce(arg, [](const double a, const double b) { return a + b; });
+                break;
+            case OpCode::Prod:
+                ok = reduce(arg, [](const double a, const double b) { return a * b; });
+                break;
+            case OpCode::Min:
+                ok = reduce(arg, [](const double a, const double b) { return std::min(a, b); });
+                break;
+            case OpCode::Max:
+                ok = reduce(arg, [](const double a, const double b) { return std::max(a, b); });
+                break;
+            default: {
+                const auto count = std::count_if(arg.begin(), arg.end(),
+                                                 [](const double x) { return ! std::isnan(x); });
+                ok = reduce(arg, [](const double a, const double b) { return a + b; });
+                if (ok) {
+                    arg.front() /= count;
+                }
+                break;
+            }
+            }
+
+            if (! ok) {
+                return std::nullopt;
+            }
+
+            arg.front() = defined_or_nan(arg.front());
+            break;
+        }
+
+        case OpCode::Scale:
+            for (auto& x : stack[top - 1]) { x = defined_or_nan(x * instr.value); }
+            break;
+        }
+    }
+
+    const auto& result = stack.front();
+    if (! this->code.back().is_set) {
+        return UDQSet::scalar(keyword, result.front());
+    }
+
+    auto res = is_well
+        ? UDQSet::wells(keyword, wgnames)
+        : UDQSet::groups(keyword, wgnames);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        res.assign(i, result[i]);
+    }
+
+    return res;
+}
+
+} // namespace Opm
@@ -304,8 +304,9 @@ std::size_t UDQSet::size() const
 void UDQSet::assign(const std::string& wgname, const double value)
 {
     bool assigned = false;
+    const auto pattern = ShellPattern { wgname };
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (pattern.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -327,8 +328,9 @@ void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
     bool assigned = false;
+    const auto pattern = ShellPattern { wgname };
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (pattern.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -346,9 +348,10 @@ void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
     auto assigned = false;
+    const auto pattern = ShellPattern { wgname };
 
     for (auto& udq : this->values) {
-        if ((udq.number() == number) && shmatch(wgname, udq.wgname())) {
+        if ((udq.number() == number) && pattern.match(udq.wgname())) {
             udq.assign(value);
             assigned = true;
         }
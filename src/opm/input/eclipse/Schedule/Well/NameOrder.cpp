@@ -19,9 +19,13 @@
 
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
 
+#include <opm/common/utility/shmatch.hpp>
+
 #include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -36,9 +40,28 @@ void NameOrder::add(const std::string& name)
         std::size_t insert_index = this->m_name_list.size();
         this->m_index_map.emplace( name, insert_index );
         this->m_name_list.push_back( name );
+
+        auto sorted_pos = std::upper_bound(this->m_sorted_index.begin(),
+                                           this->m_sorted_index.end(), name,
+            [this](const std::string& n, std::size_t index)
+        {
+            return n < this->m_name_list[index];
+        });
+        this->m_sorted_index.insert(sorted_pos, insert_index);
     }
 }
 
+void NameOrder::rebuildSortedIndex()
+{
+    this->m_sorted_index.resize(this->m_name_list.size());
+    std::iota(this->m_sorted_index.begin(), this->m_sorted_index.end(), std::size_t{0});
+    std::sort(this->m_sorted_index.begin(), this->m_sorted_index.end(),
+        [this](std::size_t i1, std::size_t i2)
+    {
+        return this->m_name_list[i1] < this->m_name_list[i2];
+    });
+}
+
 NameOrder::NameOrder(const std::vector<std::string>& names)
 {
     for (const auto& w : names)
@@ -61,6 +84,47 @@ const std::vector<std::string>& NameOrder::names() const
     return this->m_name_list;
 }
 
+std::vector<std::string> NameOrder::match(const ShellPattern& pattern) const
+{
+    if (!pattern.hasWildcard()) {
+        if (this->has(pattern.pattern()))
+            return { pattern.pattern() };
+
+        return {};
+    }
+
+    // All names starting with the pattern's literal prefix form a
+    // contiguous range of the sorted index.
+    const auto& prefix = pattern.prefix();
+    auto first = std::lower_bound(this->m_sorted_index.begin(),
+                                  this->m_sorted_index.end(), prefix,
+        [this](std::size_t index, const std::string& p)
+    {
+        return this->m_name_list[index] < p;
+    });
+
+    auto last = std::partition_point(first, this->m_sorted_index.end(),
+        [this, &prefix](std::size_t index)
+    {
+        return this->m_name_list[index].compare(0, prefix.size(), prefix) == 0;
+    });
+
+    std::vector<std::size_t> matches;
+    std::copy_if(first, last, std::back_inserter(matches),
+        [this, &pattern](std::size_t index)
+    {
+        return pattern.match(this->m_name_list[index]);
+    });
+    std::sort(matches.begin(), matches.end());
+
+    std::vector<std::string> names;
+    names.reserve(matches.size());
+    for (const auto& index : matches)
+        names.push_back(this->m_name_list[index]);
+
+    return names;
+}
+
 std::vector<std::string>
 NameOrder::sort(std::vector<std::string> names) const
 {
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <string_view>
 #include <unordered_set>
 #include <algorithm>
 
@@ -180,10 +181,10 @@ namespace Opm {
             return { wlist.wells() };
         } else {
             std::vector<std::string> well_set;
-            auto pattern = wlist_pattern.substr(1);
+            const auto pattern = ShellPattern { wlist_pattern.substr(1) };
             for (const auto& [name, wlist] : this->wlists) {
-                auto wlist_name = name.substr(1);
-                if (shmatch(pattern, wlist_name)) {
+                auto wlist_name = std::string_view { name }.substr(1);
+                if (pattern.match(wlist_name)) {
                     const auto& well_names = wlist.wells();
                     for ( auto it = well_names.begin(); it != well_names.end(); it++ ) {
                        if (std::count(well_set.begin(), well_set.end(), *it) == 0)
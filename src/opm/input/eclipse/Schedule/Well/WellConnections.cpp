@@ -217,7 +217,9 @@ namespace Opm {
         , headI        (headIArg)
         , headJ        (headJArg)
         , m_connections(connections)
-    {}
+    {
+        this->rebuildIndex();
+    }
 
     WellConnections WellConnections::serializationTestObject()
     {
@@ -226,6 +228,7 @@ namespace Opm {
         result.headI = 1;
         result.headJ = 2;
         result.m_connections = {Connection::serializationTestObject()};
+        result.rebuildIndex();
 
         return result;
     }
@@ -401,10 +404,6 @@ namespace Opm {
             if (defaultSatTable)
                 satTableId = props->satnum;
 
-            auto same_ijk = [&]( const Connection& c ) {
-                return c.sameCoordinate( I,J,k );
-            };
-
             if (r0Item.hasValue(0))
                 r0 = r0Item.getSIDouble(0);
 
@@ -461,9 +460,7 @@ namespace Opm {
             double re = std::sqrt(D[0] * D[1] / angle * 2); // area equivalent radius of the grid block
             double connection_length = D[2];            // the length of the well perforation
 
-            auto prev = std::find_if( this->m_connections.begin(),
-                                      this->m_connections.end(),
-                                      same_ijk );
+            auto prev = this->m_connections.begin() + this->findIJK(I, J, k);
             if (prev == this->m_connections.end()) {
                 std::size_t noConn = this->m_connections.size();
                 this->addConnection(I,J,k,
@@ -513,16 +510,48 @@ namespace Opm {
         }
     }
     
+    std::vector<external::WellPathCellIntersectionInfo>
+    WellConnections::trajectoryIntersections(const DeckRecord& record,
+                                             const ScheduleGrid& grid) const {
+        const auto& perf_top = record.getItem("PERF_TOP");
+        const auto& perf_bot = record.getItem("PERF_BOT");
+
+        // Calulate the x,y,z coordinates of the begin and end of a perforation
+        external::cvf::Vec3d p_top;
+        external::cvf::Vec3d p_bot;
+        for (size_t i = 0; i < 3 ; ++i) {
+             p_top[i] =  Opm::linearInterpolation(this->md, this->coord[i], perf_top.getSIDouble(0));
+             p_bot[i] =  Opm::linearInterpolation(this->md, this->coord[i], perf_bot.getSIDouble(0));
+        }
+
+        std::vector<external::cvf::Vec3d> points{p_top, p_bot};
+        std::vector<double> md_interval{perf_top.getSIDouble(0), perf_bot.getSIDouble(0)};
+
+        external::cvf::ref<external::RigWellPath> wellPathGeometry = new external::RigWellPath;
+        wellPathGeometry->setWellPathPoints(points);
+        wellPathGeometry->setMeasuredDepths(md_interval);
+        external::cvf::ref<external::RigEclipseWellLogExtractor> e =
+            new external::RigEclipseWellLogExtractor(wellPathGeometry.p(), *grid.get_grid(), grid.cellSearchTree());
+
+        // This gives the intersected grid cells IJK, cell face entrance & exit cell face point and connection length
+        return e->cellIntersectionInfosAlongWellPath();
+    }
+
+    void WellConnections::loadCOMPTRAJ(const DeckRecord& record,
+                                      const ScheduleGrid& grid,
+                                      const std::string& wname,
+                                      const KeywordLocation& location) {
+        this->loadCOMPTRAJ(record, grid, wname, location,
+                           this->trajectoryIntersections(record, grid));
+    }
+
     void WellConnections::loadCOMPTRAJ(const DeckRecord& record,
                                       const ScheduleGrid& grid,
                                       const std::string& wname,
                                       const KeywordLocation& location,
-                                      external::cvf::ref<external::cvf::BoundingBoxTree>& cellSearchTree) {
+                                      const std::vector<external::WellPathCellIntersectionInfo>& intersections) {
 
         // const std::string& completionNamePattern = record.getItem("BRANCH_NUMBER").getTrimmedString(0);
-        const auto& perf_top = record.getItem("PERF_TOP");
-        const auto& perf_bot = record.getItem("PERF_BOT");
-
         const auto& CFItem = record.getItem("CONNECTION_TRANSMISSIBILITY_FACTOR");
         const auto& diameterItem = record.getItem("DIAMETER");
         const auto& KhItem = record.getItem("Kh");
@@ -550,28 +579,6 @@ namespace Opm {
         // Get the grid 
         auto ecl_grid = grid.get_grid();
 
-        // Calulate the x,y,z coordinates of the begin and end of a perforation
-        external::cvf::Vec3d p_top;
-        external::cvf::Vec3d p_bot;
-        for (size_t i = 0; i < 3 ; ++i) {
-             p_top[i] =  Opm::linearInterpolation(this->md, this->coord[i], perf_top.getSIDouble(0));
-             p_bot[i] =  Opm::linearInterpolation(this->md, this->coord[i], perf_bot.getSIDouble(0));
-        }
-
-        std::vector<external::cvf::Vec3d> points{p_top, p_bot};
-        std::vector<double> md_interval{perf_top.getSIDouble(0), perf_bot.getSIDouble(0)};
-        
-        external::cvf::ref<external::RigWellPath> wellPathGeometry = new external::RigWellPath;
-        wellPathGeometry->setWellPathPoints(points);
-        wellPathGeometry->setMeasuredDepths(md_interval);
-        external::cvf::ref<external::RigEclipseWellLogExtractor> e = new external::RigEclipseWellLogExtractor(wellPathGeometry.p(), *ecl_grid, cellSearchTree);
-        
-        // Keep the AABB search tree of the grid  to avoid redoing an expensive calulation 
-        cellSearchTree = e->getCellSearchTree();
-
-        // This gives the intersected grid cells IJK, cell face entrance & exit cell face point and connection length 
-        auto intersections = e->cellIntersectionInfosAlongWellPath();
-
         int I{0};
         int J{0};
         int k{0};
@@ -612,10 +619,6 @@ namespace Opm {
             if (defaultSatTable)
                 satTableId = props->satnum;
 
-            auto same_ijk = [I, J, k]( const Connection& c ) {
-                return c.sameCoordinate( I,J,k );
-            };
-
             if (KhItem.hasValue(0) && KhItem.getSIDouble(0) > 0.0)
                 Kh = KhItem.getSIDouble(0);
 
@@ -669,9 +672,7 @@ namespace Opm {
             double re = -1;
             double connection_length = connection_vector.length(); 
 
-            auto prev = std::find_if( this->m_connections.begin(),
-                                      this->m_connections.end(),
-                                      same_ijk );
+            auto prev = this->m_connections.begin() + this->findIJK(I, J, k);
             if (prev == this->m_connections.end()) {
                 std::size_t noConn = this->m_connections.size();
                 this->addConnection(I,J,k,
@@ -771,41 +772,64 @@ namespace Opm {
     }
 
     bool WellConnections::hasGlobalIndex(std::size_t global_index) const {
-        auto conn_iter = std::find_if(this->begin(), this->end(),
-                                      [global_index] (const Connection& conn) {return conn.global_index() == global_index;});
-        return (conn_iter != this->end());
+        return this->global_index_pos.count(global_index) > 0;
     }
 
     const Connection& WellConnections::getFromIJK(const int i, const int j, const int k) const {
-        for (size_t ic = 0; ic < size(); ++ic) {
-            if (get(ic).sameCoordinate(i, j, k)) {
-                return get(ic);
-            }
-        }
-        throw std::runtime_error(" the connection is not found! \n ");
+        const auto pos = this->findIJK(i, j, k);
+        if (pos == this->m_connections.size())
+            throw std::runtime_error(" the connection is not found! \n ");
+
+        return this->m_connections[pos];
     }
 
     const Connection& WellConnections::getFromGlobalIndex(std::size_t global_index) const {
-        auto conn_iter = std::find_if(this->begin(), this->end(),
-                                      [global_index] (const Connection& conn) {return conn.global_index() == global_index;});
+        auto pos = this->global_index_pos.find(global_index);
 
-        if (conn_iter == this->end())
+        if (pos == this->global_index_pos.end())
             throw std::logic_error(fmt::format("No connection with global index {}", global_index));
-        return *conn_iter;
+        return this->m_connections[pos->second];
     }
 
     Connection& WellConnections::getFromIJK(const int i, const int j, const int k) {
-      for (size_t ic = 0; ic < size(); ++ic) {
-        if (get(ic).sameCoordinate(i, j, k)) {
-          return this->m_connections[ic];
-        }
-      }
-      throw std::runtime_error(" the connection is not found! \n ");
+        const auto pos = this->findIJK(i, j, k);
+        if (pos == this->m_connections.size())
+            throw std::runtime_error(" the connection is not found! \n ");
+
+        return this->m_connections[pos];
     }
 
     void WellConnections::add(Connection connection)
     {
         this->m_connections.push_back(std::move(connection));
+        this->indexConnection(this->m_connections.size() - 1);
+    }
+
+    void WellConnections::indexConnection(const std::size_t pos)
+    {
+        const auto& conn = this->m_connections[pos];
+
+        // emplace() keeps an existing entry, so lookups return the first
+        // matching connection as the former linear searches did.
+        this->global_index_pos.emplace(conn.global_index(), pos);
+        this->ijk_pos.emplace(std::array<int, 3>{ conn.getI(), conn.getJ(), conn.getK() }, pos);
+    }
+
+    void WellConnections::rebuildIndex()
+    {
+        this->global_index_pos.clear();
+        this->ijk_pos.clear();
+
+        for (std::size_t pos = 0; pos < this->m_connections.size(); ++pos)
+            this->indexConnection(pos);
+    }
+
+    std::size_t WellConnections::findIJK(const int i, const int j, const int k) const
+    {
+        auto pos = this->ijk_pos.find({ i, j, k });
+        return (pos == this->ijk_pos.end())
+            ? this->m_connections.size()
+            : pos->second;
     }
 
     bool WellConnections::allConnectionsShut( ) const {
@@ -833,6 +857,8 @@ namespace Opm {
             this->orderTRACK();
         else if (this->m_ordering == Connection::Order::DEPTH)
             this->orderDEPTH();
+
+        this->rebuildIndex();
     }
 
     void WellConnections::orderMSW() {
@@ -920,6 +946,7 @@ namespace Opm {
 
         auto new_end = std::remove_if(m_connections.begin(), m_connections.end(), isInactive);
         m_connections.erase(new_end, m_connections.end());
+        this->rebuildIndex();
     }
 
     double WellConnections::segment_perf_length(int segment) const {
@@ -949,16 +976,10 @@ namespace Opm {
     getCompletionNumberFromGlobalConnectionIndex(const WellConnections& connections,
                                                  const std::size_t      global_index)
     {
-        auto connPos = std::find_if(connections.begin(), connections.end(),
-            [global_index](const Connection& conn)
-        {
-            return conn.global_index() == global_index;
-        });
-
-        if (connPos == connections.end())
+        if (! connections.hasGlobalIndex(global_index))
             // No connection exists with the requisite 'global_index'
             return {};
 
-        return { connPos->complnum() };
+        return { connections.getFromGlobalIndex(global_index).complnum() };
     }
 }
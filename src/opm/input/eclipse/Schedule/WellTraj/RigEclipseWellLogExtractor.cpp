@@ -43,7 +43,7 @@ namespace external {
 
  RigEclipseWellLogExtractor::RigEclipseWellLogExtractor( const RigWellPath* wellpath, 
                                                          const Opm::EclipseGrid& grid, 
-                                                         cvf::ref<cvf::BoundingBoxTree>& cellSearchTree )
+                                                         const cvf::BoundingBoxTree& cellSearchTree )
     : RigWellLogExtractor( wellpath, "" )
       ,m_grid(grid)
       ,m_cellSearchTree(cellSearchTree)
@@ -59,8 +59,6 @@ void RigEclipseWellLogExtractor::calculateIntersection()
 
     if ( m_wellPathGeometry->wellPathPoints().empty() ) return;
 
-    buildCellSearchTree();
-
     for ( size_t wpp = 0; wpp < m_wellPathGeometry->wellPathPoints().size() - 1; ++wpp )
     {
         std::vector<HexIntersectionInfo> intersections;
@@ -197,69 +195,52 @@ void RigEclipseWellLogExtractor::hexCornersOpmToResinsight( cvf::Vec3d hexCorner
 }
 
 // Modified version of ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
-void RigEclipseWellLogExtractor::buildCellSearchTree()
+cvf::ref<cvf::BoundingBoxTree> RigEclipseWellLogExtractor::buildCellSearchTree(const Opm::EclipseGrid& grid)
 {
-    if (m_cellSearchTree.isNull()) {
-
-        auto nx = m_grid.getNX();
-        auto ny = m_grid.getNY();
-        auto nz = m_grid.getNZ();
-
-        size_t cellCount = nx * ny * nz;
-        std::vector<size_t>           cellIndicesForBoundingBoxes;
-        std::vector<cvf::BoundingBox> cellBoundingBoxes;
-
-// #pragma omp parallel
-//         {
-            size_t threadCellCount = cellCount;
-
-            std::vector<size_t>           threadIndicesForBoundingBoxes;
-            std::vector<cvf::BoundingBox> threadBoundingBoxes;
-
-            threadIndicesForBoundingBoxes.reserve( threadCellCount );
-            threadBoundingBoxes.reserve( threadCellCount );
-
-            std::array<double, 3> cornerPointArray;
-            cvf::Vec3d cornerPoint;
-
-// #pragma omp for
-            for (int cIdx = 0; cIdx < (int)cellCount; ++cIdx) {
-                const auto[i,j,k] = m_grid.getIJK(cIdx);
-                cvf::BoundingBox cellBB;
-                for (std::size_t l = 0; l < 8; l++) {
-                     cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-                     cornerPoint = cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-                     cellBB.add(cornerPoint);
-                }
-
-                if (cellBB.isValid()) {
-                    threadIndicesForBoundingBoxes.emplace_back(cIdx);
-                    threadBoundingBoxes.emplace_back(cellBB);
-                }
-            }
-
-            threadIndicesForBoundingBoxes.shrink_to_fit();
-            threadBoundingBoxes.shrink_to_fit();
-// #pragma omp critical
-//          {
-             cellIndicesForBoundingBoxes.insert( cellIndicesForBoundingBoxes.end(),
-                                                 threadIndicesForBoundingBoxes.begin(),
-                                                 threadIndicesForBoundingBoxes.end() );
-
-             cellBoundingBoxes.insert( cellBoundingBoxes.end(), threadBoundingBoxes.begin(), threadBoundingBoxes.end() );
-        //  }
-    // } #pragma omp parallel
-         m_cellSearchTree = new cvf::BoundingBoxTree;
-         m_cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
+    // Only active cells can be connected, so inactive cells are left out
+    // of the tree altogether.
+    const auto activeCount = static_cast<int>(grid.getNumActive());
+
+    std::vector<size_t>           cellIndicesForBoundingBoxes(activeCount);
+    std::vector<cvf::BoundingBox> cellBoundingBoxes(activeCount);
+
+#pragma omp parallel for schedule(static)
+    for (int activeIdx = 0; activeIdx < activeCount; ++activeIdx) {
+        const auto cIdx = grid.getGlobalIndex(activeIdx);
+        const auto[i,j,k] = grid.getIJK(cIdx);
+
+        cvf::BoundingBox cellBB;
+        for (std::size_t l = 0; l < 8; l++) {
+             const auto cornerPointArray = grid.getCornerPos(i,j,k,l);
+             cellBB.add(cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]));
+        }
+
+        cellIndicesForBoundingBoxes[activeIdx] = cIdx;
+        cellBoundingBoxes[activeIdx] = cellBB;
+    }
+
+    // Drop degenerate cells, keeping the active cell order.
+    std::size_t validCount = 0;
+    for (std::size_t n = 0; n < cellBoundingBoxes.size(); ++n) {
+        if (! cellBoundingBoxes[n].isValid())
+            continue;
+
+        cellIndicesForBoundingBoxes[validCount] = cellIndicesForBoundingBoxes[n];
+        cellBoundingBoxes[validCount] = cellBoundingBoxes[n];
+        ++validCount;
     }
+    cellIndicesForBoundingBoxes.resize(validCount);
+    cellBoundingBoxes.resize(validCount);
+
+    cvf::ref<cvf::BoundingBoxTree> cellSearchTree = new cvf::BoundingBoxTree;
+    cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
+    return cellSearchTree;
 }
 
 // From ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
 void RigEclipseWellLogExtractor::findIntersectingCells( const cvf::BoundingBox& inputBB, std::vector<size_t>* cellIndices ) const
 {
-    CVF_ASSERT( m_cellSearchTree.notNull() );
-
-    m_cellSearchTree->findIntersections( inputBB, cellIndices );
+    m_cellSearchTree.findIntersections( inputBB, cellIndices );
 }
 
 // Modified version of ApplicationLibCode\ReservoirDataModel\RigEclipseWellLogExtractor.cpp 
@@ -270,8 +251,4 @@ std::vector<size_t> RigEclipseWellLogExtractor::findCloseCellIndices( const cvf:
     return closeCells;
 }
 
- cvf::ref<cvf::BoundingBoxTree> RigEclipseWellLogExtractor::getCellSearchTree()
- {
-    return m_cellSearchTree;
- }
  } //namespace external
\ No newline at end of file
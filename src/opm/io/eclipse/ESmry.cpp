@@ -731,92 +731,144 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
             keywIndVect.push_back(it->second);
     }
 
-    for (auto ind : keywIndVect)
-        vectorData[ind].reserve(nTstep);
+    std::sort(keywIndVect.begin(), keywIndVect.end());
+    keywIndVect.erase(std::unique(keywIndVect.begin(), keywIndVect.end()), keywIndVect.end());
 
-    std::fstream fileH;
+    // Undefined vectors in a summary file, typically when loading base
+    // restart run and including base run data, are left as NaN.  Vectors
+    // can be added to restart runs.
+    for (auto ind : keywIndVect)
+        vectorData[ind].assign(nTstep, std::nanf(""));
 
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
-    std::uint64_t blockSize_f;
+    // Columns to extract from the PARAMS array of each summary file, as
+    // pairs of (position in PARAMS, vector index) sorted on position.
+    std::vector<std::vector<std::pair<int, int>>> columns(nSpecFiles);
 
-    {
-        const int rest = MaxBlockSizeReal % numColumnsReal;
-        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal + (rest > 0);
+    for (int specInd = 0; specInd < nSpecFiles; specInd++) {
+        for (auto ind : keywIndVect) {
+            auto it = arrayPos[specInd].find(ind);
+            if (it != arrayPos[specInd].end())
+                columns[specInd].emplace_back(it->second, ind);
+        }
 
-        blockSize_f= static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
+        std::sort(columns[specInd].begin(), columns[specInd].end());
     }
 
-    if (formattedFiles[specInd])
-        fileH.open(dataFileList[dataFileIndex], std::ios::in);
-    else
-        fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+    // Runs of consecutive ministeps stored in the same data file.  These
+    // are independent of each other, so restart chains and non-unified
+    // result files are loaded in parallel.
+    std::vector<std::pair<std::size_t, std::size_t>> segments;
 
-    for (const auto& ministep : timeStepList) {
-        if (dataFileIndex != std::get<1>(ministep)) {
-            fileH.close();
-            specInd = std::get<0>(ministep);
-            dataFileIndex = std::get<1>(ministep);
+    for (std::size_t step = 0; step < timeStepList.size(); step++) {
+        if ((step == 0) || (std::get<1>(timeStepList[step]) != std::get<1>(timeStepList[step - 1])))
+            segments.emplace_back(step, step + 1);
+        else
+            segments.back().second = step + 1;
+    }
 
-            if (formattedFiles[specInd])
-                fileH.open(dataFileList[dataFileIndex], std::ios::in );
-            else
-                fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+    std::vector<std::exception_ptr> failures(segments.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (int n = 0; n < static_cast<int>(segments.size()); n++) {
+        try {
+            const auto specInd = std::get<0>(timeStepList[segments[n].first]);
+            this->loadDataSegment(segments[n].first, segments[n].second, columns[specInd]);
+        }
+        catch (...) {
+            failures[n] = std::current_exception();
         }
+    }
 
-        const auto stepFilePos = std::get<2>(ministep);;
+    for (const auto& failure : failures)
+        if (failure)
+            std::rethrow_exception(failure);
 
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
-            if (it == arrayPos[specInd].end()) {
-                // undefined vector in current summary file. Typically when loading
-                // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
-            }
-            else {
-                int paramPos = it->second;
+    for (const auto& ind : keywIndVect)
+        vectorLoaded[ind] = true;
 
-                if (formattedFiles[specInd]) {
-                    std::uint64_t elementPos = 0;
-                    int nBlocks = paramPos / MaxBlockSizeReal;
-                    int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+}
 
-                    if (nBlocks > 0)
-                        elementPos = static_cast<uint64_t>(nBlocks * blockSize_f);
+void ESmry::loadDataSegment(const std::size_t begin, const std::size_t end,
+                            const std::vector<std::pair<int, int>>& columns) const
+{
+    if (columns.empty())
+        return;
 
-                    int nLines = sizeOfLastBlock / numColumnsReal;
-                    elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
+    const auto specInd = std::get<0>(timeStepList[begin]);
+    const auto dataFileIndex = std::get<1>(timeStepList[begin]);
+    const bool formatted = formattedFiles[specInd];
 
-                    fileH.seekg (elementPos, fileH.beg);
+    // Byte offset of each requested element relative to the start of the
+    // PARAMS data, i.e., the leading record marker (binary) or the first
+    // data item (formatted).
+    std::vector<std::uint64_t> offset;
+    offset.reserve(columns.size());
 
-                    const std::size_t size = columnWidthReal;
-                    std::vector<char> buffer(size);
-                    fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
-                }
-                else {
-                    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
-                    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
-                    elementPos += static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
+    if (formatted) {
+        const int rest = MaxBlockSizeReal % numColumnsReal;
+        const int nLinesBlock = MaxBlockSizeReal / numColumnsReal + (rest > 0);
+        const auto blockSize_f = static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
 
-                    fileH.seekg (elementPos, fileH.beg);
+        for (const auto& [paramPos, ind] : columns) {
+            const std::uint64_t nBlocks = paramPos / MaxBlockSizeReal;
+            const int sizeOfLastBlock = paramPos % MaxBlockSizeReal;
+            const int nLines = sizeOfLastBlock / numColumnsReal;
 
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+            offset.push_back(nBlocks * blockSize_f +
+                             static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines));
+        }
+    }
+    else {
+        for (const auto& [paramPos, ind] : columns) {
+            const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
 
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
-                }
-            }
+            offset.push_back(((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte) +
+                             static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal));
         }
     }
 
-    fileH.close();
+    // Read the span of each PARAMS array covering all requested elements
+    // in a single call, then scatter the individual elements.
+    const std::uint64_t spanBegin = offset.front();
+    const std::uint64_t spanSize = offset.back() - spanBegin + (formatted ? columnWidthReal : sizeOfReal);
 
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
+    std::fstream fileH;
 
-    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
-    m_io_loading += elapsed_seconds.count();
+    if (formatted)
+        fileH.open(dataFileList[dataFileIndex], std::ios::in);
+    else
+        fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        throw std::runtime_error("Could not open summary data file: '" + dataFileList[dataFileIndex] + "'");
+
+    // Trailing null character terminates the last formatted element.
+    std::vector<char> buffer(spanSize + 1, '\0');
+
+    for (std::size_t step = begin; step < end; step++) {
+        const auto stepFilePos = std::get<2>(timeStepList[step]);
+
+        fileH.seekg(stepFilePos + spanBegin, fileH.beg);
+        fileH.read(buffer.data(), spanSize);
+
+        if (!fileH)
+            throw std::runtime_error("Error reading summary data from file: '" + dataFileList[dataFileIndex] + "'");
+
+        for (std::size_t i = 0; i < columns.size(); i++) {
+            const char* src = buffer.data() + (offset[i] - spanBegin);
+            auto& vect = vectorData[columns[i].second];
+
+            if (formatted) {
+                vect[step] = std::strtof(src, nullptr);
+            } else {
+                float value;
+                std::memcpy(&value, src, sizeOfReal);
+                vect[step] = Opm::EclIO::flipEndianFloat(value);
+            }
+        }
+    }
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
@@ -1047,7 +1099,7 @@ ESmry::getListOfArrays(std::string filename, bool formatted)
     return resultVect;
 }
 
-bool ESmry::make_esmry_file()
+bool ESmry::make_esmry_file(ExtSmryLayout layout)
 {
     // check that loadBaseRunData is not set, this function only works for single smspec files
     // function will not replace existing lodsmry files (since this is already loaded by this class)
@@ -1110,12 +1162,30 @@ bool ESmry::make_esmry_file()
 
             outFile.write("KEYCHECK", keyword);
             outFile.write("UNITS", units);
-            outFile.write<int>("RSTEP", is_rstep);
-            outFile.write<int>("TSTEP", mini_steps);
 
-            for (size_t n = 0; n < vectorData.size(); n++ ) {
-                const std::string vect_name = fmt::format("V{}", n);
-                outFile.write<float>(vect_name, vectorData[n]);
+            if (layout == ExtSmryLayout::Transposed) {
+                outFile.write<int>("RSTEP", is_rstep);
+                outFile.write<int>("TSTEP", mini_steps);
+
+                for (size_t n = 0; n < vectorData.size(); n++ ) {
+                    const std::string vect_name = fmt::format("V{}", n);
+                    outFile.write<float>(vect_name, vectorData[n]);
+                }
+            } else {
+                const auto compression = (layout == ExtSmryLayout::ChunkedCompressed)
+                    ? ExtSmryBlocks::Compression::DeltaShuffle
+                    : ExtSmryBlocks::Compression::None;
+
+                ExtSmryBlocks::writeSpec(outFile, static_cast<int>(vectorData.size()), compression);
+
+                for (size_t first = 0; first < is_rstep.size(); first += ExtSmryBlocks::maxBlockSize) {
+                    const auto last = std::min(first + ExtSmryBlocks::maxBlockSize, is_rstep.size());
+
+                    const std::vector<int> rstep(is_rstep.begin() + first, is_rstep.begin() + last);
+                    const std::vector<int> tstep(mini_steps.begin() + first, mini_steps.begin() + last);
+
+                    ExtSmryBlocks::writeBlock(outFile, rstep, tstep, vectorData, first, compression);
+                }
             }
         }
 
@@ -1395,9 +1465,10 @@ const std::vector<std::string>& ESmry::keywordList() const
 std::vector<std::string> ESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
+    const auto shell_pattern = ShellPattern { pattern };
 
-    for (auto key : keyword)
-        if (shmatch(pattern, key))
+    for (const auto& key : keyword)
+        if (shell_pattern.match(key))
             list.push_back(key);
 
     return list;
@@ -31,10 +31,108 @@
 #include <string>
 #include <numeric>
 #include <cmath>
+#include <type_traits>
+
+namespace {
+
+    void readMappedHeader(const Opm::EclIO::MappedFile& file, std::uint64_t& pos,
+                          std::string& name, int& size, std::string& type)
+    {
+        using Opm::EclIO::detail::loadBigEndian32;
+
+        if (file.size() - pos < 24) {
+            OPM_THROW(std::runtime_error, "Error reading binary header. File "
+                      + file.filename() + " is truncated");
+        }
+
+        const char* header = file.data() + pos;
+
+        for (const auto marker : { loadBigEndian32(header), loadBigEndian32(header + 20) }) {
+            if (marker != 16) {
+                std::string message="Error reading binary header. Expected 16 bytes of header data, found " + std::to_string(marker);
+                OPM_THROW(std::runtime_error, message);
+            }
+        }
+
+        name.assign(header + 4, 8);
+        size = static_cast<int>(loadBigEndian32(header + 12));
+        type.assign(header + 16, 4);
+
+        pos += 24;
+    }
+
+} // Anonymous namespace
 
 namespace Opm { namespace EclIO {
 
+void EclFile::indexMappedFile()
+{
+    const auto& file = *this->mappedFile;
+    const std::uint64_t fileSize = file.size();
+
+    std::uint64_t pos = 0;
+    std::string arrName(8,' ');
+    std::string typeStr(4,' ');
+    int n = 0;
+
+    while (fileSize - pos >= sizeof(int)) {
+        int tmpSize;
+        readMappedHeader(file, pos, arrName, tmpSize, typeStr);
+
+        std::int64_t num = tmpSize;
+
+        if (typeStr == "X231") {
+            const std::string x231ArrayName = arrName;
+            const std::int64_t x231exp = -static_cast<std::int64_t>(tmpSize);
+
+            readMappedHeader(file, pos, arrName, tmpSize, typeStr);
+
+            if (x231ArrayName != arrName)
+                OPM_THROW(std::runtime_error, "Invalid X231 header, name should be same in both headers'");
+
+            if (x231exp < 0)
+                OPM_THROW(std::runtime_error, "Invalid X231 header, size of array should be negative'");
+
+            num = static_cast<std::int64_t>(tmpSize) + x231exp * (std::int64_t{1} << 31);
+        }
+
+        const auto [arrType, sizeOfElement] = binaryArrayType(typeStr);
+
+        array_size.push_back(num);
+        array_type.push_back(arrType);
+        array_name.push_back(trimr(arrName));
+        array_element_size.push_back(sizeOfElement);
+
+        array_index[array_name[n]] = n;
+
+        ifStreamPos.push_back(pos);
+        arrayLoaded.push_back(false);
+
+        if ((num > 0) && (arrType != MESS)) {
+            pos += sizeOnDiskBinary(num, arrType, sizeOfElement);
+
+            if (pos > fileSize) {
+                OPM_THROW(std::runtime_error, "Array '" + array_name[n] + "' extends beyond end of file "
+                          + this->inputFilename);
+            }
+        }
+
+        n++;
+    }
+
+    this->ifStreamPos.push_back(fileSize);
+}
+
 void EclFile::load(bool preload) {
+    if (this->mappedFile) {
+        this->indexMappedFile();
+
+        if (preload)
+            this->loadData();
+
+        return;
+    }
+
     std::fstream fileH;
 
     if (formatted) {
@@ -112,6 +210,21 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 }
 
 
+EclFile::EclFile(const std::string& filename, EclFile::MemoryMapped mmap, bool preload) :
+    inputFilename(filename)
+{
+    if (!fileExists(filename))
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    formatted = isFormatted(filename);
+
+    if (mmap.value && !formatted)
+        this->mappedFile = std::make_shared<const MappedFile>(filename);
+
+    this->load(preload);
+}
+
+
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
@@ -145,6 +258,35 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
     arrayLoaded[arrIndex] = true;
 }
 
+void EclFile::loadMappedArray(std::size_t arrIndex)
+{
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex] = makeView<int>(arrIndex).toVector();
+        break;
+    case REAL:
+        real_array[arrIndex] = makeView<float>(arrIndex).toVector();
+        break;
+    case DOUB:
+        doub_array[arrIndex] = makeView<double>(arrIndex).toVector();
+        break;
+    case LOGI:
+        logi_array[arrIndex] = makeView<bool>(arrIndex).toVector();
+        break;
+    case CHAR:
+    case C0NN:
+        char_array[arrIndex] = makeView<std::string>(arrIndex).toVector();
+        break;
+    case MESS:
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
+        break;
+    }
+
+    arrayLoaded[arrIndex] = true;
+}
+
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
 {
 
@@ -188,6 +330,12 @@ void EclFile::loadData()
 
         this->loadData(arrIndices);
 
+    } else if (this->mappedFile) {
+
+        for (size_t i = 0; i < array_name.size(); i++) {
+            loadMappedArray(i);
+        }
+
     } else {
 
         std::fstream fileH;
@@ -230,6 +378,14 @@ void EclFile::loadData(const std::string& name)
             }
         }
 
+    } else if (this->mappedFile) {
+
+        for (size_t i = 0; i < array_name.size(); i++) {
+            if (array_name[i] == name) {
+                loadMappedArray(i);
+            }
+        }
+
     } else {
 
         std::fstream fileH;
@@ -271,6 +427,12 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
             loadFormattedArray(fileStr, ind, 0);
         }
 
+    } else if (this->mappedFile) {
+
+        for (int ind : arrIndex) {
+            loadMappedArray(ind);
+        }
+
     } else {
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
@@ -306,6 +468,10 @@ void EclFile::loadData(int arrIndex)
             loadFormattedArray(fileStr, arrIndex, 0);
 
 
+    } else if (this->mappedFile) {
+
+        loadMappedArray(arrIndex);
+
     } else {
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
@@ -639,4 +805,238 @@ std::size_t EclFile::size() const {
 }
 
 
+int EclFile::arrayIndexOrThrow(const std::string& name) const
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        std::string message="key '"+name + "' not found";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return search->second;
+}
+
+
+template <typename T>
+EclArrayView<T> EclFile::makeView(int arrIndex) const
+{
+    const auto type = array_type[arrIndex];
+
+    // C0nn records hold the same number of elements as CHAR records,
+    // irrespective of element size.
+    const auto [sizeOfElement, maxBlockSize] = block_size_data_binary(type == C0NN ? CHAR : type);
+
+    return EclArrayView<T>(this->mappedFile, ifStreamPos[arrIndex], array_size[arrIndex],
+                           array_element_size[arrIndex], maxBlockSize / sizeOfElement);
+}
+
+
+template <typename T>
+EclArrayView<T> EclFile::getViewImpl(int arrIndex, eclArrType type, const std::string& typeStr)
+{
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    if (formatted) {
+        OPM_THROW(std::runtime_error, "Memory mapped array views are not supported for formatted file "
+                  + inputFilename);
+    }
+
+    if (!this->mappedFile) {
+        this->mappedFile = std::make_shared<const MappedFile>(inputFilename);
+    }
+
+    const auto endPos = ifStreamPos[arrIndex] +
+        sizeOnDiskBinary(array_size[arrIndex], array_type[arrIndex], array_element_size[arrIndex]);
+
+    if (endPos > this->mappedFile->size()) {
+        OPM_THROW(std::runtime_error, "Array '" + array_name[arrIndex] + "' extends beyond end of file "
+                  + inputFilename);
+    }
+
+    return this->makeView<T>(arrIndex);
+}
+
+
+template <typename T>
+EclArrayView<T> EclFile::getView(int arrIndex)
+{
+    if constexpr (std::is_same_v<T, int>) {
+        return getViewImpl<T>(arrIndex, INTE, "integer");
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+        return getViewImpl<T>(arrIndex, REAL, "float");
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+        return getViewImpl<T>(arrIndex, DOUB, "double");
+    }
+    else if constexpr (std::is_same_v<T, bool>) {
+        return getViewImpl<T>(arrIndex, LOGI, "bool");
+    }
+    else {
+        if ((array_type[arrIndex] != Opm::EclIO::C0NN) && (array_type[arrIndex] != Opm::EclIO::CHAR)){
+            std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + "std::string";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        return getViewImpl<T>(arrIndex, array_type[arrIndex], "string");
+    }
+}
+
+
+template <typename T>
+EclArrayView<T> EclFile::getView(const std::string& name)
+{
+    return this->getView<T>(this->arrayIndexOrThrow(name));
+}
+
+
+template <typename T>
+std::vector<T> EclFile::readBinaryElements(int arrIndex, const std::vector<std::int64_t>& elements) const
+{
+    const auto type = array_type[arrIndex];
+    const auto elementSize = static_cast<std::int64_t>(array_element_size[arrIndex]);
+
+    // C0nn records hold the same number of elements as CHAR records,
+    // irrespective of element size.
+    const auto [sizeOfElement, maxBlockSize] = block_size_data_binary(type == C0NN ? CHAR : type);
+    const auto numPerBlock = static_cast<std::int64_t>(maxBlockSize / sizeOfElement);
+    const auto blockBytes = numPerBlock*elementSize + 2*static_cast<std::int64_t>(sizeof(int));
+
+    // Visit requested elements in file order.
+    auto order = std::vector<std::size_t>(elements.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&elements](const std::size_t i1, const std::size_t i2)
+    {
+        return elements[i1] < elements[i2];
+    });
+
+    std::ifstream fileH(inputFilename, std::ios::in | std::ios::binary);
+    if (!fileH) {
+        OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename + "'");
+    }
+
+    auto result = std::vector<T>(elements.size());
+    auto buffer = std::vector<char>{};
+
+    // One read per record, spanning the requested elements in that record.
+    for (std::size_t i = 0; i < order.size();) {
+        const auto first = elements[order[i]];
+        const auto block = first / numPerBlock;
+
+        auto j = i + 1;
+        while ((j < order.size()) && (elements[order[j]] / numPerBlock == block)) {
+            ++j;
+        }
+
+        const auto last = elements[order[j - 1]];
+        buffer.resize((last - first + 1) * elementSize);
+
+        const auto pos = ifStreamPos[arrIndex] + block*blockBytes + sizeof(int)
+            + (first % numPerBlock)*elementSize;
+
+        fileH.seekg(static_cast<std::streamoff>(pos), std::ios_base::beg);
+        fileH.read(buffer.data(), buffer.size());
+        if (!fileH) {
+            OPM_THROW(std::runtime_error, "Error reading array '" + array_name[arrIndex]
+                      + "' from file " + inputFilename);
+        }
+
+        for (; i < j; ++i) {
+            result[order[i]] = detail::decodeElement<T>
+                (buffer.data() + (elements[order[i]] - first)*elementSize, elementSize);
+        }
+    }
+
+    return result;
+}
+
+
+template <typename T>
+std::vector<T> EclFile::getElements(int arrIndex, const std::vector<std::int64_t>& elements)
+{
+    const auto type = array_type[arrIndex];
+    const auto typeOk = std::is_same_v<T, int>    ? (type == INTE)
+                      : std::is_same_v<T, float>  ? (type == REAL)
+                      : std::is_same_v<T, double> ? (type == DOUB)
+                      : std::is_same_v<T, bool>   ? (type == LOGI)
+                      : (type == CHAR) || (type == C0NN);
+
+    if (!typeOk) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of requested type";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    for (const auto& element : elements) {
+        if ((element < 0) || (element >= array_size[arrIndex])) {
+            throw std::out_of_range {
+                fmt::format("Element {} out of range for array '{}' of size {}",
+                            element, array_name[arrIndex], array_size[arrIndex])
+            };
+        }
+    }
+
+    if (arrayLoaded[arrIndex] || formatted) {
+        const auto& data = this->get<T>(arrIndex);
+
+        auto result = std::vector<T>{};
+        result.reserve(elements.size());
+        for (const auto& element : elements) {
+            result.push_back(data[element]);
+        }
+
+        return result;
+    }
+
+    if (this->mappedFile) {
+        const auto view = this->getView<T>(arrIndex);
+
+        auto result = std::vector<T>{};
+        result.reserve(elements.size());
+        for (const auto& element : elements) {
+            result.push_back(view[element]);
+        }
+
+        return result;
+    }
+
+    return this->readBinaryElements<T>(arrIndex, elements);
+}
+
+
+template <typename T>
+std::vector<T> EclFile::getElements(const std::string& name, const std::vector<std::int64_t>& elements)
+{
+    return this->getElements<T>(this->arrayIndexOrThrow(name), elements);
+}
+
+
+template EclArrayView<int> EclFile::getView<int>(int);
+template EclArrayView<float> EclFile::getView<float>(int);
+template EclArrayView<double> EclFile::getView<double>(int);
+template EclArrayView<bool> EclFile::getView<bool>(int);
+template EclArrayView<std::string> EclFile::getView<std::string>(int);
+
+template EclArrayView<int> EclFile::getView<int>(const std::string&);
+template EclArrayView<float> EclFile::getView<float>(const std::string&);
+template EclArrayView<double> EclFile::getView<double>(const std::string&);
+template EclArrayView<bool> EclFile::getView<bool>(const std::string&);
+template EclArrayView<std::string> EclFile::getView<std::string>(const std::string&);
+
+template std::vector<int> EclFile::getElements<int>(int, const std::vector<std::int64_t>&);
+template std::vector<float> EclFile::getElements<float>(int, const std::vector<std::int64_t>&);
+template std::vector<double> EclFile::getElements<double>(int, const std::vector<std::int64_t>&);
+template std::vector<bool> EclFile::getElements<bool>(int, const std::vector<std::int64_t>&);
+template std::vector<std::string> EclFile::getElements<std::string>(int, const std::vector<std::int64_t>&);
+
+template std::vector<int> EclFile::getElements<int>(const std::string&, const std::vector<std::int64_t>&);
+template std::vector<float> EclFile::getElements<float>(const std::string&, const std::vector<std::int64_t>&);
+template std::vector<double> EclFile::getElements<double>(const std::string&, const std::vector<std::int64_t>&);
+template std::vector<bool> EclFile::getElements<bool>(const std::string&, const std::vector<std::int64_t>&);
+template std::vector<std::string> EclFile::getElements<std::string>(const std::string&, const std::vector<std::int64_t>&);
+
+
 }} // namespace Opm::ecl
@@ -25,6 +25,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
@@ -142,6 +143,95 @@ void EclOutput::write<PaddedOutputString<8>>
     }
 }
 
+void EclOutput::write(const std::string&         name,
+                      const std::vector<double>& data,
+                      const ConvertBlock&        convert,
+                      const bool                 write_double)
+{
+    const auto arrType = write_double ? DOUB : REAL;
+    const auto element_size = write_double ? sizeOfDoub : sizeOfReal;
+    const auto size = data.size();
+
+    // Values per output block.  Formatted blocks end with a line shift.
+    const auto maxNumberOfElements = static_cast<std::size_t>
+        (this->isFormatted
+         ? std::get<0>(block_size_data_formatted(arrType))
+         : std::get<1>(block_size_data_binary(arrType)) / element_size);
+
+    if (this->isFormatted) {
+        writeFormattedHeader(name, size, arrType, element_size);
+    }
+    else {
+        writeBinaryHeader(name, size, arrType, element_size);
+    }
+
+    if (!ofileH.is_open()) {
+        OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
+    }
+
+    auto block = std::vector<double>(std::min(size, maxNumberOfElements));
+    auto bytes = std::vector<char>(this->isFormatted ? 0 : block.size() * element_size);
+
+    const auto nColumns = std::get<1>(block_size_data_formatted(arrType));
+    const auto columnWidth = std::get<2>(block_size_data_formatted(arrType));
+
+    for (std::size_t offset = 0; offset < size; offset += block.size()) {
+        const auto num = std::min(maxNumberOfElements, size - offset);
+
+        block.assign(data.begin() + offset, data.begin() + offset + num);
+        if (convert) {
+            convert(block.data(), block.data() + num);
+        }
+
+        if (this->isFormatted) {
+            // Same layout as writeFormattedArray(); the block ends with a
+            // line shift unless the last line is already complete.
+            for (std::size_t m = 0; m < num; ++m) {
+                if (write_double) {
+                    ofileH << std::setw(columnWidth)
+                           << (ix_standard ? make_doub_string_ix(block[m])
+                                           : make_doub_string_ecl(block[m]));
+                }
+                else {
+                    const auto value = static_cast<float>(block[m]);
+                    ofileH << std::setw(columnWidth)
+                           << (ix_standard ? make_real_string_ix(value)
+                                           : make_real_string_ecl(value));
+                }
+
+                if (((m + 1) % nColumns) == 0) {
+                    ofileH << std::endl;
+                }
+            }
+
+            if ((num % nColumns) != 0) {
+                ofileH << std::endl;
+            }
+
+            continue;
+        }
+
+        char* out = bytes.data();
+        if (write_double) {
+            for (std::size_t m = 0; m < num; ++m, out += sizeof(double)) {
+                const double value = flipEndianDouble(block[m]);
+                std::memcpy(out, &value, sizeof value);
+            }
+        }
+        else {
+            for (std::size_t m = 0; m < num; ++m, out += sizeof(float)) {
+                const float value = flipEndianFloat(static_cast<float>(block[m]));
+                std::memcpy(out, &value, sizeof value);
+            }
+        }
+
+        const int dhead = flipEndianInt(static_cast<int>(num) * element_size);
+        ofileH.write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+        ofileH.write(bytes.data(), num * element_size);
+        ofileH.write(reinterpret_cast<const char*>(&dhead), sizeof(dhead));
+    }
+}
+
 void EclOutput::message(const std::string& msg)
 {
     // Generate message, i.e., output vector of type eclArrType::MESS,
@@ -335,31 +335,31 @@ void Opm::EclIO::readBinaryHeader(std::fstream& fileH, std::string& arrName,
         size = static_cast<std::int64_t>(tmpSize);
     }
 
-    elementSize = 4;
-
     arrName = tmpStrName;
-    if (tmpStrType == "INTE")
-        arrType = Opm::EclIO::INTE;
-    else if (tmpStrType == "REAL")
-        arrType = Opm::EclIO::REAL;
-    else if (tmpStrType == "DOUB"){
-        arrType = Opm::EclIO::DOUB;
-        elementSize = 8;
-    }
-    else if (tmpStrType == "CHAR"){
-        arrType = Opm::EclIO::CHAR;
-        elementSize = 8;
-    }
-    else if (tmpStrType.substr(0,1)=="C"){
-        arrType = Opm::EclIO::C0NN;
-        elementSize = std::stoi(tmpStrType.substr(1,3));
-    }
-    else if (tmpStrType =="LOGI")
-        arrType = Opm::EclIO::LOGI;
-    else if (tmpStrType == "MESS")
-        arrType = Opm::EclIO::MESS;
-    else
-        OPM_THROW(std::runtime_error, "Error, unknown array type '" + tmpStrType +"'");
+    std::tie(arrType, elementSize) = binaryArrayType(tmpStrType);
+}
+
+std::tuple<Opm::EclIO::eclArrType, int>
+Opm::EclIO::binaryArrayType(const std::string& typeStr)
+{
+    using TypeTuple = std::tuple<Opm::EclIO::eclArrType, int>;
+
+    if (typeStr == "INTE")
+        return TypeTuple{Opm::EclIO::INTE, 4};
+    else if (typeStr == "REAL")
+        return TypeTuple{Opm::EclIO::REAL, 4};
+    else if (typeStr == "DOUB")
+        return TypeTuple{Opm::EclIO::DOUB, 8};
+    else if (typeStr == "CHAR")
+        return TypeTuple{Opm::EclIO::CHAR, 8};
+    else if (typeStr.substr(0,1)=="C")
+        return TypeTuple{Opm::EclIO::C0NN, std::stoi(typeStr.substr(1,3))};
+    else if (typeStr =="LOGI")
+        return TypeTuple{Opm::EclIO::LOGI, 4};
+    else if (typeStr == "MESS")
+        return TypeTuple{Opm::EclIO::MESS, 4};
+
+    OPM_THROW(std::runtime_error, "Error, unknown array type '" + typeStr +"'");
 }
 
 
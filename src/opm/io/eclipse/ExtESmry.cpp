@@ -23,6 +23,7 @@
 #include <opm/common/utility/shmatch.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ExtSmryBlocks.hpp>
 
 #include <algorithm>
 #include <numeric>
@@ -62,6 +63,35 @@ Opm::time_point make_date(const std::vector<int>& datetime) {
     return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
 }
 
+// Read the elements [first, first + count) of a binary INTE array whose
+// first record marker is at position dataPos.
+std::vector<int> read_inte_range(std::fstream& fileH, uint64_t dataPos, uint64_t first, uint64_t count)
+{
+    const uint64_t perRecord = Opm::EclIO::MaxBlockSizeInte / Opm::EclIO::sizeOfInte;
+    const uint64_t recordSize = Opm::EclIO::MaxBlockSizeInte + 2 * sizeof(int);
+
+    std::vector<int> values(count);
+    uint64_t done = 0;
+
+    while (done < count) {
+        const auto elm = first + done;
+        const auto num = std::min(count - done, perRecord - elm % perRecord);
+        const auto pos = dataPos + (elm / perRecord) * recordSize + sizeof(int) + (elm % perRecord) * sizeof(int);
+
+        fileH.seekg(static_cast<std::streamoff>(pos), std::ios_base::beg);
+        fileH.read(reinterpret_cast<char*>(values.data() + done), num * sizeof(int));
+
+        if (!fileH)
+            throw std::runtime_error("Error reading time block data from ESMRY file");
+
+        done += num;
+    }
+
+    for (auto& v : values)
+        v = Opm::EclIO::flipEndianInt(v);
+
+    return values;
+}
 
 }
 
@@ -116,13 +146,15 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
     ExtSmryHeadType ext_esmry_head;
 
     uint64_t rstep_offset;
+    bool chunked;
+    std::vector<TimeBlock> blocks;
 
-    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+    bool res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, chunked, blocks);
     int n_attempts = 1;
 
     while ((!res) && (n_attempts < 10)){
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset);
+        res = open_esmry(m_inputFileName, ext_esmry_head, rstep_offset, chunked, blocks);
         n_attempts ++;
     }
 
@@ -131,6 +163,8 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
     m_startdat = std::get<0>(ext_esmry_head);
     m_rstep_offset.push_back(rstep_offset);
+    m_chunked.push_back(chunked);
+    m_blocks.push_back(std::move(blocks));
 
     std::map<std::string, int> key_index;
 
@@ -174,10 +208,12 @@ ExtESmry::ExtESmry(const std::string &filename, bool loadBaseRunData) :
 
             m_esmry_files.push_back(rstESmryFile);
 
-            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset))
+            if (!open_esmry(rstESmryFile, ext_esmry_head, rstep_offset, chunked, blocks))
                 OPM_THROW( std::runtime_error, "when opening ESMRY file" + rstESmryFile.string() );
 
             m_rstep_offset.push_back(rstep_offset);
+            m_chunked.push_back(chunked);
+            m_blocks.push_back(std::move(blocks));
 
             m_rstep_v.push_back(std::get<4>(ext_esmry_head));
             m_tstep_v.push_back(std::get<5>(ext_esmry_head));
@@ -268,7 +304,8 @@ bool ExtESmry::all_steps_available()
     return true;
 }
 
-bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset)
+bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHeadType& ext_smry_head, uint64_t& rstep_offset,
+                          bool& chunked, std::vector<TimeBlock>& blocks)
 {
     std::fstream fileH;
 
@@ -374,6 +411,35 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
         return false;
     }
 
+    chunked = (arrName == "BLKSPEC ");
+    blocks.clear();
+
+    if (chunked) {
+        std::vector<int> blkspec;
+
+        try {
+            blkspec = Opm::EclIO::readBinaryInteArray(fileH, arr_size);
+        } catch (const std::runtime_error& error)
+        {
+            return false;
+        }
+
+        if ((blkspec.size() < 3) || (blkspec[0] > ExtSmryBlocks::layoutVersion))
+            OPM_THROW(std::invalid_argument, "unsupported chunked layout in esmry file " + inputFileName.string() );
+
+        if (blkspec[2] != static_cast<int>(keywords.size()))
+            OPM_THROW(std::invalid_argument, "reading BLKSPEC, invalid esmry file " + inputFileName.string() );
+
+        std::vector<int> rstep;
+        std::vector<int> tstep;
+
+        this->index_blocks(fileH, keywords.size(), rstep, tstep, blocks);
+
+        ext_smry_head = std::make_tuple(startdat, rst_entry, keywords, units, rstep, tstep);
+
+        return true;
+    }
+
     if ((arrName != "RSTEP   ") or (arrType != Opm::EclIO::INTE))
         OPM_THROW(std::invalid_argument, "Reading RSTEP, invalid esmry file " + inputFileName.string() );
 
@@ -413,6 +479,70 @@ bool ExtESmry::open_esmry(const std::filesystem::path& inputFileName, ExtSmryHea
 }
 
 
+void ExtESmry::index_blocks(std::fstream& fileH, size_t nVect, std::vector<int>& rstep,
+                            std::vector<int>& tstep, std::vector<TimeBlock>& blocks)
+{
+    // Index complete time blocks only.  A trailing block may be partially
+    // written if the file belongs to an active run, and is then ignored.
+
+    const auto blockPos = fileH.tellg();
+    fileH.seekg(0, std::ios_base::end);
+    const auto fileSize = static_cast<uint64_t>(fileH.tellg());
+    fileH.seekg(blockPos);
+
+    auto readArray = [&fileH](const std::string& name)
+    {
+        std::string arrName;
+        int64_t arr_size;
+        Opm::EclIO::eclArrType arrType;
+        int sizeOfElement;
+
+        Opm::EclIO::readBinaryHeader(fileH, arrName, arr_size, arrType, sizeOfElement);
+
+        if ((Opm::EclIO::trimr(arrName) != name) || (arrType != Opm::EclIO::INTE))
+            throw std::runtime_error("expected array " + name + " in esmry time block");
+
+        return arr_size;
+    };
+
+    while (static_cast<uint64_t>(fileH.tellg()) + 24 <= fileSize) {
+        try {
+            auto block_rstep = Opm::EclIO::readBinaryInteArray(fileH, readArray("RSTEP"));
+            auto block_tstep = Opm::EclIO::readBinaryInteArray(fileH, readArray("TSTEP"));
+            const auto index = Opm::EclIO::readBinaryInteArray(fileH, readArray("BLKINDEX"));
+            const auto data_size = readArray("BLKDATA");
+
+            if (!fileH)
+                break;
+
+            TimeBlock block;
+            block.dataPos = static_cast<uint64_t>(fileH.tellg());
+            block.numSteps = block_rstep.size();
+            block.start.reserve(nVect + 1);
+            block.start.push_back(0);
+
+            for (const auto& words : index)
+                block.start.push_back(block.start.back() + static_cast<uint64_t>(words));
+
+            const auto data_end = block.dataPos + sizeOnDiskBinary(data_size, Opm::EclIO::INTE, sizeOfInte);
+
+            if ((block_tstep.size() != block.numSteps) || (index.size() != nVect) ||
+                (block.start.back() != static_cast<uint64_t>(data_size)) || (data_end > fileSize))
+                break;
+
+            fileH.seekg(static_cast<std::streamoff>(data_end), std::ios_base::beg);
+
+            rstep.insert(rstep.end(), block_rstep.begin(), block_rstep.end());
+            tstep.insert(tstep.end(), block_tstep.begin(), block_tstep.end());
+            blocks.push_back(std::move(block));
+        }
+        catch (const std::runtime_error&) {
+            break;
+        }
+    }
+}
+
+
 void ExtESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN) {
 
     if (rootN.parent_path().is_absolute()){
@@ -428,6 +558,9 @@ void ExtESmry::updatePathAndRootName(std::filesystem::path& dir, std::filesystem
 bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind )
 {
+    if (m_chunked[ind])
+        return this->load_esmry_blocks(stringVect, keyIndexVect, loadKeyIndex, ind, to_ind);
+
     std::fstream fileH;
 
     fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
@@ -515,6 +648,87 @@ bool ExtESmry::load_esmry(const std::vector<std::string>& stringVect, const std:
 }
 
 
+bool ExtESmry::load_esmry_blocks(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
+                                 const std::vector<int>& loadKeyIndex, int ind, int to_ind )
+{
+    std::fstream fileH;
+
+    fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        return false;
+
+    const auto& blocks = m_blocks[ind];
+
+    std::vector<size_t> first_step { 0 };
+    for (const auto& block : blocks)
+        first_step.push_back(first_step.back() + block.numSteps);
+
+    // Read encoded data block by block, the order in which it is stored,
+    // and decode all vectors in parallel afterwards.
+
+    std::vector<int> key_ind(loadKeyIndex.size(), -1);
+
+    for (size_t n = 0 ; n < loadKeyIndex.size(); n++) {
+        auto it = m_keyword_index[ind].find(stringVect[loadKeyIndex[n]]);
+        if (it != m_keyword_index[ind].end())
+            key_ind[n] = it->second;
+    }
+
+    std::vector<std::vector<std::vector<int>>> encoded(loadKeyIndex.size());
+
+    try {
+        for (size_t b = 0; b < blocks.size(); b++) {
+            for (size_t n = 0 ; n < loadKeyIndex.size(); n++) {
+                if (key_ind[n] < 0)
+                    continue;
+
+                const auto begin = blocks[b].start[key_ind[n]];
+                const auto end = blocks[b].start[key_ind[n] + 1];
+
+                encoded[n].push_back(read_inte_range(fileH, blocks[b].dataPos, begin, end - begin));
+            }
+        }
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
+
+    fileH.close();
+
+    std::vector<std::vector<float>> smry_data(loadKeyIndex.size());
+    std::vector<std::exception_ptr> failures(loadKeyIndex.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (int n = 0 ; n < static_cast<int>(loadKeyIndex.size()); n++) {
+        try {
+            smry_data[n].resize(first_step.back(), 0.0);
+
+            if (key_ind[n] < 0)
+                continue;
+
+            for (size_t b = 0; b < blocks.size(); b++) {
+                const auto& words = encoded[n][b];
+                ExtSmryBlocks::decode(words.data(), words.size(),
+                                      smry_data[n].data() + first_step[b], blocks[b].numSteps);
+            }
+        }
+        catch (...) {
+            failures[n] = std::current_exception();
+        }
+    }
+
+    for (const auto& failure : failures)
+        if (failure)
+            std::rethrow_exception(failure);
+
+    for (size_t n = 0 ; n < loadKeyIndex.size(); n++)
+        m_vectorData[keyIndexVect[n]].insert(m_vectorData[keyIndexVect[n]].end(), smry_data[n].begin(), smry_data[n].begin() + to_ind + 1);
+
+    return true;
+}
+
+
 void ExtESmry::loadData(const std::vector<std::string>& stringVect)
 {
     auto start = std::chrono::system_clock::now();
@@ -600,9 +814,10 @@ std::vector<Opm::time_point> ExtESmry::dates() {
 std::vector<std::string> ExtESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
+    const auto shell_pattern = ShellPattern { pattern };
 
     for (const auto& key : m_keyword)
-        if (shmatch( pattern, key) )
+        if (shell_pattern.match(key))
             list.push_back(key);
 
     return list;
@@ -0,0 +1,273 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ExtSmryBlocks.hpp>
+
+#include <opm/io/eclipse/EclOutput.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+    // Encoding of a single vector's data in a block, stored as the first
+    // data word.  A vector is stored raw if compression does not pay off.
+    constexpr int encodingRaw = 0;
+    constexpr int encodingDeltaShuffle = 1;
+
+    // Run-length tokens.  Token bytes below 0x80 introduce (token + 1)
+    // literal bytes, token bytes at or above 0x80 represent
+    // (token - 0x80 + 1) zero bytes.
+    constexpr std::uint8_t zeroRunFlag = 0x80;
+    constexpr std::size_t maxRun = 128;
+
+    std::uint32_t floatBits(const float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof bits);
+        return bits;
+    }
+
+    int wordFromBits(const std::uint32_t bits)
+    {
+        int word;
+        std::memcpy(&word, &bits, sizeof word);
+        return word;
+    }
+
+    std::uint32_t bitsFromWord(const int word)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &word, sizeof bits);
+        return bits;
+    }
+
+    // XOR each value with its predecessor and split the result into
+    // four byte planes, least significant byte plane first.
+    std::vector<std::uint8_t> deltaShuffle(const float* values, const std::size_t n)
+    {
+        auto planes = std::vector<std::uint8_t>(4 * n);
+
+        std::uint32_t prev = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto bits = floatBits(values[i]);
+            const auto delta = bits ^ prev;
+            prev = bits;
+
+            for (std::size_t p = 0; p < 4; ++p) {
+                planes[p*n + i] = static_cast<std::uint8_t>(delta >> (8 * p));
+            }
+        }
+
+        return planes;
+    }
+
+    std::vector<std::uint8_t> runLengthEncode(const std::vector<std::uint8_t>& bytes)
+    {
+        std::vector<std::uint8_t> out;
+        out.reserve(bytes.size() / 4);
+
+        std::size_t i = 0;
+        while (i < bytes.size()) {
+            auto run = std::size_t{0};
+            while ((i + run < bytes.size()) && (bytes[i + run] == 0) && (run < maxRun)) {
+                ++run;
+            }
+
+            if (run >= 2) {
+                out.push_back(static_cast<std::uint8_t>(zeroRunFlag + run - 1));
+                i += run;
+                continue;
+            }
+
+            // Literal run up to the next pair of zero bytes.
+            const auto begin = i;
+            while ((i < bytes.size()) && (i - begin < maxRun) &&
+                   !((bytes[i] == 0) && (i + 1 < bytes.size()) && (bytes[i + 1] == 0)))
+            {
+                ++i;
+            }
+
+            out.push_back(static_cast<std::uint8_t>(i - begin - 1));
+            out.insert(out.end(), bytes.begin() + begin, bytes.begin() + i);
+        }
+
+        return out;
+    }
+
+    void corrupt()
+    {
+        throw std::runtime_error("Inconsistent compressed data in ESMRY time block");
+    }
+
+    // Byte number ix of bytes packed little-endian into words.
+    std::uint8_t byteAt(const int* words, const std::size_t ix)
+    {
+        return static_cast<std::uint8_t>(bitsFromWord(words[ix / 4]) >> (8 * (ix % 4)));
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO { namespace ExtSmryBlocks {
+
+void writeSpec(EclOutput& outFile, const int nVect, const Compression compression)
+{
+    outFile.write<int>("BLKSPEC", { layoutVersion, static_cast<int>(compression), nVect });
+}
+
+void writeBlock(EclOutput& outFile,
+                const std::vector<int>& rstep,
+                const std::vector<int>& tstep,
+                const std::vector<std::vector<float>>& vectorData,
+                const std::size_t first,
+                const Compression compression)
+{
+    if (rstep.size() != tstep.size()) {
+        throw std::invalid_argument("Inconsistent number of time steps in ESMRY time block");
+    }
+
+    const auto n = rstep.size();
+
+    std::vector<int> index;
+    std::vector<int> data;
+
+    index.reserve(vectorData.size());
+    data.reserve(vectorData.size() * (n + 1));
+
+    for (const auto& vect : vectorData) {
+        if (vect.size() < first + n) {
+            throw std::invalid_argument("Summary vector too short for ESMRY time block");
+        }
+
+        const auto encoded = encode(vect.data() + first, n, compression);
+
+        index.push_back(static_cast<int>(encoded.size()));
+        data.insert(data.end(), encoded.begin(), encoded.end());
+    }
+
+    outFile.write<int>("RSTEP", rstep);
+    outFile.write<int>("TSTEP", tstep);
+    outFile.write<int>("BLKINDEX", index);
+    outFile.write<int>("BLKDATA", data);
+}
+
+std::vector<int> encode(const float* values, const std::size_t n,
+                        const Compression compression)
+{
+    if (compression == Compression::DeltaShuffle) {
+        const auto packed = runLengthEncode(deltaShuffle(values, n));
+
+        // Only worth it if the packed bytes occupy fewer words than the
+        // raw values.
+        if (packed.size() < 4 * n) {
+            auto words = std::vector<int>(1 + (packed.size() + 3) / 4, 0);
+            words[0] = encodingDeltaShuffle;
+
+            for (std::size_t i = 0; i < packed.size(); ++i) {
+                const auto bits = bitsFromWord(words[1 + i/4])
+                    | (static_cast<std::uint32_t>(packed[i]) << (8 * (i % 4)));
+                words[1 + i/4] = wordFromBits(bits);
+            }
+
+            return words;
+        }
+    }
+
+    auto words = std::vector<int>(1 + n);
+    words[0] = encodingRaw;
+
+    std::transform(values, values + n, words.begin() + 1,
+                   [](const float value) { return wordFromBits(floatBits(value)); });
+
+    return words;
+}
+
+void decode(const int* words, const std::size_t nWords,
+            float* values, const std::size_t n)
+{
+    if (nWords == 0) {
+        corrupt();
+    }
+
+    if (words[0] == encodingRaw) {
+        if (nWords != n + 1) {
+            corrupt();
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto bits = bitsFromWord(words[1 + i]);
+            std::memcpy(&values[i], &bits, sizeof bits);
+        }
+
+        return;
+    }
+
+    if (words[0] != encodingDeltaShuffle) {
+        corrupt();
+    }
+
+    // Expand run-length tokens into byte planes.
+    const int* packed = words + 1;
+    const auto nPacked = 4 * (nWords - 1);
+
+    auto planes = std::vector<std::uint8_t>(4 * n, 0);
+
+    std::size_t in = 0;
+    std::size_t out = 0;
+    while (out < planes.size()) {
+        if (in >= nPacked) {
+            corrupt();
+        }
+
+        const auto token = byteAt(packed, in++);
+        const auto run = static_cast<std::size_t>(token & ~zeroRunFlag) + 1;
+
+        if (out + run > planes.size()) {
+            corrupt();
+        }
+
+        if (token & zeroRunFlag) {
+            out += run;         // Already zero
+        }
+        else {
+            if (in + run > nPacked) {
+                corrupt();
+            }
+
+            for (std::size_t i = 0; i < run; ++i) {
+                planes[out++] = byteAt(packed, in++);
+            }
+        }
+    }
+
+    // Merge byte planes and undo the XOR-delta.
+    std::uint32_t prev = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint32_t delta = 0;
+        for (std::size_t p = 0; p < 4; ++p) {
+            delta |= static_cast<std::uint32_t>(planes[p*n + i]) << (8 * p);
+        }
+
+        prev ^= delta;
+        std::memcpy(&values[i], &prev, sizeof prev);
+    }
+}
+
+}}} // namespace Opm::EclIO::ExtSmryBlocks
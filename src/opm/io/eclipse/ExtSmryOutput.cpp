@@ -34,7 +34,8 @@ namespace Opm { namespace EclIO {
 
 
 ExtSmryOutput::ExtSmryOutput(const std::vector<std::string>& valueKeys, const std::vector<std::string>& valueUnits,
-                 const EclipseState& es, const time_t start_time)
+                 const EclipseState& es, const time_t start_time, const ExtSmryLayout layout)
+    : m_layout(layout)
 {
     m_nVect = valueKeys.size();
     m_nTimeSteps = 0;
@@ -87,56 +88,99 @@ void ExtSmryOutput::write(const std::vector<float>& ts_data, int report_step, bo
     // flow is yet not supporting rptonly in summary
     // tstep = {0,1,2 .. , m_nTimeSteps-1}
 
-    if (m_tstep.size()==0)
-        m_tstep.push_back(0);
-    else
-        m_tstep.push_back(m_tstep.back()+1);
+    m_tstep.push_back(m_nTimeSteps);
 
     for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++)
         m_smrydata[n].push_back(ts_data[n]);
 
     if ((is_final_summary) || (elapsed_seconds.count() > m_min_write_interval))
     {
-        const auto tp = std::chrono::system_clock::now();
-        auto sec_since_epoch = std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
+        if (m_layout == ExtSmryLayout::Transposed)
+            this->write_transposed();
+        else
+            this->append_block();
+    }
+
+    m_nTimeSteps++;
+}
 
-        std::filesystem::path esmry_file(m_outputFileName);
-        std::filesystem::path rootName = esmry_file.parent_path() / esmry_file.stem();           
+void ExtSmryOutput::write_header(EclOutput& outFile) const
+{
+    outFile.write<int>("START", m_start_date_vect);
 
-        std::string tmp_file_name = rootName.string() + "_TMP_" + std::to_string(sec_since_epoch) + ".ESMRY";
-        
-        {
-            Opm::EclIO::EclOutput outFile(tmp_file_name, m_fmt, std::ios::out);
+    if (m_restart_rootn.size() > 0) {
+        outFile.write<std::string>("RESTART", {m_restart_rootn});
+        outFile.write<int>("RSTNUM", {m_restart_step});
+    }
 
-            outFile.write<int>("START", m_start_date_vect);
+    outFile.write("KEYCHECK", m_smry_keys);
+    outFile.write("UNITS", m_smryUnits);
+}
 
-            if (m_restart_rootn.size() > 0) {
-                outFile.write<std::string>("RESTART", {m_restart_rootn});
-                outFile.write<int>("RSTNUM", {m_restart_step});
-            }
+void ExtSmryOutput::write_transposed()
+{
+    const auto tp = std::chrono::system_clock::now();
+    auto sec_since_epoch = std::chrono::duration_cast<std::chrono::seconds>(tp.time_since_epoch()).count();
 
-            outFile.write("KEYCHECK", m_smry_keys);
-            outFile.write("UNITS", m_smryUnits);
+    std::filesystem::path esmry_file(m_outputFileName);
+    std::filesystem::path rootName = esmry_file.parent_path() / esmry_file.stem();
 
-            outFile.write<int>("RSTEP", m_rstep);
-            outFile.write<int>("TSTEP", m_tstep);
+    std::string tmp_file_name = rootName.string() + "_TMP_" + std::to_string(sec_since_epoch) + ".ESMRY";
 
-            for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++ ) {
-                std::string vect_name="V" + std::to_string(n);
-                outFile.write<float>(vect_name, m_smrydata[n]);
-            }
-        }
+    {
+        Opm::EclIO::EclOutput outFile(tmp_file_name, m_fmt, std::ios::out);
 
-        if (rename_tmpfile(tmp_file_name)){
-            m_last_write = std::chrono::system_clock::now();
-        } else {
-            Opm::OpmLog::warning("Not able to rename temporary ESMRY file " + tmp_file_name);
-            std::filesystem::path tmp_file(tmp_file_name);        
-            std::filesystem::remove(tmp_file);
+        this->write_header(outFile);
+
+        outFile.write<int>("RSTEP", m_rstep);
+        outFile.write<int>("TSTEP", m_tstep);
+
+        for (size_t n = 0; n < static_cast<size_t>(m_nVect); n++ ) {
+            std::string vect_name="V" + std::to_string(n);
+            outFile.write<float>(vect_name, m_smrydata[n]);
         }
     }
 
-    m_nTimeSteps++;
+    if (rename_tmpfile(tmp_file_name)){
+        m_last_write = std::chrono::system_clock::now();
+    } else {
+        Opm::OpmLog::warning("Not able to rename temporary ESMRY file " + tmp_file_name);
+        std::filesystem::path tmp_file(tmp_file_name);
+        std::filesystem::remove(tmp_file);
+    }
+}
+
+void ExtSmryOutput::append_block()
+{
+    // Time steps written since the previous write are appended as a new
+    // time block.  Data already on disk is never rewritten, and readers
+    // ignore a trailing block which is not yet completely written.
+
+    const auto compression = (m_layout == ExtSmryLayout::ChunkedCompressed)
+        ? ExtSmryBlocks::Compression::DeltaShuffle
+        : ExtSmryBlocks::Compression::None;
+
+    if (!m_blockFileCreated) {
+        Opm::EclIO::EclOutput outFile(m_outputFileName, m_fmt, std::ios::out);
+
+        this->write_header(outFile);
+        ExtSmryBlocks::writeSpec(outFile, m_nVect, compression);
+
+        m_blockFileCreated = true;
+    }
+
+    {
+        Opm::EclIO::EclOutput outFile(m_outputFileName, m_fmt, std::ios::app);
+        ExtSmryBlocks::writeBlock(outFile, m_rstep, m_tstep, m_smrydata, 0, compression);
+    }
+
+    m_rstep.clear();
+    m_tstep.clear();
+
+    for (auto& vect : m_smrydata)
+        vect.clear();
+
+    m_last_write = std::chrono::system_clock::now();
 }
 
 bool ExtSmryOutput::rename_tmpfile(const std::string& tmp_fname)
@@ -0,0 +1,128 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Opm { namespace EclIO {
+
+#ifdef _WIN32
+
+// No mmap() available.  Read the whole file into memory instead.
+MappedFile::MappedFile(const std::string& filename)
+    : filename_(filename)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream) {
+        throw std::runtime_error(fmt::format("Can not open file {}", filename));
+    }
+
+    this->buffer_.assign(std::istreambuf_iterator<char>(stream),
+                         std::istreambuf_iterator<char>());
+
+    this->size_ = this->buffer_.size();
+    if (this->size_ > 0) {
+        this->data_ = this->buffer_.data();
+    }
+}
+
+MappedFile::~MappedFile() = default;
+
+#else
+
+MappedFile::MappedFile(const std::string& filename)
+    : filename_(filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(fmt::format("Can not open file {}: {}",
+                                             filename, std::strerror(errno)));
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        const auto err = errno;
+        ::close(fd);
+        throw std::runtime_error(fmt::format("Can not determine size of file {}: {}",
+                                             filename, std::strerror(err)));
+    }
+
+    this->size_ = static_cast<std::size_t>(st.st_size);
+
+    if (this->size_ > 0) {
+        void* addr = ::mmap(nullptr, this->size_, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            const auto err = errno;
+            ::close(fd);
+            throw std::runtime_error(fmt::format("Can not memory map file {}: {}",
+                                                 filename, std::strerror(err)));
+        }
+
+        this->data_ = static_cast<const char*>(addr);
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (this->data_ != nullptr) {
+        ::munmap(const_cast<char*>(this->data_), this->size_);
+    }
+}
+
+#endif // _WIN32
+
+void MappedFile::willNeed(std::uint64_t offset, std::uint64_t length) const
+{
+#if defined(POSIX_MADV_WILLNEED)
+    if ((this->data_ == nullptr) || (offset >= this->size_)) {
+        return;
+    }
+
+    // posix_madvise() requires a page aligned start address.
+    const auto pageSize = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+    const auto start = offset - (offset % pageSize);
+    const auto end = std::min<std::uint64_t>(offset + length, this->size_);
+
+    ::posix_madvise(const_cast<char*>(this->data_ + start),
+                    end - start, POSIX_MADV_WILLNEED);
+#else
+    static_cast<void>(offset);
+    static_cast<void>(length);
+#endif
+}
+
+}} // namespace Opm::EclIO
@@ -360,6 +360,16 @@ write(const std::string& kw, const std::vector<double>& data)
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Restart::
+write(const std::string&                           kw,
+      const std::vector<double>&                   data,
+      const std::function<void(double*, double*)>& convert,
+      const bool                                   write_double)
+{
+    this->stream().write(kw, data, convert, write_double);
+}
+
 void
 Opm::EclIO::OutputStream::Restart::
 write(const std::string& kw, const std::vector<std::string>& data)
@@ -22,7 +22,7 @@
 */
 
 #include <config.h>
-#include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
+#include <opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
@@ -34,11 +34,13 @@
 
 #include <fmt/format.h>
 
+#include <cassert>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 initFromState(const EclipseState& eclState, const Schedule& schedule)
 {
     std::size_t numRegions = eclState.runspec().tabdims().getNumPVTTables();
@@ -90,18 +92,21 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
     }
 
     if (phaseIsActive(gasPhaseIdx)) {
-        gasPvt_ = std::make_shared<GasPvt>();
-        gasPvt_->initFromState(eclState, schedule);
+        auto gasPvt = std::make_shared<GasPvt>();
+        gasPvt->initFromState(eclState, schedule);
+        gasPvt_ = std::move(gasPvt);
     }
 
     if (phaseIsActive(oilPhaseIdx)) {
-        oilPvt_ = std::make_shared<OilPvt>();
-        oilPvt_->initFromState(eclState, schedule);
+        auto oilPvt = std::make_shared<OilPvt>();
+        oilPvt->initFromState(eclState, schedule);
+        oilPvt_ = std::move(oilPvt);
     }
 
     if (phaseIsActive(waterPhaseIdx)) {
-        waterPvt_ = std::make_shared<WaterPvt>();
-        waterPvt_->initFromState(eclState, schedule);
+        auto waterPvt = std::make_shared<WaterPvt>();
+        waterPvt->initFromState(eclState, schedule);
+        waterPvt_ = std::move(waterPvt);
     }
 
     // set the reference densities of all PVT regions
@@ -211,7 +216,7 @@ initFromState(const EclipseState& eclState, const Schedule& schedule)
 #endif
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 initBegin(std::size_t numPvtRegions)
 {
     isInitialized_ = false;
@@ -237,7 +242,7 @@ initBegin(std::size_t numPvtRegions)
 }
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 setReferenceDensities(Scalar rhoOil,
                       Scalar rhoWater,
                       Scalar rhoGas,
@@ -249,7 +254,7 @@ setReferenceDensities(Scalar rhoOil,
 }
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::initEnd()
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::initEnd()
 {
     // calculate the final 2D functions which are used for interpolation.
     std::size_t numRegions = molarMass_.size();
@@ -287,7 +292,7 @@ void BlackOilFluidSystem<Scalar,IndexTraits>::initEnd()
 }
 
 template <class Scalar, class IndexTraits>
-const char* BlackOilFluidSystem<Scalar,IndexTraits>::
+const char* BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 phaseName(unsigned phaseIdx)
 {
     switch (phaseIdx) {
@@ -304,7 +309,7 @@ phaseName(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-unsigned BlackOilFluidSystem<Scalar,IndexTraits>::
+unsigned BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 solventComponentIndex(unsigned phaseIdx)
 {
     switch (phaseIdx) {
@@ -321,8 +326,8 @@ solventComponentIndex(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-unsigned BlackOilFluidSystem<Scalar,IndexTraits>::
-soluteComponentIndex(unsigned phaseIdx)
+unsigned BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
+soluteComponentIndex(unsigned phaseIdx) const
 {
     switch (phaseIdx) {
     case waterPhaseIdx:
@@ -340,7 +345,7 @@ soluteComponentIndex(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-const char* BlackOilFluidSystem<Scalar,IndexTraits>::
+const char* BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 componentName(unsigned compIdx)
 {
     switch (compIdx) {
@@ -357,16 +362,16 @@ componentName(unsigned compIdx)
 }
 
 template <class Scalar, class IndexTraits>
-short BlackOilFluidSystem<Scalar,IndexTraits>::
-activeToCanonicalPhaseIdx(unsigned activePhaseIdx)
+short BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
+activeToCanonicalPhaseIdx(unsigned activePhaseIdx) const
 {
     assert(activePhaseIdx<numActivePhases());
     return activeToCanonicalPhaseIdx_[activePhaseIdx];
 }
 
 template <class Scalar, class IndexTraits>
-short BlackOilFluidSystem<Scalar,IndexTraits>::
-canonicalToActivePhaseIdx(unsigned phaseIdx)
+short BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
+canonicalToActivePhaseIdx(unsigned phaseIdx) const
 {
     assert(phaseIdx<numPhases);
     assert(phaseIsActive(phaseIdx));
@@ -374,14 +379,14 @@ canonicalToActivePhaseIdx(unsigned phaseIdx)
 }
 
 template <class Scalar, class IndexTraits>
-void BlackOilFluidSystem<Scalar,IndexTraits>::
+void BlackOilFluidSystemNonStatic<Scalar,IndexTraits>::
 resizeArrays_(std::size_t numRegions)
 {
     molarMass_.resize(numRegions);
     referenceDensity_.resize(numRegions);
 }
 
-template class BlackOilFluidSystem<double,BlackOilDefaultIndexTraits>;
-template class BlackOilFluidSystem<float,BlackOilDefaultIndexTraits>;
+template class BlackOilFluidSystemNonStatic<double,BlackOilDefaultIndexTraits>;
+template class BlackOilFluidSystemNonStatic<float,BlackOilDefaultIndexTraits>;
 
 } // namespace Opm
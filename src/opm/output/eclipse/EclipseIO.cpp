@@ -28,6 +28,11 @@
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
@@ -54,12 +59,18 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
 #include <limits>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>    // move
 
@@ -98,6 +109,130 @@ void ensure_directory_exists( const std::filesystem::path& odir )
     }
 }
 
+/// Single background thread which runs output tasks in submission order.
+class OutputThread
+{
+public:
+    explicit OutputThread(const std::size_t max_pending)
+        : max_pending_ { std::max(max_pending, std::size_t{1}) }
+        , thread_      { [this]() { this->run(); } }
+    {}
+
+    OutputThread(const OutputThread&) = delete;
+    OutputThread& operator=(const OutputThread&) = delete;
+
+    /// Completes all queued tasks before returning.
+    ~OutputThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock { this->mutex_ };
+            this->stop_ = true;
+        }
+
+        this->task_queued_.notify_one();
+        this->thread_.join();
+
+        if (this->error_) {
+            try {
+                std::rethrow_exception(this->error_);
+            }
+            catch (const std::exception& e) {
+                Opm::OpmLog::error(std::string { "Asynchronous output failed: " } + e.what());
+            }
+            catch (...) {
+                Opm::OpmLog::error("Asynchronous output failed");
+            }
+        }
+    }
+
+    /// Queue task, waiting for space in the queue if needed.
+    void submit(std::function<void()> task)
+    {
+        std::unique_lock<std::mutex> lock { this->mutex_ };
+        this->task_done_.wait(lock, [this]()
+        {
+            return (this->tasks_.size() < this->max_pending_) || this->error_;
+        });
+
+        this->rethrow();
+
+        this->tasks_.push_back(std::move(task));
+        lock.unlock();
+
+        this->task_queued_.notify_one();
+    }
+
+    /// Wait until all queued tasks have completed.
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock { this->mutex_ };
+        this->task_done_.wait(lock, [this]()
+        {
+            return this->tasks_.empty() && !this->busy_;
+        });
+
+        this->rethrow();
+    }
+
+private:
+    std::size_t max_pending_;
+    std::deque<std::function<void()>> tasks_{};
+    bool busy_ { false };
+    bool stop_ { false };
+    std::exception_ptr error_{};
+
+    std::mutex mutex_{};
+    std::condition_variable task_queued_{};
+    std::condition_variable task_done_{};
+
+    // Last, so the thread starts after all other members are initialised.
+    std::thread thread_;
+
+    // Precondition: mutex_ is locked.
+    void rethrow()
+    {
+        if (this->error_) {
+            std::rethrow_exception(std::exchange(this->error_, nullptr));
+        }
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock { this->mutex_ };
+        while (true) {
+            this->task_queued_.wait(lock, [this]()
+            {
+                return this->stop_ || !this->tasks_.empty();
+            });
+
+            if (this->tasks_.empty()) {
+                return;
+            }
+
+            auto task = std::move(this->tasks_.front());
+            this->tasks_.pop_front();
+            this->busy_ = true;
+            lock.unlock();
+
+            auto error = std::exception_ptr{};
+            try {
+                task();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            this->busy_ = false;
+            if (error && !this->error_) {
+                this->error_ = error;
+            }
+
+            this->task_done_.notify_all();
+        }
+    }
+};
+
 }
 
 namespace Opm {
@@ -114,6 +249,19 @@ class EclipseIO::Impl {
 
         void recordSummaryOutput(const double secs_elapsed);
 
+        void writeTimeStepFiles(const Action::State& action_state,
+                                const WellTestState& wtest_state,
+                                const SummaryState&  st,
+                                const UDQState&      udq_state,
+                                const int            report_step,
+                                const bool           isSubstep,
+                                const double         secs_elapsed,
+                                const bool           write_summary,
+                                RestartValue         value,
+                                const bool           write_double);
+
+        void waitForOutput();
+
         const EclipseState& es;
         EclipseGrid grid;
         const Schedule& schedule;
@@ -124,6 +272,10 @@ class EclipseIO::Impl {
         bool output_enabled;
         std::optional<RestartIO::Helpers::AggregateAquiferData> aquiferData{std::nullopt};
 
+        // Declared last, so that pending output completes before any other
+        // member is destroyed.
+        std::unique_ptr<OutputThread> outputThread{};
+
 private:
     mutable bool sumthin_active_{false};
     mutable bool sumthin_triggered_{false};
@@ -249,6 +401,8 @@ void EclipseIO::writeInitial( data::Solution simProps, std::map<std::string, std
     if( !this->impl->output_enabled )
         return;
 
+    this->impl->waitForOutput();
+
     {
         const auto& es = this->impl->es;
         const IOConfig& ioConfig = es.cfg().io();
@@ -263,42 +417,29 @@ void EclipseIO::writeInitial( data::Solution simProps, std::map<std::string, std
 
 }
 
-// implementation of the writeTimeStep method
-void EclipseIO::writeTimeStep(const Action::State& action_state,
-                              const WellTestState& wtest_state,
-                              const SummaryState& st,
-                              const UDQState& udq_state,
-                              int report_step,
-                              bool  isSubstep,
-                              double secs_elapsed,
-                              RestartValue value,
-                              const bool write_double)
- {
-    if (! this->impl->output_enabled) {
-        return;
-    }
-
-    const auto& es = this->impl->es;
-    const auto& grid = this->impl->grid;
-    const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
+void EclipseIO::Impl::writeTimeStepFiles(const Action::State& action_state,
+                                         const WellTestState& wtest_state,
+                                         const SummaryState&  st,
+                                         const UDQState&      udq_state,
+                                         const int            report_step,
+                                         const bool           isSubstep,
+                                         const double         secs_elapsed,
+                                         const bool           write_summary,
+                                         RestartValue         value,
+                                         const bool           write_double)
+{
+    const auto& ioConfig = this->es.cfg().io();
 
-    const bool final_step { report_step == static_cast<int>(schedule.size()) - 1 };
+    const bool final_step { report_step == static_cast<int>(this->schedule.size()) - 1 };
     const bool is_final_summary = final_step && !isSubstep;
 
-    if ((report_step > 0) &&
-        this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed))
-    {
-        this->impl->summary.add_timestep(st, report_step, isSubstep);
-        this->impl->summary.write(is_final_summary);
-
-        this->impl->recordSummaryOutput(secs_elapsed);
+    if (write_summary) {
+        this->summary.add_timestep(st, report_step, isSubstep);
+        this->summary.write(is_final_summary);
     }
 
-
-    if (final_step && !isSubstep && this->impl->summaryConfig.createRunSummary()) {
-        std::filesystem::path outputDir { this->impl->outputDir } ;
-        std::filesystem::path outputFile { outputDir / this->impl->baseName } ;
+    if (final_step && !isSubstep && this->summaryConfig.createRunSummary()) {
+        const auto outputFile = std::filesystem::path { this->outputDir } / this->baseName;
         EclIO::ESmry(outputFile).write_rsm_file();
     }
 
@@ -307,24 +448,24 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
       but there is an unsupported option to the RPTSCHED keyword which
       will request restart output from every timestep.
     */
-    if(!isSubstep && schedule.write_rst_file(report_step))
+    if(!isSubstep && this->schedule.write_rst_file(report_step))
     {
         EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
             report_step,
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
             EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
         };
 
         RestartIO::save(rstFile, report_step, secs_elapsed, value,
-                        es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
+                        this->es, this->grid, this->schedule, action_state, wtest_state, st,
+                        udq_state, this->aquiferData, write_double);
     }
 
     // RFT file written only if requested and never for substeps.
     if (const auto& [wantRFT, haveExistingRFT] =
-        this->impl->wantRFTOutput(report_step, isSubstep);
+        this->wantRFTOutput(report_step, isSubstep);
         wantRFT)
     {
         // Open existing RFT file if report step is after first RFT event.
@@ -333,22 +474,75 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
         };
 
         EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
             openExisting
         };
 
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+        RftIO::write(report_step, secs_elapsed, this->es.getUnits(),
+                     this->grid, this->schedule, value.wells, rftFile);
+    }
+}
+
+void EclipseIO::Impl::waitForOutput()
+{
+    if (this->outputThread != nullptr) {
+        this->outputThread->wait();
+    }
+}
+
+// implementation of the writeTimeStep method
+void EclipseIO::writeTimeStep(const Action::State& action_state,
+                              const WellTestState& wtest_state,
+                              const SummaryState& st,
+                              const UDQState& udq_state,
+                              int report_step,
+                              bool  isSubstep,
+                              double secs_elapsed,
+                              RestartValue value,
+                              const bool write_double)
+ {
+    if (! this->impl->output_enabled) {
+        return;
+    }
+
+    const auto& schedule = this->impl->schedule;
+
+    // The SUMTHIN bookkeeping is done here, in submission order, even if
+    // the summary file itself is written asynchronously.
+    const bool write_summary = (report_step > 0) &&
+        this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed);
+
+    if (write_summary) {
+        this->impl->recordSummaryOutput(secs_elapsed);
+    }
+
+    if (this->impl->outputThread == nullptr) {
+        this->impl->writeTimeStepFiles(action_state, wtest_state, st, udq_state,
+                                       report_step, isSubstep, secs_elapsed,
+                                       write_summary, std::move(value), write_double);
+    }
+    else {
+        this->impl->outputThread->submit(
+            [impl = this->impl.get(), action_state, wtest_state, st, udq_state,
+             report_step, isSubstep, secs_elapsed, write_summary,
+             value = std::move(value), write_double]() mutable
+            {
+                impl->writeTimeStepFiles(action_state, wtest_state, st, udq_state,
+                                         report_step, isSubstep, secs_elapsed,
+                                         write_summary, std::move(value), write_double);
+            });
     }
 
+    // Reports only depend on the input, and go to the log in the order of
+    // the report steps.
     if (!isSubstep) {
         for (const auto& report : schedule[report_step].rpt_config.get()) {
             std::stringstream ss;
             const auto& unit_system = this->impl->es.getUnits();
 
-            RptIO::write_report(ss, report.first, report.second, schedule, grid, unit_system, report_step);
+            RptIO::write_report(ss, report.first, report.second, schedule, this->impl->grid, unit_system, report_step);
 
             auto log_string = ss.str();
             if (!log_string.empty())
@@ -357,6 +551,17 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
     }
  }
 
+void EclipseIO::enableAsyncOutput(const std::size_t max_pending)
+{
+    this->impl->waitForOutput();
+    this->impl->outputThread = std::make_unique<OutputThread>(max_pending);
+}
+
+void EclipseIO::waitForOutput()
+{
+    this->impl->waitForOutput();
+}
+
 
 RestartValue EclipseIO::loadRestart(Action::State& action_state, SummaryState& summary_state, const std::vector<RestartKey>& solution_keys, const std::vector<RestartKey>& extra_keys) const {
     const auto& es                       = this->impl->es;
@@ -389,6 +594,7 @@ EclipseIO::EclipseIO( const EclipseState& es,
 }
 
 const out::Summary& EclipseIO::summary() {
+    this->impl->waitForOutput();
     return this->impl->summary;
 }
 
@@ -18,8 +18,11 @@
 */
 
 #include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <optional>
+#include <stdexcept>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -30,6 +33,13 @@ namespace Opm {
 namespace {
 static const std::string FIELD_NAME = std::string{"FIELD"};
 static const std::size_t FIELD_ID   = 0;
+
+constexpr std::size_t num_phases = static_cast<std::size_t>(Inplace::Phase::WaterInWaterPhase) + 1;
+static_assert(num_phases <= 32, "Phase mask must hold all phases");
+
+std::uint32_t phase_bit(Inplace::Phase phase) {
+    return std::uint32_t{1} << static_cast<std::size_t>(phase);
+}
 }
 
 
@@ -40,28 +50,99 @@ Inplace Inplace::serializationTestObject() {
     return result;
 }
 
+std::optional<std::size_t> Inplace::region_set(const std::string& region) const {
+    // There are typically only a handful of region sets, so a linear search
+    // is faster than hashing the name.
+    auto iter = std::find(this->region_names.begin(), this->region_names.end(), region);
+    if (iter == this->region_names.end())
+        return std::nullopt;
+
+    return static_cast<std::size_t>(std::distance(this->region_names.begin(), iter));
+}
+
+std::size_t Inplace::add_region_set(const std::string& region) {
+    if (auto set = this->region_set(region); set.has_value())
+        return *set;
+
+    this->region_names.push_back(region);
+    this->block_offset.push_back(this->values.size());
+    this->region_size.push_back(0);
+    this->max_ids.push_back(0);
+    this->phase_mask.push_back(0);
+    return this->region_names.size() - 1;
+}
+
+std::size_t Inplace::index(std::size_t set, Phase phase, std::size_t region_id) const {
+    return this->block_offset[set] + static_cast<std::size_t>(phase) * this->region_size[set] + region_id;
+}
+
+void Inplace::ensure_region(std::size_t set, std::size_t region_id) {
+    if (region_id < this->region_size[set])
+        return;
+
+    const auto new_size = std::max(region_id + 1, 2 * this->region_size[set]);
+
+    std::vector<double> new_values;
+    std::vector<unsigned char> new_defined;
+    new_values.reserve(this->values.size() + num_phases * (new_size - this->region_size[set]));
+    new_defined.reserve(new_values.capacity());
+
+    for (std::size_t s = 0; s < this->region_names.size(); s++) {
+        const auto old_offset = this->block_offset[s];
+        const auto old_size = this->region_size[s];
+        const auto size = (s == set) ? new_size : old_size;
+
+        this->block_offset[s] = new_values.size();
+        for (std::size_t p = 0; p < num_phases; p++) {
+            const auto row = old_offset + p * old_size;
+            new_values.insert(new_values.end(), this->values.begin() + row, this->values.begin() + row + old_size);
+            new_defined.insert(new_defined.end(), this->defined.begin() + row, this->defined.begin() + row + old_size);
+            new_values.resize(new_values.size() + size - old_size, 0.0);
+            new_defined.resize(new_defined.size() + size - old_size, 0);
+        }
+        this->region_size[s] = size;
+    }
+
+    this->values = std::move(new_values);
+    this->defined = std::move(new_defined);
+}
+
 void Inplace::add(const std::string& region, Inplace::Phase phase, std::size_t region_id, double value) {
-    this->phase_values[region][phase][region_id] = value;
+    const auto set = this->add_region_set(region);
+    this->ensure_region(set, region_id);
+
+    const auto ix = this->index(set, phase, region_id);
+    this->values[ix] = value;
+    this->defined[ix] = 1;
+    this->phase_mask[set] |= phase_bit(phase);
+    this->max_ids[set] = std::max(this->max_ids[set], region_id);
 }
 
 void Inplace::add(Inplace::Phase phase, double value) {
     this->add( FIELD_NAME, phase, FIELD_ID, value );
 }
 
+const double* Inplace::find(const std::string& region, Phase phase, std::size_t region_id) const {
+    const auto set = this->region_set(region);
+    if (!set.has_value() || (region_id >= this->region_size[*set]))
+        return nullptr;
+
+    const auto ix = this->index(*set, phase, region_id);
+    return this->defined[ix] ? &this->values[ix] : nullptr;
+}
+
 double Inplace::get(const std::string& region, Inplace::Phase phase, std::size_t region_id) const {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end())
+    if (const auto* value = this->find(region, phase, region_id); value != nullptr)
+        return *value;
+
+    const auto set = this->region_set(region);
+    if (!set.has_value())
         throw std::logic_error(fmt::format("No such region: {}", region));
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end())
+    if ((this->phase_mask[*set] & phase_bit(phase)) == 0)
         throw std::logic_error(fmt::format("No such phase: {}:{}", region, static_cast<int>(phase)));
 
-    auto value_iter = phase_iter->second.find(region_id);
-    if (value_iter == phase_iter->second.end())
-        throw std::logic_error(fmt::format("No such region id: {}:{}:{}", region, static_cast<int>(phase), region_id));
-
-    return value_iter->second;
+    throw std::logic_error(fmt::format("No such region id: {}:{}:{}", region, static_cast<int>(phase), region_id));
 }
 
 double Inplace::get(Inplace::Phase phase) const {
@@ -69,78 +150,150 @@ double Inplace::get(Inplace::Phase phase) const {
 }
 
 bool Inplace::has(const std::string& region, Phase phase, std::size_t region_id) const {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end())
-        return false;
-
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end())
-        return false;
-
-    auto value_iter = phase_iter->second.find(region_id);
-    if (value_iter == phase_iter->second.end())
-        return false;
-
-    return true;
+    return this->find(region, phase, region_id) != nullptr;
 }
 
 bool Inplace::has(Phase phase) const {
     return this->has(FIELD_NAME, phase, FIELD_ID);
 }
 
-namespace {
-std::size_t region_max(const std::unordered_map<std::size_t, double>& region_map) {
-    std::size_t max_value = 0;
-    for (const auto& [region_id, _] : region_map) {
-        (void)_;
-        max_value = std::max(max_value, region_id);
-    }
-    return max_value;
-}
-}
-
 std::size_t Inplace::max_region() const {
     std::size_t max_value = 0;
-    for (const auto& [_, phase_map] : this->phase_values) {
-        (void)_;
-        for (const auto& [__, region_map] : phase_map) {
-            (void)__;
-            max_value = std::max(max_value, region_max(region_map));
-        }
-    }
+    for (const auto& max_id : this->max_ids)
+        max_value = std::max(max_value, max_id);
 
     return max_value;
 }
 
 std::size_t Inplace::max_region(const std::string& region_name) const {
-    std::optional<std::size_t> max_value;
-    const auto& region_iter = this->phase_values.find(region_name);
-    if (region_iter != this->phase_values.end()) {
-        max_value = 0;
-        for (const auto& [_, region_map] : region_iter->second) {
-            (void)_;
-            max_value = std::max(*max_value, region_max(region_map));
-        }
-    }
-
-    if (!max_value.has_value())
+    const auto set = this->region_set(region_name);
+    if (!set.has_value())
         throw std::logic_error(fmt::format("No such region: {}", region_name));
 
-    return max_value.value();
+    return this->max_ids[*set];
 }
 
 
 // This should probably die - temporarily added for porting of ecloutputblackoilmodule
 std::vector<double> Inplace::get_vector(const std::string& region, Phase phase) const {
-    std::vector<double> v(this->max_region(region), 0);
-    const auto& region_map = this->phase_values.at(region).at(phase);
-    for (const auto& [region_id, value] : region_map)
-        v[region_id - 1] = value;
+    const auto set = this->region_set(region);
+    if (!set.has_value())
+        throw std::out_of_range(fmt::format("No such region: {}", region));
+
+    if ((this->phase_mask[*set] & phase_bit(phase)) == 0)
+        throw std::out_of_range(fmt::format("No such phase: {}:{}", region, static_cast<int>(phase)));
+
+    std::vector<double> v(this->max_ids[*set], 0);
+    for (std::size_t region_id = 1; region_id <= v.size(); region_id++) {
+        const auto ix = this->index(*set, phase, region_id);
+        if (this->defined[ix])
+            v[region_id - 1] = this->values[ix];
+    }
 
     return v;
 }
 
 
+void Inplace::add_region_sums(const std::unordered_map<std::string, std::vector<int>>& regions,
+                              const std::unordered_map<Phase, std::vector<double>>& cell_values)
+{
+    if (regions.empty() || cell_values.empty())
+        return;
+
+    const auto num_cells = regions.begin()->second.size();
+
+    std::vector<const std::string*> names;
+    std::vector<const int*> region_ids;
+    for (const auto& [name, ids] : regions) {
+        if (ids.size() != num_cells)
+            throw std::invalid_argument(fmt::format("Region set {} has {} cells, expected {}", name, ids.size(), num_cells));
+
+        names.push_back(&name);
+        region_ids.push_back(ids.data());
+    }
+
+    std::vector<Phase> phases;
+    std::vector<const double*> phase_values;
+    for (const auto& [phase, cell_value] : cell_values) {
+        if (cell_value.size() != num_cells)
+            throw std::invalid_argument(fmt::format("Phase {} has {} cell values, expected {}",
+                                                    static_cast<int>(phase), cell_value.size(), num_cells));
+
+        phases.push_back(phase);
+        phase_values.push_back(cell_value.data());
+    }
+
+    const auto num_sets = names.size();
+    const auto num_values = phases.size();
+
+    // Sums are accumulated in one array organised as [region set][region
+    // number][phase], so that the phase values of a cell are added to
+    // contiguous memory in all region sets.
+    std::vector<std::size_t> sum_offset(num_sets + 1, 0);
+    std::vector<int> max_id(num_sets, 0);
+    for (std::size_t set = 0; set < num_sets; set++) {
+        const auto* ids = region_ids[set];
+        int set_max = 0;
+#pragma omp parallel for reduction(max:set_max) schedule(static)
+        for (std::size_t cell = 0; cell < num_cells; cell++)
+            set_max = std::max(set_max, ids[cell]);
+
+        max_id[set] = set_max;
+        sum_offset[set + 1] = sum_offset[set] + (static_cast<std::size_t>(set_max) + 1) * num_values;
+    }
+
+    std::vector<double> sums(sum_offset.back(), 0.0);
+
+#pragma omp parallel
+    {
+        std::vector<double> local_sums(sums.size(), 0.0);
+        std::vector<double> cell_value(num_values);
+
+#pragma omp for schedule(static)
+        for (std::size_t cell = 0; cell < num_cells; cell++) {
+            for (std::size_t value = 0; value < num_values; value++)
+                cell_value[value] = phase_values[value][cell];
+
+            for (std::size_t set = 0; set < num_sets; set++) {
+                const auto region_id = region_ids[set][cell];
+                if (region_id < 1)
+                    continue;
+
+                auto* region_sums = local_sums.data() + sum_offset[set] + region_id * num_values;
+                for (std::size_t value = 0; value < num_values; value++)
+                    region_sums[value] += cell_value[value];
+            }
+        }
+
+#pragma omp critical
+        {
+            for (std::size_t i = 0; i < sums.size(); i++)
+                sums[i] += local_sums[i];
+        }
+    }
+
+    for (std::size_t set = 0; set < num_sets; set++) {
+        if (max_id[set] < 1)
+            continue;
+
+        const auto region_max = static_cast<std::size_t>(max_id[set]);
+        const auto dense_set = this->add_region_set(*names[set]);
+        this->ensure_region(dense_set, region_max);
+
+        for (std::size_t value = 0; value < num_values; value++) {
+            const auto phase = phases[value];
+            for (std::size_t region_id = 1; region_id <= region_max; region_id++) {
+                const auto ix = this->index(dense_set, phase, region_id);
+                this->values[ix] = sums[sum_offset[set] + region_id * num_values + value];
+                this->defined[ix] = 1;
+            }
+            this->phase_mask[dense_set] |= phase_bit(phase);
+        }
+        this->max_ids[dense_set] = std::max(this->max_ids[dense_set], region_max);
+    }
+}
+
+
 const std::vector<Inplace::Phase>& Inplace::phases() {
     static const std::vector<Phase> phases_ = {
         Inplace::Phase::WATER,
@@ -167,7 +320,38 @@ const std::vector<Inplace::Phase>& Inplace::phases() {
 
 bool Inplace::operator==(const Inplace& rhs) const
 {
-    return this->phase_values == rhs.phase_values;
+    // Layout depends on insertion order, compare the defined values only.
+    if (this->region_names.size() != rhs.region_names.size())
+        return false;
+
+    for (std::size_t set = 0; set < this->region_names.size(); set++) {
+        const auto rhs_set = rhs.region_set(this->region_names[set]);
+        if (!rhs_set.has_value())
+            return false;
+
+        if ((this->phase_mask[set] != rhs.phase_mask[*rhs_set]) ||
+            (this->max_ids[set] != rhs.max_ids[*rhs_set]))
+            return false;
+
+        const auto num_ids = std::min(this->max_ids[set] + 1, this->region_size[set]);
+        for (std::size_t p = 0; p < num_phases; p++) {
+            const auto phase = static_cast<Phase>(p);
+            if ((this->phase_mask[set] & phase_bit(phase)) == 0)
+                continue;
+
+            for (std::size_t region_id = 0; region_id < num_ids; region_id++) {
+                const auto ix = this->index(set, phase, region_id);
+                const auto rhs_ix = rhs.index(*rhs_set, phase, region_id);
+                if (this->defined[ix] != rhs.defined[rhs_ix])
+                    return false;
+
+                if (this->defined[ix] && (this->values[ix] != rhs.values[rhs_ix]))
+                    return false;
+            }
+        }
+    }
+
+    return true;
 }
 
 }
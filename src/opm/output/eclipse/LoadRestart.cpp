@@ -45,6 +45,7 @@
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/TracerConfig.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/Box.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
 #include <opm/input/eclipse/Schedule/ScheduleTypes.hpp>
@@ -59,6 +60,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <initializer_list>
@@ -1692,4 +1694,72 @@ namespace Opm { namespace RestartIO  {
         return rst_value;
     }
 
+    data::Solution
+    loadSolution(const std::string&             filename,
+                 int                            report_step,
+                 const std::vector<RestartKey>& solution_keys,
+                 const std::vector<int>&        active_cells,
+                 const UnitSystem&              units)
+    {
+        auto rst_file = EclIO::ERst { filename };
+
+        const auto elements = std::vector<std::int64_t> {
+            active_cells.begin(), active_cells.end()
+        };
+
+        // Array directory only.  Does not load the report step.
+        const auto arrays = rst_file.listOfRstArrays(report_step);
+
+        data::Solution sol(/* init_si = */ false);
+
+        for (const auto& value : solution_keys) {
+            const auto array = std::find_if(arrays.begin(), arrays.end(),
+                [&value](const auto& entry)
+            {
+                return (std::get<0>(entry) == value.key)
+                    && ((std::get<1>(entry) == EclIO::eclArrType::DOUB) ||
+                        (std::get<1>(entry) == EclIO::eclArrType::REAL));
+            });
+
+            if (array == arrays.end()) {
+                throwIfMissingRequired(value);
+                continue;
+            }
+
+            auto kwdata = std::vector<double>{};
+            if (std::get<1>(*array) == EclIO::eclArrType::DOUB) {
+                kwdata = rst_file.getRestartElements<double>(value.key, report_step, elements);
+            }
+            else {
+                const auto data = rst_file.getRestartElements<float>(value.key, report_step, elements);
+                kwdata.assign(data.begin(), data.end());
+            }
+
+            sol.insert(value.key, value.dim, std::move(kwdata),
+                       data::TargetType::RESTART_SOLUTION);
+        }
+
+        sol.convertToSI(units);
+
+        return sol;
+    }
+
+    data::Solution
+    loadSolution(const std::string&             filename,
+                 int                            report_step,
+                 const std::vector<RestartKey>& solution_keys,
+                 const Box&                     box,
+                 const UnitSystem&              units)
+    {
+        auto active_cells = std::vector<int>{};
+        active_cells.reserve(box.index_list().size());
+
+        for (const auto& cell : box.index_list()) {
+            active_cells.push_back(static_cast<int>(cell.active_index));
+        }
+
+        return loadSolution(filename, report_step, solution_keys,
+                            active_cells, units);
+    }
+
 }} // Opm::RestartIO
@@ -30,51 +30,94 @@ namespace Opm {
 namespace out {
 
 RegionCache::RegionCache(const std::set<std::string>& fip_regions, const FieldPropsManager& fp, const EclipseGrid& grid, const Schedule& schedule) {
+    if (fip_regions.empty())
+        return;
+
+    struct WellConnections {
+        std::string name;
+        std::size_t first_active_index;
+        std::vector<std::pair<std::size_t, std::size_t>> active_connections;  // (global, active) index
+    };
+
+    // Resolve the active cells of all well connections once, independently
+    // of the number of region sets.
+    std::vector<WellConnections> well_connections;
+    for (const auto& well : schedule.getWellsatEnd()) {
+        const auto& connections = well.getConnections( );
+        if (connections.empty())
+            continue;
+
+        auto& wc = well_connections.emplace_back();
+        wc.name = well.name();
+        for (const auto& c : connections) {
+            if (grid.cellActive(c.global_index()))
+                wc.active_connections.emplace_back(c.global_index(), grid.activeIndex(c.global_index()));
+        }
+        wc.first_active_index = grid.activeIndex(connections[0].global_index());
+    }
+
+    std::vector<const std::vector<int>*> fip_arrays;
     for (const auto& fip_name : fip_regions) {
-        const auto& fip_region = fp.get_int(fip_name);
-
-        const auto& wells = schedule.getWellsatEnd();
-        for (const auto& well : wells) {
-            const auto& connections = well.getConnections( );
-            if (connections.empty())
-                continue;
-
-            for (const auto& c : connections) {
-                if (grid.cellActive(c.global_index())) {
-                    size_t active_index = grid.activeIndex(c.global_index());
-                    int region_id = fip_region[active_index];
-                    auto key = std::make_pair(fip_name, region_id);
-                    auto& well_index_list = this->connection_map[ key ];
-                    well_index_list.emplace_back(well.name(), c.global_index());
-                }
+        this->region_sets.emplace(fip_name, fip_arrays.size());
+        fip_arrays.push_back(&fp.get_int(fip_name));
+    }
+
+    this->connection_map.resize(fip_arrays.size());
+    this->well_map.resize(fip_arrays.size());
+
+    // Region ids less than zero have no entries.
+#pragma omp parallel for schedule(dynamic)
+    for (std::size_t set = 0; set < fip_arrays.size(); set++) {
+        const auto& fip_region = *fip_arrays[set];
+        auto& connection_list = this->connection_map[set];
+        auto& well_list = this->well_map[set];
+
+        auto region_slot = [](auto& region_array, int region_id) {
+            const auto ix = static_cast<std::size_t>(region_id);
+            if (region_array.size() <= ix)
+                region_array.resize(ix + 1);
+
+            return &region_array[ix];
+        };
+
+        for (const auto& wc : well_connections) {
+            for (const auto& [global_index, active_index] : wc.active_connections) {
+                const int region_id = fip_region[active_index];
+                if (region_id >= 0)
+                    region_slot(connection_list, region_id)->emplace_back(wc.name, global_index);
             }
 
-            const auto& conn0 = connections[0];
-            auto region_id = fip_region[grid.activeIndex(conn0.global_index())];
-            auto key = std::make_pair(fip_name, region_id);
-            this->well_map[ key ].push_back(well.name());
+            const int region_id = fip_region[wc.first_active_index];
+            if (region_id >= 0)
+                region_slot(well_list, region_id)->push_back(wc.name);
         }
     }
 }
 
 
     const std::vector<std::pair<std::string,size_t>>& RegionCache::connections( const std::string& region_name, int region_id ) const {
-        auto key = std::make_pair(region_name, region_id);
-        const auto iter = this->connection_map.find( key );
-        if (iter == this->connection_map.end())
+        const auto set = this->region_sets.find(region_name);
+        if ((set == this->region_sets.end()) || (region_id < 0))
             return this->connections_empty;
-        else
-            return iter->second;
+
+        const auto& connection_list = this->connection_map[set->second];
+        if (static_cast<std::size_t>(region_id) >= connection_list.size())
+            return this->connections_empty;
+
+        return connection_list[region_id];
     }
 
 
     std::vector<std::string> RegionCache::wells(const std::string& region_name, int region_id) const {
-        auto key = std::make_pair(region_name, region_id);
-        const auto iter = this->well_map.find( key );
-        if (iter == this->well_map.end())
+        const auto set = this->region_sets.find(region_name);
+        if ((set == this->region_sets.end()) || (region_id < 0))
             return {};
-        else
-            return iter->second;
+
+        const auto& well_list = this->well_map[set->second];
+        if (static_cast<std::size_t>(region_id) >= well_list.size())
+            return {};
+
+        return well_list[region_id];
     }
 
 }
@@ -61,6 +61,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
@@ -101,10 +102,42 @@ namespace {
         return extra_solution.count(vector) > 0;
     }
 
-    double nextStepSize(const Opm::RestartValue& rst_value)
+    using ConvertBlock = std::function<void(double*, double*)>;
+
+    // In-place conversion from SI to output units of a range of values of
+    // dimension 'dim'.  Empty if the values need no conversion.
+    ConvertBlock convertFromSI(const Opm::UnitSystem&         units,
+                               const Opm::UnitSystem::measure dim)
+    {
+        if (dim == Opm::UnitSystem::measure::identity) {
+            return {};
+        }
+
+        return [&units, dim](double* begin, double* end)
+        {
+            std::transform(begin, end, begin,
+                           [&units, dim](const double x)
+                           { return units.from_si(dim, x); });
+        };
+    }
+
+    ConvertBlock convertFromSI(const Opm::UnitSystem&    units,
+                               const Opm::data::Solution& solution,
+                               const std::string&        vector)
+    {
+        return solution.isSI()
+            ? convertFromSI(units, solution.at(vector).dim)
+            : ConvertBlock{};
+    }
+
+    double nextStepSize(const Opm::RestartValue& rst_value,
+                        const Opm::UnitSystem&   units)
     {
-        return rst_value.hasExtra("OPMEXTRA")
-            ? rst_value.getExtra("OPMEXTRA")[0]
+        auto extra = std::find_if(rst_value.extra.begin(), rst_value.extra.end(),
+                                  [](const auto& elm) { return elm.first.key == "OPMEXTRA"; });
+
+        return (extra != rst_value.extra.end())
+            ? units.from_si(extra->first.dim, extra->second[0])
             : 0.0;
     }
 
@@ -561,16 +594,24 @@ namespace {
 
     std::vector<double>
     convertedHysteresisSat(const RestartValue& value,
+                           const UnitSystem&   units,
                            const std::string&  primary,
                            const std::string&  fallback)
     {
         auto smax = std::vector<double>{};
 
-        if (value.solution.has(primary)) {
-            smax = value.solution.data(primary);
-        }
-        else if (value.solution.has(fallback)) {
-            smax = value.solution.data(fallback);
+        for (const auto* vector : { &primary, &fallback }) {
+            if (value.solution.has(*vector)) {
+                smax = value.solution.data(*vector);
+
+                if (const auto convert = convertFromSI(units, value.solution, *vector);
+                    convert)
+                {
+                    convert(smax.data(), smax.data() + smax.size());
+                }
+
+                break;
+            }
         }
 
         if (! smax.empty()) {
@@ -613,63 +654,66 @@ namespace {
         return vectors;
     }
 
-    template <class OutputVector>
     void writeSolutionVectors(const RestartValue&             value,
+                              const UnitSystem&               units,
                               const std::vector<std::string>& vectors,
                               const bool                      write_double,
-                              OutputVector&&                  writeVector)
+                              EclIO::OutputStream::Restart&   rstFile)
     {
         for (const auto& vector : vectors) {
-            writeVector(vector, value.solution.data(vector), write_double);
+            rstFile.write(vector, value.solution.data(vector),
+                          convertFromSI(units, value.solution, vector),
+                          write_double);
         }
     }
 
-    template <class OutputVector>
-    void writeRegularSolutionVectors(const RestartValue& value,
-                                     const bool          write_double,
-                                     OutputVector&&      writeVector)
+    void writeRegularSolutionVectors(const RestartValue&           value,
+                                     const UnitSystem&             units,
+                                     const bool                    write_double,
+                                     EclIO::OutputStream::Restart& rstFile)
     {
-        writeSolutionVectors(value, solutionVectorNames(value), write_double,
-                             std::forward<OutputVector>(writeVector));
+        writeSolutionVectors(value, units, solutionVectorNames(value),
+                             write_double, rstFile);
     }
 
-    template <class OutputVector>
-    void writeExtendedSolutionVectors(const RestartValue& value,
-                                      const bool          write_double,
-                                      OutputVector&&      writeVector)
+    void writeExtendedSolutionVectors(const RestartValue&           value,
+                                      const UnitSystem&             units,
+                                      const bool                    write_double,
+                                      EclIO::OutputStream::Restart& rstFile)
     {
-        writeSolutionVectors(value, extendedSolutionVectorNames(value), write_double,
-                             std::forward<OutputVector>(writeVector));
+        writeSolutionVectors(value, units, extendedSolutionVectorNames(value),
+                             write_double, rstFile);
     }
 
-    template <class OutputVector>
-    void writeExtraVectors(const RestartValue& value,
-                           OutputVector&&      writeVector)
+    void writeExtraVectors(const RestartValue&           value,
+                           const UnitSystem&             units,
+                           EclIO::OutputStream::Restart& rstFile)
     {
         for (const auto& elm : value.extra) {
             const std::string& key = elm.first.key;
             if (extraInSolution(key)) {
                 // Observe that the extra data is unconditionally
                 // output as double precision.
-                writeVector(key, elm.second, true);
+                rstFile.write(key, elm.second,
+                              convertFromSI(units, elm.first.dim), true);
             }
         }
     }
 
-    template <class OutputVector>
-    void writeEclipseCompatHysteresis(const RestartValue& value,
-                                      const bool          write_double,
-                                      OutputVector&&      writeVector)
+    void writeEclipseCompatHysteresis(const RestartValue&           value,
+                                      const UnitSystem&             units,
+                                      const bool                    write_double,
+                                      EclIO::OutputStream::Restart& rstFile)
     {
         // Convert Flow-specific vectors {KRNSW,PCSWM}_OW to ECLIPSE's
         // requisite SOMAX vector.  Only partially characterised.
         // Sufficient for Norne.
         {
             const auto somax =
-                convertedHysteresisSat(value, "KRNSW_OW", "PCSWM_OW");
+                convertedHysteresisSat(value, units, "KRNSW_OW", "PCSWM_OW");
 
             if (! somax.empty()) {
-                writeVector("SOMAX", somax, write_double);
+                rstFile.write("SOMAX", somax, ConvertBlock{}, write_double);
             }
         }
 
@@ -678,10 +722,10 @@ namespace {
         // Sufficient for Norne.
         {
             const auto sgmax =
-                convertedHysteresisSat(value, "KRNSW_GO", "PCSWM_GO");
+                convertedHysteresisSat(value, units, "KRNSW_GO", "PCSWM_GO");
 
             if (! sgmax.empty()) {
-                writeVector("SGMAX", sgmax, write_double);
+                rstFile.write("SGMAX", sgmax, ConvertBlock{}, write_double);
             }
         }
     }
@@ -708,15 +752,9 @@ namespace {
             ztracer.push_back(fmt::format("{}/{}", tracer.unit_string, unit_system.name( UnitSystem::measure::volume )));
             rstFile.write("ZTRACER", ztracer);
 
-            const auto& data = vector.data;
-            if (write_double) {
-                rstFile.write(tracer_rst_name, data);
-            }
-            else {
-                rstFile.write(tracer_rst_name, std::vector<float> {
-                        data.begin(), data.end()
-                    });
-            }
+            rstFile.write(tracer_rst_name, vector.data,
+                          convertFromSI(unit_system, value.solution, tracer_rst_name),
+                          write_double);
         }
     }
 
@@ -729,50 +767,41 @@ namespace {
                        const bool                    ecl_compatible_rst,
                        const bool                    write_double_arg,
                        const std::vector<int>&       inteHD,
+                       const UnitSystem&             units,
                        EclIO::OutputStream::Restart& rstFile)
     {
-        auto write = [&rstFile]
-            (const std::string&         key,
-             const std::vector<double>& data,
-             const bool                 write_double) -> void
-        {
-            if (write_double) {
-                rstFile.write(key, data);
-            }
-            else {
-                rstFile.write(key, std::vector<float> {
-                    data.begin(), data.end()
-                });
-            }
-        };
+        // Solution vectors are converted to output units one output block
+        // at a time while writing.
 
         rstFile.message("STARTSOL");
 
-        writeRegularSolutionVectors(value, write_double_arg, write);
+        writeRegularSolutionVectors(value, units, write_double_arg, rstFile);
         writeTracerVectors(schedule.getUnits(), tracer_config, value, write_double_arg, rstFile);
         writeUDQ(report_step, sim_step, schedule, udq_state, inteHD, rstFile);
 
-        writeExtraVectors(value, write);
+        writeExtraVectors(value, units, rstFile);
 
         if (ecl_compatible_rst && haveHysteresis(value)) {
-            writeEclipseCompatHysteresis(value, write_double_arg, write);
+            writeEclipseCompatHysteresis(value, units, write_double_arg, rstFile);
         }
 
         if (! ecl_compatible_rst) {
-            writeExtendedSolutionVectors(value, write_double_arg, write);
+            writeExtendedSolutionVectors(value, units, write_double_arg, rstFile);
         }
 
         rstFile.message("ENDSOL");
     }
 
     void writeExtraData(const RestartValue::ExtraVector& extra_data,
+                        const UnitSystem&                units,
                         EclIO::OutputStream::Restart&    rstFile)
     {
         for (const auto& extra_value : extra_data) {
             const std::string& key = extra_value.first.key;
 
             if (! extraInSolution(key)) {
-                rstFile.write(key, extra_value.second);
+                rstFile.write(key, extra_value.second,
+                              convertFromSI(units, extra_value.first.dim), true);
             }
         }
     }
@@ -810,7 +839,7 @@ namespace {
 void save(EclIO::OutputStream::Restart&                 rstFile,
           int                                           report_step,
           double                                        seconds_elapsed,
-          RestartValue                                  value,
+          const RestartValue&                           value,
           const EclipseState&                           es,
           const EclipseGrid&                            grid,
           const Schedule&                               schedule,
@@ -833,11 +862,10 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
         write_double = false;
     }
 
-    // Convert solution fields and extra values from SI to user units.
-    value.convertFromSI(units);
-
+    // Solution fields and extra values are converted from SI to user
+    // units while writing, so no converted copy of 'value' is needed.
     const auto inteHD =
-        writeHeader(report_step, sim_step, nextStepSize(value),
+        writeHeader(report_step, sim_step, nextStepSize(value, units),
                     seconds_elapsed, schedule, grid, es, rstFile);
 
     if (report_step > 0) {
@@ -849,10 +877,10 @@ void save(EclIO::OutputStream::Restart&                 rstFile,
     writeActionx(report_step, sim_step, schedule, action_state, sumState, rstFile);
 
     writeSolution(value, schedule, udqState, es.tracer(), report_step, sim_step,
-                  ecl_compatible_rst, write_double, inteHD, rstFile);
+                  ecl_compatible_rst, write_double, inteHD, units, rstFile);
 
     if (! ecl_compatible_rst) {
-        writeExtraData(value.extra, rstFile);
+        writeExtraData(value.extra, units, rstFile);
     }
 
     logRestartOutput(report_step, schedule.size() - 1, inteHD);
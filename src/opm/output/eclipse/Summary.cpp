@@ -2800,31 +2800,28 @@ bool need_wells(const Opm::EclIO::SummaryNode& node)
     };
 }
 
-void updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::SummaryState& st)
+// Returns the value stored in 'st', i.e., the accumulated value for
+// totals.
+double updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::SummaryState& st)
 {
     using Cat = Opm::EclIO::SummaryNode::Category;
 
     switch (node.category) {
     case Cat::Well:
-        st.update_well_var(node.wgname, node.keyword, value);
-        break;
+        return st.update_well_var(node.wgname, node.keyword, value);
 
     case Cat::Group:
     case Cat::Node:
-        st.update_group_var(node.wgname, node.keyword, value);
-        break;
+        return st.update_group_var(node.wgname, node.keyword, value);
 
     case Cat::Connection:
-        st.update_conn_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.update_conn_var(node.wgname, node.keyword, node.number, value);
 
     case Cat::Segment:
-        st.update_segment_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.update_segment_var(node.wgname, node.keyword, node.number, value);
 
     default:
-        st.update(node.unique_key(), value);
-        break;
+        return st.update(node.unique_key(), value);
     }
 }
 
@@ -2920,6 +2917,68 @@ namespace Evaluator {
         const std::unordered_map<std::string, Opm::data::InterRegFlowMap>& ireg;
     };
 
+    /// Slot of a single summary output parameter in the evaluation plan.
+    struct Slot
+    {
+        /// Most recently evaluated value, in output units.
+        double value{0.0};
+
+        /// Whether or not 'value' has been assigned by an evaluator.
+        bool valid{false};
+    };
+
+    /// Destination of evaluated summary values.
+    ///
+    /// Each value is published to the SummaryState exactly once, for use
+    /// by the UDQ and ACTIONX machinery and by later evaluators, and the
+    /// resulting value--i.e., the accumulated total for cumulatives--is
+    /// recorded in the parameter's slot of the evaluation plan if the
+    /// parameter is output to the summary file.
+    class Output
+    {
+    public:
+        explicit Output(Opm::SummaryState& st, Slot* slot = nullptr)
+            : st_  (st)
+            , slot_(slot)
+        {}
+
+        const Opm::SummaryState& state() const
+        {
+            return this->st_;
+        }
+
+        void store(const Opm::EclIO::SummaryNode& node, const double value)
+        {
+            this->assignSlot(updateValue(node, value, this->st_));
+        }
+
+        void store(const std::string& key, const double value)
+        {
+            this->assignSlot(this->st_.update(key, value));
+        }
+
+        /// Store value which is not the parameter's own output value,
+        /// e.g., an alias.  Updates the SummaryState only.
+        void storeState(const std::string& key, const double value)
+        {
+            this->st_.update(key, value);
+        }
+
+    private:
+        Opm::SummaryState& st_;
+        Slot* slot_{nullptr};
+
+        void assignSlot(const double value)
+        {
+            if (this->slot_ == nullptr) {
+                return;
+            }
+
+            this->slot_->value = value;
+            this->slot_->valid = true;
+        }
+    };
+
     class Base
     {
     public:
@@ -2929,7 +2988,7 @@ namespace Evaluator {
                             const double            stepSize,
                             const InputData&        input,
                             const SimulatorResults& simRes,
-                            Opm::SummaryState&      st) const = 0;
+                            Output&                 out) const = 0;
     };
 
     class FunctionRelation : public Base
@@ -2948,7 +3007,7 @@ namespace Evaluator {
                     const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             const auto wells = need_wells(this->node_)
                 ? find_wells(input.sched, this->node_,
@@ -2962,7 +3021,7 @@ namespace Evaluator {
                 wells, this->group_name(), this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
                 this->number_, this->node_.fip_region,
-                st,
+                out.state(),
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
                 std::move(efac.factors),
@@ -2973,7 +3032,7 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            out.store(this->node_, usys.from_si(prm.unit, prm.value));
         }
 
     private:
@@ -3019,7 +3078,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
@@ -3027,7 +3086,7 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            out.store(this->node_, usys.from_si(this->m_, xPos->second));
         }
 
     private:
@@ -3053,7 +3112,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
@@ -3061,7 +3120,7 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            out.store(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)));
         }
     private:
         Opm::EclIO::SummaryNode  node_;
@@ -3081,7 +3140,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             if (this->node_.number < 0)
                 return;
@@ -3097,7 +3156,7 @@ namespace Evaluator {
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            out.store(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3128,7 +3187,7 @@ namespace Evaluator {
                     const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             if (this->component_ == Component::NumComponents) {
                 return;
@@ -3147,7 +3206,7 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            out.store(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3316,7 +3375,7 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    Output&                 out) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword);
             if (xPos == simRes.single.end())
@@ -3325,7 +3384,7 @@ namespace Evaluator {
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            out.store(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3340,7 +3399,7 @@ namespace Evaluator {
                     const double            /* stepSize */,
                     const InputData&        /* input */,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&      /* st */) const override
+                    Output&                 /* out */) const override
         {
             // No-op
         }
@@ -3357,15 +3416,15 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
             const auto& usys = input.es.getUnits();
 
             const auto m   = ::Opm::UnitSystem::measure::time;
-            const auto val = st.get_elapsed() + stepSize;
+            const auto val = out.state().get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, usys.from_si(m, val));
-            st.update("TIME", usys.from_si(m, val));
+            out.store(this->saveKey_, usys.from_si(m, val));
+            out.storeState("TIME", usys.from_si(m, val));
         }
 
     private:
@@ -3383,10 +3442,10 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.day());
+            auto sim_time = make_sim_time(input.sched, out.state(), stepSize);
+            out.store(this->saveKey_, sim_time.day());
         }
 
     private:
@@ -3404,10 +3463,10 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.month());
+            auto sim_time = make_sim_time(input.sched, out.state(), stepSize);
+            out.store(this->saveKey_, sim_time.month());
         }
 
     private:
@@ -3425,10 +3484,10 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
-            auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.year());
+            auto sim_time = make_sim_time(input.sched, out.state(), stepSize);
+            out.store(this->saveKey_, sim_time.year());
         }
 
     private:
@@ -3446,13 +3505,13 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&        /* input */,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    Output&                    out) const override
         {
             using namespace ::Opm::unit;
 
-            const auto val = st.get_elapsed() + stepSize;
+            const auto val = out.state().get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, convert::to(val, ecl_year));
+            out.store(this->saveKey_, convert::to(val, ecl_year));
         }
 
     private:
@@ -4101,6 +4160,16 @@ private:
     std::vector<std::string> valueUnits_{};
     std::vector<MiniStep>    unwritten_{};
 
+    /// Evaluation plan.  One slot for each summary output parameter,
+    /// indexed like valueKeys_ and the output parameter evaluators.
+    mutable std::vector<Evaluator::Slot> slots_{};
+
+    /// SummaryState, and its elapsed time, into which slots_ were most
+    /// recently published.  The slots are only used when storing values
+    /// from that same state at that same time.
+    mutable const SummaryState* evaluatedState_{nullptr};
+    mutable double evaluatedElapsed_{0.0};
+
     std::unique_ptr<Opm::EclIO::OutputStream::SummarySpecification> smspec_{};
     std::unique_ptr<Opm::EclIO::EclOutput> stream_{};
 
@@ -4119,6 +4188,8 @@ private:
 
     void configureUDQ(const EclipseState& es, const SummaryConfig& summary_config, const Schedule& sched);
 
+    void compileEvaluationPlan();
+
     MiniStep& getNextMiniStep(const int report_step, bool isSubstep);
     const MiniStep& lastUnwritten() const;
 
@@ -4157,6 +4228,7 @@ SummaryImplementation(const EclipseState&  es,
     this->configureRequiredRestartParameters(sumcfg, es.aquifer(),
                                              sched, evaluatorFactory);
     this->configureUDQ(es, sumcfg, sched);
+    this->compileEvaluationPlan();
 
     std::string esmryFileName = EclIO::OutputStream::outputFileName(this->rset_, "ESMRY");
 
@@ -4164,7 +4236,8 @@ SummaryImplementation(const EclipseState&  es,
         std::filesystem::remove(esmryFileName);
 
     if ((writeEsmry) and (es.cfg().io().getFMTOUT()==false))
-        this->esmry_ = std::make_unique<Opm::EclIO::ExtSmryOutput>(this->valueKeys_, this->valueUnits_, es, sched.posixStartTime());
+        this->esmry_ = std::make_unique<Opm::EclIO::ExtSmryOutput>(this->valueKeys_, this->valueUnits_, es, sched.posixStartTime(),
+                                                                   es.cfg().io().getEsmryLayout());
 
     if ((writeEsmry) and (es.cfg().io().getFMTOUT()))
         OpmLog::warning("ESMRY only supported for unformatted output.  Request ignored.");
@@ -4177,7 +4250,18 @@ internal_store(const SummaryState& st, const int report_step, bool isSubstep)
 
     const auto nParam = this->valueKeys_.size();
 
+    const auto useSlots = (&st == this->evaluatedState_)
+        && (st.get_elapsed() == this->evaluatedElapsed_);
+
     for (auto i = decltype(nParam){0}; i < nParam; ++i) {
+        if (const auto& slot = this->slots_[i]; useSlots && slot.valid) {
+            ms.params[i] = slot.value;
+            continue;
+        }
+
+        // Parameter not assigned by its evaluator in the most recent call
+        // to eval() for this state, e.g., a UDQ or a value restored from a
+        // restart file.  Fall back to the SummaryState.
         if (! st.has(this->valueKeys_[i]))
             // Parameter not yet evaluated (e.g., well/group not
             // yet active).  Nothing to do here.
@@ -4218,17 +4302,25 @@ eval(const int                              sim_step,
         region_values, block_values, aquifer_values, interreg_flows
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    const auto& evaluators = this->outputParameters_.getEvaluators();
+    for (auto i = 0*evaluators.size(); i < evaluators.size(); ++i) {
+        this->slots_[i].valid = false;
+
+        auto out = Evaluator::Output { st, &this->slots_[i] };
+        evaluators[i]->update(sim_step, duration, input, simRes, out);
     }
 
+    auto out = Evaluator::Output { st };
     for (auto& [_, evalPtr] : this->extra_parameters) {
         (void)_;
-        evalPtr->update(sim_step, duration, input, simRes, st);
+        evalPtr->update(sim_step, duration, input, simRes, out);
     }
 
     st.update_elapsed(duration);
 
+    this->evaluatedState_ = &st;
+    this->evaluatedElapsed_ = st.get_elapsed();
+
     if (secs_elapsed > this->prevEvalTime_) {
         this->prevEvalTime_ = secs_elapsed;
         ++this->miniStepID_;
@@ -4600,6 +4692,20 @@ configureRequiredRestartParameters(const SummaryConfig& sumcfg,
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::compileEvaluationPlan()
+{
+    const auto& evaluators = this->outputParameters_.getEvaluators();
+
+    assert ((evaluators.size() == this->valueKeys_.size()) &&
+            "Internal inconsistency in summary evaluators");
+
+    // Parameters with no evaluation function are always read from the
+    // SummaryState so their slots are never assigned.
+    this->slots_.assign(evaluators.size(), Evaluator::Slot{});
+    this->evaluatedState_ = nullptr;
+}
+
 Opm::out::Summary::SummaryImplementation::MiniStep&
 Opm::out::Summary::SummaryImplementation::getNextMiniStep(const int report_step, bool isSubstep)
 {
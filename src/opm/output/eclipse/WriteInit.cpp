@@ -350,14 +350,23 @@ namespace {
         auto dz    = std::vector<float>{};  dz   .reserve(nAct);
         auto depth = std::vector<float>{};  depth.reserve(nAct);
 
+        // Compute the geometry of all active cells in a single pass, but
+        // don't keep it around unless someone else asked for it.
+        const auto  wasCached = grid.activeGeometry() != nullptr;
+        const auto& geometry  = grid.precomputeGeometry();
+
         for (auto cell = 0*nAct; cell < nAct; ++cell) {
-            const auto  globCell = grid.getGlobalIndex(cell);
-            const auto& dims     = grid.getCellDims(globCell);
+            dx   .push_back(units.from_si(length, geometry.dims[0][cell]));
+            dy   .push_back(units.from_si(length, geometry.dims[1][cell]));
+            dz   .push_back(units.from_si(length, geometry.dims[2][cell]));
+
+            // getCellDepth() reads the cached geometry, but also applies
+            // depth overrides of numerical aquifer cells.
+            depth.push_back(units.from_si(length, grid.getCellDepth(grid.getGlobalIndex(cell))));
+        }
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+        if (! wasCached) {
+            grid.releaseGeometry();
         }
 
         initFile.write("DEPTH", depth);
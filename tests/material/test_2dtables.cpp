@@ -35,10 +35,13 @@
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/IntervalTabulated2DFunction.hpp>
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/densead/Evaluation.hpp>
 
 #include <memory>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 template <class ScalarT>
 struct Test
@@ -404,3 +407,79 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction3, Scalar, Types)
     test.compareTableWithAnalyticFn2(xytab, xMin, xMax, m,
                                      yMin, yMax, n, test.testFn3, tolerance);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UniformXTabulatedFunctionBatch, Scalar, Types)
+{
+    Test<Scalar> test;
+    using Table = Opm::UniformXTabulated2DFunction<Scalar>;
+    const std::vector<Table> tables {
+        test.createUniformXTabulatedFunction2(test.testFn3),
+        test.createUniformXTabulatedFunction(test.testFn1),
+    };
+
+    // Sweep of positions which partly moves along the table and partly jumps,
+    // spread over runs of both regions.
+    const unsigned n = 300;
+    std::vector<Scalar> x(n), y(n), values(n);
+    std::vector<unsigned> region(n);
+    for (unsigned k = 0; k < n; ++k) {
+        x[k] = -2.0 + 5.0*std::fmod(Scalar(k*7)/n, Scalar(1.0));
+        y[k] = -0.5 + (1/3.0 + 0.5)*Scalar(k % 37)/36;
+        region[k] = (k / 50) % 2;
+    }
+
+    Table::evalBatch(tables, n, region.data(), x.data(), y.data(), values.data());
+    for (unsigned k = 0; k < n; ++k)
+        BOOST_CHECK_EQUAL(values[k], tables[region[k]].eval(x[k], y[k]));
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 2>;
+    std::vector<Eval> xEval(n), yEval(n), evalValues(n);
+    for (unsigned k = 0; k < n; ++k) {
+        xEval[k] = Eval::createVariable(x[k], 0);
+        yEval[k] = Eval::createVariable(y[k], 1);
+    }
+
+    tables[0].evalBatch(n, xEval.data(), yEval.data(), evalValues.data());
+    for (unsigned k = 0; k < n; ++k)
+        BOOST_CHECK(evalValues[k] == tables[0].eval(xEval[k], yEval[k]));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Tabulated1DFunctionBatch, Scalar, Types)
+{
+    std::vector<Scalar> xs, ys;
+    for (unsigned i = 0; i < 20; ++i) {
+        xs.push_back(i*i/Scalar(10.0));
+        ys.push_back(std::sin(xs.back()));
+    }
+
+    using Table = Opm::Tabulated1DFunction<Scalar>;
+    const std::vector<Table> tables { Table(xs.size(), xs, ys), Table(xs.size(), ys, xs) };
+
+    // Increasing, decreasing and out of range positions.
+    const unsigned n = 200;
+    std::vector<Scalar> x(n);
+    for (unsigned k = 0; k < n; ++k)
+        x[k] = (k < 120) ? -1 + Scalar(k)*0.35 : Scalar(200 - k)*0.4;
+
+    std::vector<Scalar> values(n), derivatives(n);
+    tables[0].evalBatch(n, x.data(), values.data(), derivatives.data(), /*extrapolate=*/true);
+    for (unsigned k = 0; k < n; ++k) {
+        BOOST_CHECK_EQUAL(values[k], tables[0].eval(x[k], /*extrapolate=*/true));
+        BOOST_CHECK_EQUAL(derivatives[k], tables[0].evalDerivative(x[k], /*extrapolate=*/true));
+    }
+
+    BOOST_CHECK_THROW(tables[0].evalBatch(n, x.data(), values.data()), std::logic_error);
+
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+    std::vector<unsigned> region(n);
+    std::vector<Eval> xEval(n), evalValues(n);
+    for (unsigned k = 0; k < n; ++k) {
+        region[k] = k % 3 == 0;
+        xEval[k] = Eval::createVariable(x[k], 0);
+    }
+
+    Table::evalBatch(tables, n, region.data(), xEval.data(), evalValues.data(),
+                     nullptr, /*extrapolate=*/true);
+    for (unsigned k = 0; k < n; ++k)
+        BOOST_CHECK(evalValues[k] == tables[region[k]].eval(xEval[k], /*extrapolate=*/true));
+}
@@ -41,6 +41,7 @@
 #include <opm/material/densead/Evaluation.hpp>
 
 #include <opm/material/common/Valgrind.hpp>
+#include <opm/material/Constants.hpp>
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -724,3 +725,91 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(BlackOil, Evaluation, Types)
     [[maybe_unused]] const auto& oPvt = FluidSystem::oilPvt();
     [[maybe_unused]] const auto& wPvt = FluidSystem::waterPvt();
 }
+
+BOOST_AUTO_TEST_CASE(NonStaticInstance)
+{
+    using FluidSystem = Opm::BlackOilFluidSystem<double>;
+    using NonStatic = FluidSystem::NonStatic;
+
+    static constexpr int numPhases = FluidSystem::numPhases;
+    static constexpr int gasPhaseIdx = FluidSystem::gasPhaseIdx;
+    static constexpr int oilPhaseIdx = FluidSystem::oilPhaseIdx;
+
+    Opm::Parser parser;
+
+    auto deck = parser.parseString(deckString1);
+    auto python = std::make_shared<Opm::Python>();
+    Opm::EclipseState eclState(deck);
+    Opm::Schedule schedule(deck, eclState, python);
+
+    FluidSystem::initFromState(eclState, schedule);
+
+    NonStatic fs;
+    BOOST_CHECK(!fs.isInitialized());
+    fs.initFromState(eclState, schedule);
+    BOOST_CHECK(fs.isInitialized());
+    BOOST_CHECK_EQUAL(fs.numRegions(), 2);
+    BOOST_CHECK_EQUAL(fs.numActivePhases(), 3);
+
+    // copies share the PVT tables but not the remaining state
+    NonStatic copy = fs;
+    BOOST_CHECK_EQUAL(&copy.gasPvt(), &fs.gasPvt());
+    BOOST_CHECK_EQUAL(&copy.oilPvt(), &fs.oilPvt());
+    BOOST_CHECK_EQUAL(&copy.waterPvt(), &fs.waterPvt());
+
+    copy.setReferenceDensities(800.0, 1000.0, 1.0, /*regionIdx=*/1);
+    BOOST_CHECK_CLOSE(copy.referenceDensity(oilPhaseIdx, /*regionIdx=*/1), 800.0, 1e-10);
+    BOOST_CHECK_CLOSE(fs.referenceDensity(oilPhaseIdx, /*regionIdx=*/1), 860.04, 1e-10);
+    BOOST_CHECK_CLOSE(FluidSystem::referenceDensity(oilPhaseIdx, /*regionIdx=*/1), 860.04, 1e-10);
+
+    copy.setVapPars(0.5, 0.5);
+    BOOST_CHECK_NE(&copy.oilPvt(), &fs.oilPvt());
+
+    // the static fluid system and an identically initialized instance agree
+    Opm::BlackOilFluidState<double, FluidSystem> fluidState;
+    Opm::Valgrind::SetUndefined(fluidState);
+
+    const unsigned regionIdx = 1;
+    for (unsigned i = 0; i < 100; ++i) {
+        const double p = double(i)/100*350e5 + 100e5;
+
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            fluidState.setPressure(phaseIdx, p);
+            fluidState.setSaturation(phaseIdx, 1e-3);
+        }
+
+        fluidState.setRs(fs.saturatedDissolutionFactor(fluidState, oilPhaseIdx, regionIdx));
+        fluidState.setRv(fs.saturatedDissolutionFactor(fluidState, gasPhaseIdx, regionIdx));
+
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            BOOST_CHECK_EQUAL(fs.density(fluidState, phaseIdx, regionIdx),
+                              FluidSystem::density(fluidState, phaseIdx, regionIdx));
+            BOOST_CHECK_EQUAL(fs.viscosity(fluidState, phaseIdx, regionIdx),
+                              FluidSystem::viscosity(fluidState, phaseIdx, regionIdx));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(StaticSurfaceConditions)
+{
+    using FluidSystem = Opm::BlackOilFluidSystem<double>;
+
+    static_assert(std::is_same_v<decltype(FluidSystem::surfacePressure), double>);
+    static_assert(std::is_same_v<decltype(FluidSystem::surfaceTemperature), double>);
+
+    FluidSystem::initBegin(/*numPvtRegions=*/1);
+    BOOST_CHECK_EQUAL(FluidSystem::surfacePressure, FluidSystem::defaultInstance().surfacePressure);
+    BOOST_CHECK_EQUAL(FluidSystem::surfaceTemperature, FluidSystem::defaultInstance().surfaceTemperature);
+
+    // assigning the static surface conditions is honoured by initEnd()
+    FluidSystem::surfacePressure = 2.0e5;
+    FluidSystem::setReferenceDensities(800.0, 1000.0, 1.0, /*regionIdx=*/0);
+    FluidSystem::initEnd();
+
+    BOOST_CHECK_EQUAL(FluidSystem::defaultInstance().surfacePressure, 2.0e5);
+    BOOST_CHECK_EQUAL(FluidSystem::numActivePhases(), 3u);
+
+    const double T = FluidSystem::surfaceTemperature;
+    BOOST_CHECK_CLOSE(FluidSystem::molarMass(FluidSystem::gasCompIdx),
+                      Opm::Constants<double>::R*T*1.0/2.0e5, 1e-10);
+}
@@ -422,3 +422,74 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ApiConformance, Scalar, Types)
         testTwoPhaseSatApi<MaterialLaw, TwoPhaseFluidState>();
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EclHysteresisParamsDefaultConfig, Scalar, Types)
+{
+    using TwoPhaseTraits = Opm::TwoPhaseMaterialTraits<Scalar, 0, 1>;
+    using RawMaterialLaw = Opm::BrooksCorey<TwoPhaseTraits>;
+    using MaterialLaw = Opm::EclHysteresisTwoPhaseLaw<RawMaterialLaw>;
+    using RawParams = typename RawMaterialLaw::Params;
+    using Params = typename MaterialLaw::Params;
+
+    RawParams drainage;
+    drainage.setEntryPressure(1.0e4);
+    drainage.setLambda(2.0);
+    drainage.finalize();
+
+    RawParams imbibition;
+    imbibition.setEntryPressure(5.0e3);
+    imbibition.setLambda(3.0);
+    imbibition.finalize();
+
+    // setConfig() is never called: hysteresis is disabled by default
+    const auto info = Opm::EclEpsScalingPointsInfo<Scalar>{};
+    Params params;
+    BOOST_CHECK(!params.config().enableHysteresis());
+    params.setDrainageParams(drainage, info, Opm::EclTwoPhaseSystemType::OilWater);
+    params.setImbibitionParams(imbibition, info, Opm::EclTwoPhaseSystemType::OilWater);
+    params.finalize();
+
+    // without hysteresis the drainage curve is used unchanged
+    for (int i = 0; i <= 10; ++i) {
+        const Scalar Sw = 0.1*i;
+        BOOST_CHECK_EQUAL(MaterialLaw::twoPhaseSatPcnw(params, Sw), RawMaterialLaw::twoPhaseSatPcnw(drainage, Sw));
+        BOOST_CHECK_EQUAL(MaterialLaw::twoPhaseSatKrw(params, Sw), RawMaterialLaw::twoPhaseSatKrw(drainage, Sw));
+        BOOST_CHECK_EQUAL(MaterialLaw::twoPhaseSatKrn(params, Sw), RawMaterialLaw::twoPhaseSatKrn(drainage, Sw));
+    }
+
+    // copies own their imbibition parameters
+    Params copy(params);
+    copy.imbibitionParams().setLambda(4.0);
+    BOOST_CHECK_EQUAL(params.imbibitionParams().lambda(), Scalar{3.0});
+    BOOST_CHECK_EQUAL(copy.imbibitionParams().lambda(), Scalar{4.0});
+    BOOST_CHECK(!copy.config().enableHysteresis());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EclHysteresisParamsNoImbibition, Scalar, Types)
+{
+    using TwoPhaseTraits = Opm::TwoPhaseMaterialTraits<Scalar, 0, 1>;
+    using RawMaterialLaw = Opm::BrooksCorey<TwoPhaseTraits>;
+    using MaterialLaw = Opm::EclHysteresisTwoPhaseLaw<RawMaterialLaw>;
+    using RawParams = typename RawMaterialLaw::Params;
+    using Params = typename MaterialLaw::Params;
+
+    RawParams drainage;
+    drainage.setEntryPressure(1.0e4);
+    drainage.setLambda(2.0);
+    drainage.finalize();
+
+    // setImbibitionParams() is never called: imbibition falls back to drainage
+    const auto info = Opm::EclEpsScalingPointsInfo<Scalar>{};
+    Params params;
+    params.setDrainageParams(drainage, info, Opm::EclTwoPhaseSystemType::OilWater);
+    params.finalize();
+
+    const auto& constParams = params;
+    BOOST_CHECK_EQUAL(&constParams.imbibitionParams(), &constParams.drainageParams());
+    BOOST_CHECK_EQUAL(constParams.imbibitionParams().lambda(), Scalar{2.0});
+
+    // mutable access allocates separate imbibition parameters
+    params.imbibitionParams().setLambda(3.0);
+    BOOST_CHECK_EQUAL(params.imbibitionParams().lambda(), Scalar{3.0});
+    BOOST_CHECK_EQUAL(params.drainageParams().lambda(), Scalar{2.0});
+}
@@ -39,6 +39,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp>
 
 #include <opm/material/densead/Evaluation.hpp>
 #include <opm/material/densead/Math.hpp>
@@ -281,3 +282,50 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Water, Scalar, Types) {
     ensurePvtApiGas<Scalar>(h2Pvt);
     ensurePvtApiBrine<Eval>(brinePvt);
 }
+
+BOOST_AUTO_TEST_CASE(Tabulation)
+{
+    using BrinePvt = Opm::BrineH2Pvt<double>;
+
+    const BrinePvt analytic(/*salinity=*/{0.1});
+    BrinePvt tabulated = analytic;
+    BOOST_CHECK(!tabulated.isTabulated());
+
+    const auto error = tabulated.tabulate(/*minT=*/300.0, /*maxT=*/400.0, /*numT=*/51,
+                                          /*minP=*/1.0e6, /*maxP=*/4.0e7, /*numP=*/101);
+    BOOST_CHECK(tabulated.isTabulated());
+    BOOST_CHECK_SMALL(error.rsSat, 1e-2);
+    BOOST_CHECK_SMALL(error.density, 1e-4);
+    BOOST_CHECK_SMALL(error.enthalpy, 1e-3);
+
+    using Eval = Opm::DenseAd::Evaluation<double, 1>;
+    for (const double T : {305.0, 342.5, 399.0}) {
+        for (const double p : {2.0e6, 1.5e7, 3.9e7}) {
+            const Eval temperature(T);
+            const Eval pressure(p, 0);
+
+            const Eval rsA = analytic.saturatedGasDissolutionFactor(0, temperature, pressure);
+            const Eval rsT = tabulated.saturatedGasDissolutionFactor(0, temperature, pressure);
+            BOOST_CHECK_CLOSE(rsT.value(), rsA.value(), 1.0);
+            BOOST_CHECK_CLOSE(rsT.derivative(0), rsA.derivative(0), 10.0);
+
+            const Eval bA = analytic.inverseFormationVolumeFactor(0, temperature, pressure, rsA);
+            const Eval bT = tabulated.inverseFormationVolumeFactor(0, temperature, pressure, rsA);
+            BOOST_CHECK_CLOSE(bT.value(), bA.value(), 1e-2);
+
+            const Eval uA = analytic.internalEnergy(0, temperature, pressure, rsA);
+            const Eval uT = tabulated.internalEnergy(0, temperature, pressure, rsA);
+            BOOST_CHECK_CLOSE(uT.value(), uA.value(), 0.1);
+        }
+    }
+
+    // outside of the tabulated range the analytic expressions are used
+    BOOST_CHECK_EQUAL(tabulated.saturatedGasDissolutionFactor(0, 450.0, 1.0e7),
+                      analytic.saturatedGasDissolutionFactor(0, 450.0, 1.0e7));
+
+    // changing the PVT parameters discards the tables
+    tabulated.setReferenceDensities(0, analytic.oilReferenceDensity(0), analytic.gasReferenceDensity(0), 0.0);
+    BOOST_CHECK(!tabulated.isTabulated());
+
+    BOOST_CHECK_THROW(tabulated.tabulate(400.0, 300.0, 10, 1.0e6, 4.0e7, 10), std::invalid_argument);
+}
@@ -797,6 +797,71 @@ BOOST_AUTO_TEST_CASE(TestFieldAND) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestRepeatedEval) {
+    Action::AST ast({"FOPR", ">", "100", "AND", "WWCT", "OP*", ">", "0.5", "OR", "MNTH", ">", "JUN"});
+    SummaryState st(TimeService::now());
+    WListManager wlm;
+    Action::Context context(st, wlm);
+    context.add("MNTH", 1);
+
+    st.update("FOPR", 50);
+    st.update_well_var("OP1", "WWCT", 0.75);
+    st.update_well_var("OP2", "WWCT", 0.25);
+    st.update_well_var("INJ", "WWCT", 0.75);
+
+    BOOST_CHECK(!ast.eval(context));
+    BOOST_CHECK(!ast.eval(context));
+
+    st.update("FOPR", 150);
+    {
+        const auto res = ast.eval(context);
+        BOOST_CHECK(res);
+        BOOST_CHECK_EQUAL(res.wells().size(), 1U);
+        BOOST_CHECK(res.has_well("OP1"));
+    }
+
+    // Unchanged inputs give an identical result.
+    BOOST_CHECK(ast.eval(context) == ast.eval(context));
+
+    st.update_well_var("OP2", "WWCT", 0.90);
+    {
+        const auto res = ast.eval(context);
+        BOOST_CHECK_EQUAL(res.wells().size(), 2U);
+        BOOST_CHECK(res.has_well("OP2"));
+    }
+
+    // New well matching the pattern.
+    st.update_well_var("OP3", "WWCT", 0.60);
+    {
+        const auto res = ast.eval(context);
+        BOOST_CHECK_EQUAL(res.wells().size(), 3U);
+        BOOST_CHECK(res.has_well("OP3"));
+    }
+
+    st.update_well_var("OP1", "WWCT", 0.10);
+    st.update_well_var("OP2", "WWCT", 0.10);
+    st.update_well_var("OP3", "WWCT", 0.10);
+    BOOST_CHECK(!ast.eval(context));
+
+    context.add("MNTH", 7);
+    BOOST_CHECK(ast.eval(context));
+
+    // Copies share evaluation state, but evaluate against their own context.
+    const auto copy = ast;
+    SummaryState st2(TimeService::now());
+    Action::Context context2(st2, wlm);
+    context2.add("MNTH", 1);
+    st2.update("FOPR", 150);
+    st2.update_well_var("OP1", "WWCT", 0.75);
+    {
+        const auto res = copy.eval(context2);
+        BOOST_CHECK(res);
+        BOOST_CHECK_EQUAL(res.wells().size(), 1U);
+    }
+    BOOST_CHECK(ast.eval(context));
+    BOOST_CHECK(!ast.eval(context).has_well("OP1"));
+}
+
 BOOST_AUTO_TEST_CASE(Conditions) {
     auto location = KeywordLocation("Keyword", "File", 100);
 
@@ -171,6 +171,40 @@ BOOST_AUTO_TEST_CASE(AddCompletionCopy) {
 }
 
 
+BOOST_AUTO_TEST_CASE(ConnectionLookupAfterReorder) {
+    const auto dir = Opm::Connection::Direction::Z;
+    const auto kind = Opm::Connection::CTFKind::DeckValue;
+    const auto open = Opm::Connection::State::OPEN;
+
+    Opm::WellConnections connections(Opm::Connection::Order::DEPTH, 0, 0);
+    connections.add(Opm::Connection( 0,0,2, 2, 1, 30.0, open, 99.88, 355.113, 0.25, 0.0, 0.0, 0.0, 0.0, 0, dir, kind, 0, true));
+    connections.add(Opm::Connection( 0,0,0, 0, 2, 10.0, open, 99.88, 355.113, 0.25, 0.0, 0.0, 0.0, 0.0, 0, dir, kind, 1, true));
+    connections.add(Opm::Connection( 0,0,1, 1, 3, 20.0, open, 99.88, 355.113, 0.25, 0.0, 0.0, 0.0, 0.0, 0, dir, kind, 2, true));
+
+    BOOST_CHECK_EQUAL(connections.getFromGlobalIndex(0).complnum(), 2);
+    BOOST_CHECK_EQUAL(connections.getFromIJK(0,0,2).complnum(), 1);
+
+    connections.order();
+    for (std::size_t pos = 0; pos < connections.size(); ++pos) {
+        BOOST_CHECK_EQUAL(connections[pos].global_index(), pos);
+        BOOST_CHECK(&connections.getFromGlobalIndex(pos) == &connections[pos]);
+        BOOST_CHECK(&connections.getFromIJK(0,0,pos) == &connections[pos]);
+    }
+
+    const std::vector<int> globalCell { 0, 2 };
+    connections.filter(Opm::ActiveGridCells { std::size_t{1}, std::size_t{1}, std::size_t{3},
+                                              globalCell.data(), globalCell.size() });
+
+    BOOST_REQUIRE_EQUAL(connections.size(), std::size_t{2});
+    BOOST_CHECK(! connections.hasGlobalIndex(1));
+    BOOST_CHECK_THROW(connections.getFromGlobalIndex(1), std::logic_error);
+    BOOST_CHECK_THROW(connections.getFromIJK(0,0,1), std::runtime_error);
+    BOOST_CHECK(&connections.getFromGlobalIndex(2) == &connections[1]);
+    BOOST_CHECK(&connections.getFromIJK(0,0,2) == &connections[1]);
+    BOOST_CHECK_EQUAL(getCompletionNumberFromGlobalConnectionIndex(connections, 2).value(), 1);
+}
+
+
 BOOST_AUTO_TEST_CASE(ActiveCompletions) {
     Opm::EclipseGrid grid(10,20,20);
     auto dir = Opm::Connection::Direction::Z;
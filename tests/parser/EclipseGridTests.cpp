@@ -2744,6 +2744,62 @@ BOOST_AUTO_TEST_CASE(TEST_getCellCenters) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TEST_precomputeGeometry) {
+    Opm::EclipseGrid grid( BAD_CP_GRID_ACTNUM() );
+    BOOST_CHECK(grid.activeGeometry() == nullptr);
+
+    const auto nGlobal = grid.getCartesianSize();
+    std::vector<double> volume, depth, thickness;
+    std::vector<std::array<double, 3>> center, dims;
+    for (std::size_t g = 0; g < nGlobal; g++) {
+        volume.push_back(grid.getCellVolume(g));
+        depth.push_back(grid.getCellDepth(g));
+        thickness.push_back(grid.getCellThickness(g));
+        center.push_back(grid.getCellCenter(g));
+        dims.push_back(grid.getCellDims(g));
+    }
+
+    const auto& geometry = grid.precomputeGeometry();
+    BOOST_CHECK(grid.activeGeometry() == &geometry);
+    BOOST_CHECK_EQUAL(geometry.volume.size(), grid.getNumActive());
+    BOOST_CHECK(&grid.activeVolume() == &geometry.volume);
+
+    // Cached and recomputed values are identical, also for inactive cells
+    // which are not in the cache.
+    for (std::size_t g = 0; g < nGlobal; g++) {
+        BOOST_CHECK_EQUAL(grid.getCellVolume(g), volume[g]);
+        BOOST_CHECK_EQUAL(grid.getCellDepth(g), depth[g]);
+        BOOST_CHECK_EQUAL(grid.getCellThickness(g), thickness[g]);
+        BOOST_CHECK(grid.getCellCenter(g) == center[g]);
+        BOOST_CHECK(grid.getCellDims(g) == dims[g]);
+    }
+
+    for (std::size_t a = 0; a < grid.getNumActive(); a++) {
+        const auto g = grid.getGlobalIndex(a);
+        BOOST_CHECK_EQUAL(geometry.depth[a], depth[g]);
+        BOOST_CHECK_EQUAL(geometry.center[1][a], center[g][1]);
+        BOOST_CHECK_EQUAL(geometry.dims[0][a], dims[g][0]);
+    }
+
+    // Releasing the cache keeps the active cell volumes.
+    grid.releaseGeometry();
+    BOOST_CHECK(grid.activeGeometry() == nullptr);
+    BOOST_CHECK_EQUAL(grid.activeVolume().size(), grid.getNumActive());
+    for (std::size_t a = 0; a < grid.getNumActive(); a++)
+        BOOST_CHECK_EQUAL(grid.activeVolume()[a], volume[grid.getGlobalIndex(a)]);
+
+    // Modifying the corner depths drops the cache.
+    grid.precomputeGeometry();
+    grid.fixupZCORN();
+    BOOST_CHECK(grid.activeGeometry() == nullptr);
+
+    // Changing the active cells drops the cache.
+    grid.precomputeGeometry();
+    grid.resetACTNUM(std::vector<int>(nGlobal, 1));
+    BOOST_CHECK(grid.activeGeometry() == nullptr);
+    BOOST_CHECK_EQUAL(grid.getCellVolume(nGlobal - 1), volume[nGlobal - 1]);
+}
+
 BOOST_AUTO_TEST_CASE(LoadFromBinary) {
     BOOST_CHECK_THROW(Opm::EclipseGrid( "No/does/not/exist" ) , std::runtime_error);
 }
@@ -2863,3 +2863,79 @@ MULTZ
         BOOST_CHECK_EQUAL(multz2[ij + 100], 40.0);
     }
 }
+
+BOOST_AUTO_TEST_CASE(LAZY_CONSTANT_KEYWORDS) {
+    std::string deck_string = R"(
+GRID
+
+PORO
+   200*0.25 /
+
+PERMX
+   100*100 100*200 /
+
+EQUALS
+  NTG 0.5 /
+  PERMY 50 /
+  PERMZ 10 1 10 1 10 1 1 /
+/
+
+MULTIPLY
+  NTG 2 /
+/
+
+EDIT
+
+MULTIPLY
+  TRANX 0.5 /
+/
+)";
+
+    EclipseGrid grid(10,10, 2);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, Phases{true, true, true}, grid, TableManager());
+
+    const auto bytes = [&fpm](const std::string& keyword) {
+        for (const auto& usage : fpm.memory_usage()) {
+            if (usage.keyword == keyword)
+                return usage.bytes;
+        }
+        throw std::out_of_range("No memory usage for " + keyword);
+    };
+
+    BOOST_CHECK_EQUAL(bytes("PORO"), 0U);
+    BOOST_CHECK_EQUAL(bytes("NTG"), 0U);
+    BOOST_CHECK_EQUAL(bytes("PERMY"), 0U);
+    BOOST_CHECK(bytes("PERMX") >= 200 * sizeof(double));
+    BOOST_CHECK(bytes("PERMZ") >= 200 * sizeof(double));
+
+    const auto usage = fpm.memory_usage();
+    BOOST_CHECK(std::is_sorted(usage.begin(), usage.end(),
+                               [](const auto& u1, const auto& u2) { return u1.bytes > u2.bytes; }));
+
+    const auto ntg = fpm.get_double_view("NTG");
+    BOOST_CHECK(ntg.is_constant());
+    BOOST_CHECK_EQUAL(ntg.size(), 200U);
+    BOOST_CHECK_EQUAL(ntg[199], 1.0);
+    BOOST_CHECK(! fpm.get_double_view("PERMX").is_constant());
+    BOOST_CHECK_EQUAL(fpm.get_double_view("PERMX")[150], 200 * Metric::Permeability);
+
+    BOOST_CHECK(fpm.get_copy<double>("PORO") == std::vector<double>(200, 0.25));
+    BOOST_CHECK(fpm.get_global_double("PERMY") == std::vector<double>(200, 50 * Metric::Permeability));
+    BOOST_CHECK_EQUAL(bytes("PORO"), 0U);
+
+    // Tran calculators read the symbolic fields directly.
+    std::vector<double> tranx(200, 4.0);
+    fpm.apply_tran("TRANX", tranx);
+    BOOST_CHECK(tranx == std::vector<double>(200, 2.0));
+
+    // Keywords only autocreated by get_copy() remain unallocated.
+    BOOST_CHECK(fpm.get_copy<double>("MULTX") == std::vector<double>(200, 1.0));
+    BOOST_CHECK_EQUAL(fpm.get_int_view("SATNUM")[0], 1);
+    BOOST_CHECK_EQUAL(bytes("SATNUM"), 0U);
+
+    const auto& poro = fpm.get_double("PORO");
+    BOOST_CHECK(poro == std::vector<double>(200, 0.25));
+    BOOST_CHECK(bytes("PORO") >= 200 * sizeof(double));
+    BOOST_CHECK(! fpm.get_double_view("PORO").is_constant());
+}
@@ -32,6 +32,7 @@
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
@@ -42,15 +43,20 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/R.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/S.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/T.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/W.hpp>
 #include <opm/input/eclipse/Parser/ParserRecord.hpp>
 
 #include "src/opm/input/eclipse/Parser/raw/RawKeyword.hpp"
 #include "src/opm/input/eclipse/Parser/raw/RawRecord.hpp"
 
+#include "tests/WorkArea.hpp"
+
 #include <cstddef>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -58,6 +64,10 @@
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Opm;
 
 namespace {
@@ -299,6 +309,37 @@ BOOST_AUTO_TEST_CASE(ReplaceKeyword) {
     BOOST_CHECK(record.hasItem("NEW"));
 }
 
+BOOST_AUTO_TEST_CASE(BuiltinKeywords) {
+    const auto& table = ParserKeywords::builtinKeywordTable();
+    BOOST_CHECK(table.find("DIMENS") != nullptr);
+    BOOST_CHECK(table.find("DIMENSX") == nullptr);
+    BOOST_CHECK(table.find("") == nullptr);
+
+    std::size_t num_deck_names = 0;
+    for (std::size_t i = 0; i < table.num_slots; ++i) {
+        const auto& slot = table.slots[i];
+        if (slot.keyword == nullptr)
+            continue;
+
+        ++num_deck_names;
+        BOOST_CHECK(table.find(slot.deck_name) == slot.keyword);
+        BOOST_CHECK(table.keywords[slot.keyword->index] == slot.keyword);
+    }
+    BOOST_CHECK_EQUAL(num_deck_names, table.num_deck_names);
+
+    const Parser parser;
+    BOOST_CHECK_EQUAL(parser.size(), table.num_deck_names);
+
+    // Keywords are created once, and shared with copies of the parser.
+    const auto& dimens = parser.getParserKeywordFromDeckName("DIMENS");
+    BOOST_CHECK_EQUAL(dimens.getName(), "DIMENS");
+    BOOST_CHECK_EQUAL(&dimens, &parser.getParserKeywordFromDeckName("DIMENS"));
+
+    const Parser copy = parser;
+    BOOST_CHECK_EQUAL(&dimens, &copy.getParserKeywordFromDeckName("DIMENS"));
+    BOOST_CHECK(copy.getParserKeywordFromDeckName("WCONPROD") == ParserKeywords::WCONPROD{});
+}
+
 
 BOOST_AUTO_TEST_CASE(WildCardTest) {
     Parser parser;
@@ -2545,6 +2586,54 @@ BOOST_AUTO_TEST_CASE(ParserKeywordSize) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(Scan_Numeric_Data_Records)
+{
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 2 2 2 /
+GRID
+PORO
+ 0.25 2*0.5 1.0D-1, +3.0E-1
+ .5 1* 1 /
+ACTNUM
+ 1 0 2*1 +1 2* 1 /
+)");
+
+    {
+        const auto& item = deck["PORO"].back().getDataRecord().getDataItem();
+        const auto& data = item.getData<double>();
+        const auto& status = item.getValueStatus();
+        BOOST_REQUIRE_EQUAL(data.size(), std::size_t{8});
+
+        const auto expect = std::vector<double> { 0.25, 0.5, 0.5, 0.1, 0.3, 0.5 };
+        for (std::size_t i = 0; i < expect.size(); ++i)
+            BOOST_CHECK_CLOSE(data[i], expect[i], 1.0e-12);
+
+        BOOST_CHECK(status[5] == value::status::deck_value);
+        BOOST_CHECK(value::defaulted(status[6]));
+        BOOST_CHECK_EQUAL(data[7], 1.0);
+    }
+
+    {
+        const auto& item = deck["ACTNUM"].back().getDataRecord().getDataItem();
+        const auto& data = item.getData<int>();
+        BOOST_REQUIRE_EQUAL(data.size(), std::size_t{8});
+        BOOST_CHECK_EQUAL(data[1], 0);
+        BOOST_CHECK_EQUAL(data[4], 1);
+        BOOST_CHECK(value::defaulted(item.getValueStatus()[5]));
+        BOOST_CHECK(value::defaulted(item.getValueStatus()[6]));
+        BOOST_CHECK_EQUAL(data[7], 1);
+    }
+
+    // Records with quotes are split by the general tokenizer.
+    BOOST_CHECK_THROW(Parser{}.parseString("GRID\nPORO\n 0.25 2*'0.5' /\n"), OpmInputError);
+    BOOST_CHECK_THROW(Parser{}.parseString("GRID\nPORO\n 0.25 '0.5 /\n"), OpmInputError);
+
+    BOOST_CHECK_THROW(Parser{}.parseString("GRID\nPORO\n 0.25 2*0.5 1.0x /\n"), OpmInputError);
+    BOOST_CHECK_THROW(Parser{}.parseString("GRID\nPORO\n 0.25 0*0.5 /\n"), OpmInputError);
+    BOOST_CHECK_THROW(Parser{}.parseString("GRID\nPORO\n 0.25 *0.5 /\n"), OpmInputError);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // General_Facilities
 
 // ===========================================================================
@@ -2983,3 +3072,147 @@ END
 }
 
 BOOST_AUTO_TEST_SUITE_END() // Parse_ROCK
+
+// =====================================================================
+
+BOOST_AUTO_TEST_SUITE(Parallel_Data_Keywords)
+
+namespace {
+
+constexpr std::size_t nx = 40, ny = 30, nz = 40;
+constexpr std::size_t numCells = nx * ny * nz;
+
+// Half of the values as repeat counts, the other half as individual
+// values, for a keyword of well above the parallel processing threshold.
+void writeDataKeyword(std::ostream& os, const std::string& kw, const double scale)
+{
+    os << kw << '\n';
+
+    const auto half = numCells / 2;
+    for (std::size_t i = 0; i < half; i += 100)
+        os << "100*" << scale << '\n';
+
+    for (std::size_t i = half; i < numCells; ++i)
+        os << scale * (1 + i % 97) << ((i % 10 == 9) ? '\n' : ' ');
+
+    os << "/\n\n";
+}
+
+void writeCase(const std::string& bad_keyword = "")
+{
+    {
+        std::ofstream inc("props.inc");
+        writeDataKeyword(inc, "PERMX", 1.5);
+        writeDataKeyword(inc, "PERMY", 2.5);
+        inc << "INCLUDE\n 'poro.inc' /\n\n";
+        writeDataKeyword(inc, "PERMZ", 0.5);
+    }
+
+    {
+        std::ofstream inc("poro.inc");
+        if (bad_keyword == "PORO")
+            inc << "PORO\n 0.1 0.2 x0.3 " << numCells - 3 << "*0.25 /\n\n";
+        else
+            writeDataKeyword(inc, "PORO", 0.001);
+
+        inc << "NTG\n " << numCells << "*1 /\n\n";
+    }
+
+    std::ofstream data("CASE.DATA");
+    data << "RUNSPEC\nDIMENS\n " << nx << ' ' << ny << ' ' << nz << " /\n"
+         << "GRID\nINCLUDE\n 'props.inc' /\n\n";
+
+    if (bad_keyword == "MULTX")
+        data << "MULTX\n 1 2 y3 " << numCells - 3 << "*1 /\n\n";
+    else
+        writeDataKeyword(data, "MULTX", 1.0);
+
+    data << "EDIT\nEND\n";
+}
+
+Deck parseWithThreads(const int num_threads)
+{
+#ifdef _OPENMP
+    const auto orig_threads = omp_get_max_threads();
+    omp_set_num_threads(num_threads);
+#else
+    static_cast<void>(num_threads);
+#endif
+
+    std::optional<Deck> deck;
+    try {
+        deck = Parser{}.parseFile("CASE.DATA");
+    }
+    catch (...) {
+#ifdef _OPENMP
+        omp_set_num_threads(orig_threads);
+#endif
+        throw;
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(orig_threads);
+#endif
+
+    return std::move(*deck);
+}
+
+std::string parseErrorWithThreads(const int num_threads)
+{
+    try {
+        parseWithThreads(num_threads);
+    }
+    catch (const OpmInputError& e) {
+        return e.what();
+    }
+
+    return "";
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Same_Deck_Independent_Of_Threads)
+{
+    WorkArea work;
+    writeCase();
+
+    const auto serial = parseWithThreads(1);
+    const auto parallel = parseWithThreads(4);
+
+    BOOST_REQUIRE_EQUAL(serial.size(), parallel.size());
+    for (std::size_t i = 0; i < serial.size(); ++i) {
+        const auto& kw1 = serial[i];
+        const auto& kw2 = parallel[i];
+
+        BOOST_CHECK_EQUAL(kw1.name(), kw2.name());
+        BOOST_CHECK_EQUAL(kw1.location().lineno, kw2.location().lineno);
+        BOOST_CHECK_EQUAL(kw1.location().filename, kw2.location().filename);
+        BOOST_CHECK(kw1 == kw2);
+    }
+
+    const auto& poro = parallel["PORO"].back();
+    BOOST_CHECK_EQUAL(poro.getSIDoubleData().size(), numCells);
+    BOOST_CHECK_CLOSE(poro.getSIDoubleData()[5], 0.001, 1.0e-8);
+    BOOST_CHECK_CLOSE(poro.getSIDoubleData()[numCells - 1], 0.001 * (1 + (numCells - 1) % 97), 1.0e-8);
+
+    const auto& permx = parallel["PERMX"].back();
+    BOOST_CHECK_CLOSE(permx.getRawDoubleData()[0], 1.5, 1.0e-8);
+}
+
+BOOST_AUTO_TEST_CASE(First_Error_Reported_Independent_Of_Threads)
+{
+    WorkArea work;
+
+    for (const auto* bad_keyword : { "PORO", "MULTX" }) {
+        writeCase(bad_keyword);
+
+        const auto serial = parseErrorWithThreads(1);
+        const auto parallel = parseErrorWithThreads(4);
+
+        BOOST_CHECK_MESSAGE(serial.find(bad_keyword) != std::string::npos,
+                            "Error must identify keyword " << bad_keyword);
+        BOOST_CHECK_EQUAL(serial, parallel);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Parallel_Data_Keywords
@@ -18,11 +18,14 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <fstream>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -32,8 +35,11 @@
 #include <boost/test/tools/floating_point_comparison.hpp>
 
 #include <opm/common/utility/ActiveGridCells.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
 #include <opm/common/utility/TimeService.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/common/utility/shmatch.hpp>
 
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/RestartFileView.hpp>
@@ -4008,6 +4014,94 @@ BOOST_AUTO_TEST_CASE(WellOrderTest) {
     BOOST_CHECK( wo.names() == sorted_wells );
     BOOST_CHECK( wo.has("W1"));
     BOOST_CHECK( !wo.has("G1"));
+
+    wo.add("PROD2");
+    wo.add("P1");
+    wo.add("PROD1");
+    wo.add("W10");
+
+    const auto prod = std::vector<std::string> {"PROD2", "PROD1"};
+    const auto w1 = std::vector<std::string> {"W1", "W10"};
+    const auto p = std::vector<std::string> {"PROD2", "P1", "PROD1"};
+    BOOST_CHECK( wo.match(ShellPattern("PROD*")) == prod );
+    BOOST_CHECK( wo.match(ShellPattern("W1*")) == w1 );
+    BOOST_CHECK( wo.match(ShellPattern("P*")) == p );
+    BOOST_CHECK( wo.match(ShellPattern("*1")) == std::vector<std::string>({"W1", "P1", "PROD1"}) );
+    BOOST_CHECK( wo.match(ShellPattern("W1")) == std::vector<std::string>{"W1"} );
+    BOOST_CHECK( wo.match(ShellPattern("Q*")).empty() );
+
+    Serializer<Serialization::MemPacker> ser(Serialization::MemPacker{});
+    ser.pack(wo);
+    NameOrder wo2;
+    ser.unpack(wo2);
+    BOOST_CHECK( wo2 == wo );
+    BOOST_CHECK( wo2.match(ShellPattern("PROD*")) == prod );
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleStateSharing) {
+    const auto input = std::string { R"(
+START             -- 0
+10 MAI 2007 /
+GRID
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+SCHEDULE
+WELSPECS
+     'W1'        'G1'   3   3  3.33       'OIL'  7* /
+     'W2'        'G1'   3   4  3.33       'OIL'  7* /
+     'W3'        'G2'   2   5  3.92       'OIL'  7* /
+/
+COMPDAT
+     'W*'  2*  1  2  'OPEN' /
+/
+TSTEP
+  10 10 /
+WCONPROD
+     'W2' 'OPEN' 'ORAT' 100 /
+/
+TSTEP
+  10 /
+)" };
+
+    const auto sched = make_schedule(input);
+    BOOST_REQUIRE_EQUAL(sched.size(), std::size_t{4});
+
+    // Report steps without well changes share all wells.
+    BOOST_CHECK(sched[1].wells.storage().sharesStorage(sched[0].wells.storage()));
+    BOOST_CHECK(sched[3].wells.storage().sharesStorage(sched[2].wells.storage()));
+    BOOST_CHECK(! sched[2].wells.storage().sharesStorage(sched[1].wells.storage()));
+    BOOST_CHECK(sched[2].wells.get_ptr("W1") == sched[1].wells.get_ptr("W1"));
+    BOOST_CHECK(sched[2].wells.get_ptr("W2") != sched[1].wells.get_ptr("W2"));
+
+    const auto member = [](const std::vector<Schedule::MemberMemoryUsage>& usage,
+                           const std::string& name)
+    {
+        const auto pos = std::find_if(usage.begin(), usage.end(),
+                                      [&name](const auto& member_usage)
+                                      { return member_usage.member == name; });
+        BOOST_REQUIRE(pos != usage.end());
+        return *pos;
+    };
+
+    const auto usage = sched.memoryUsage();
+    const auto wells = member(usage, "wells");
+    BOOST_CHECK_EQUAL(wells.references, std::size_t{12});
+    BOOST_CHECK_EQUAL(wells.instances, std::size_t{4});
+    BOOST_CHECK(wells.bytes > 0);
+
+    // WCONPROD does not change the connections of W2.
+    const auto connections = member(usage, "well_connections");
+    BOOST_CHECK_EQUAL(connections.references, std::size_t{12});
+    BOOST_CHECK_EQUAL(connections.instances, std::size_t{3});
+
+    BOOST_CHECK_EQUAL(member(usage, "state").instances, sched.size());
+    BOOST_CHECK_EQUAL(member(usage, "well_order").references, sched.size());
 }
 
 BOOST_AUTO_TEST_CASE(GroupOrderTest) {
@@ -5720,4 +5814,123 @@ BCPROP
         const auto& bcface0 = bc[0];
         BOOST_CHECK_CLOSE(bcface0.rate * Opm::unit::day, 200, 1e-8 );
     }
-}
\ No newline at end of file
+}
+BOOST_AUTO_TEST_CASE(WELTRAJ_COMPTRAJ_Multiple_Wells) {
+    const auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+5 5 3 /
+
+START
+  5 OCT 2020 /
+
+GRID
+DXV
+  5*100 /
+DYV
+  5*100 /
+DZV
+  3*10 /
+DEPTHZ
+  36*1000 /
+
+-- Cells (2,2,1) and (2,2,2) are inactive
+ACTNUM
+  6*1 0 18*1
+  6*1 0 18*1
+  25*1
+/
+
+PERMX
+  75*100 /
+PERMY
+  75*100 /
+PERMZ
+  75*100 /
+PORO
+  75*0.3 /
+
+SCHEDULE
+WELSPECS
+  'V1' 'G' 1  1  1* 'OIL' /
+  'V2' 'G' 1* 1* 1* 'OIL' /
+  'D'  'G' 1* 1* 1* 'OIL' /
+/
+
+WELTRAJ
+  'V1' 1* 50  50   990.0    0.0 /
+  'V1' 1* 50  50  1040.0   50.0 /
+  'V2' 1* 350 250  990.0    0.0 /
+  'V2' 1* 350 250 1040.0   50.0 /
+  'D'  1* 150 150  990.0    0.0 /
+  'D'  1* 150 150 1000.0   10.0 /
+  'D'  1* 250 150 1030.0  114.40306 /
+/
+
+COMPTRAJ
+  'V1' 1*  5.0  45.0 1* 1* 1* 1* 1* 0.2 1* 0.0 1* /
+  'V2' 1*  5.0  45.0 1* 1* 1* 1* 1* 0.2 1* 0.0 1* /
+  'D'  1*  5.0 110.0 1* 1* 1* 1* 1* 0.2 1* 0.0 1* /
+/
+
+TSTEP
+  10
+/
+
+END
+)");
+
+    const auto es    = EclipseState{ deck };
+    const auto sched = Schedule{ deck, es };
+
+    using IJK = std::array<int, 3>;
+    const auto connectionCells = [&sched](const std::string& wname)
+    {
+        auto cells = std::vector<IJK>{};
+        for (const auto& conn : sched.getWell(wname, 0).getConnections()) {
+            cells.push_back({ conn.getI(), conn.getJ(), conn.getK() });
+        }
+        std::sort(cells.begin(), cells.end());
+        return cells;
+    };
+
+    // Vertical well with explicit well head
+    {
+        const auto& well = sched.getWell("V1", 0);
+        BOOST_CHECK_EQUAL(well.getHeadI(), 0);
+        BOOST_CHECK_EQUAL(well.getHeadJ(), 0);
+
+        const auto expect = std::vector<IJK> {
+            IJK{0, 0, 0}, IJK{0, 0, 1}, IJK{0, 0, 2},
+        };
+        const auto cells = connectionCells("V1");
+        BOOST_CHECK(cells == expect);
+    }
+
+    // Vertical well with defaulted well head
+    {
+        const auto& well = sched.getWell("V2", 0);
+        BOOST_CHECK_EQUAL(well.getHeadI(), 3);
+        BOOST_CHECK_EQUAL(well.getHeadJ(), 2);
+
+        const auto expect = std::vector<IJK> {
+            IJK{3, 2, 0}, IJK{3, 2, 1}, IJK{3, 2, 2},
+        };
+        const auto cells = connectionCells("V2");
+        BOOST_CHECK(cells == expect);
+    }
+
+    // Deviated well entering the grid through the inactive cells (1,1,0)
+    // and (1,1,1).  No connections are created in those cells, and the
+    // defaulted well head is taken from the first active intersected cell.
+    {
+        const auto& well = sched.getWell("D", 0);
+        BOOST_CHECK_EQUAL(well.getHeadI(), 2);
+        BOOST_CHECK_EQUAL(well.getHeadJ(), 1);
+
+        const auto expect = std::vector<IJK> {
+            IJK{2, 1, 1}, IJK{2, 1, 2},
+        };
+        const auto cells = connectionCells("D");
+        BOOST_CHECK(cells == expect);
+    }
+}
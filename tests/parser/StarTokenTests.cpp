@@ -99,6 +99,19 @@ BOOST_AUTO_TEST_CASE( ContainsStar_WithStar_ReturnsTrue ) {
     BOOST_CHECK_EQUAL( false , Opm::isStarToken("'12*34'", countString, valueString) );
 }
 
+BOOST_AUTO_TEST_CASE( ContainsStar_Views ) {
+    std::string_view countString, valueString;
+    BOOST_CHECK( Opm::isStarToken("12*3.5", countString, valueString) );
+    BOOST_CHECK_EQUAL( countString, "12" );
+    BOOST_CHECK_EQUAL( valueString, "3.5" );
+
+    BOOST_CHECK( Opm::isStarToken("*", countString, valueString) );
+    BOOST_CHECK( countString.empty() );
+    BOOST_CHECK( valueString.empty() );
+
+    BOOST_CHECK( !Opm::isStarToken("3.5", countString, valueString) );
+}
+
 BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_THROW( Opm::readValueToken<int>( std::string( "3.3" ) ), std::invalid_argument );
     BOOST_CHECK_EQUAL( 3, Opm::readValueToken<int>( std::string( "3" ) ) );
@@ -120,6 +133,11 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_CLOSE( 3.3, Opm::readValueToken<double>( std::string( "3.3d0" ) ), 1e-6 );
     BOOST_CHECK_CLOSE( 3.3, Opm::readValueToken<double>( std::string( "3.3E0" ) ), 1e-6 );
     BOOST_CHECK_CLOSE( 3.3, Opm::readValueToken<double>( std::string( "3.3D0" ) ), 1e-6 );
+    BOOST_CHECK_CLOSE( 3.3, Opm::readValueToken<double>( std::string( "+3.3e0" ) ), 1e-6 );
+    BOOST_CHECK_CLOSE( 0.5, Opm::readValueToken<double>( std::string( ".5" ) ), 1e-6 );
+    BOOST_CHECK_CLOSE( 5.0, Opm::readValueToken<double>( std::string( "5." ) ), 1e-6 );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "3.3e" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( std::string( "3e2" ) ), std::invalid_argument );
     BOOST_CHECK_EQUAL( "OLGA", Opm::readValueToken<std::string>( std::string( "OLGA" ) ) );
     BOOST_CHECK_EQUAL( "OLGA", Opm::readValueToken<std::string>( std::string( "'OLGA'" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
@@ -5,6 +5,8 @@
 #include <opm/common/utility/String.hpp>
 #include <opm/common/utility/shmatch.hpp>
 
+#include <regex>
+
 using namespace Opm;
 
 BOOST_AUTO_TEST_CASE( uppercase_copy ) {
@@ -147,6 +149,24 @@ BOOST_AUTO_TEST_CASE(match_test) {
     BOOST_CHECK( shmatch("NAME.*", "NAME.EXT") );
     BOOST_CHECK( !shmatch("NAME.?", "NAME.") );
     BOOST_CHECK( !shmatch("NAME.*", "NAME") );
+
+    BOOST_CHECK( shmatch("*", "") );
+    BOOST_CHECK( shmatch("*A*B", "XAYAB") );
+    BOOST_CHECK( !shmatch("*A*B", "XAYABC") );
+    BOOST_CHECK( shmatch("N[^0-4]", "N7") );
+    BOOST_CHECK( !shmatch("N[^0-4]", "N3") );
+    BOOST_CHECK( shmatch("N[A-C-]", "N-") );
+    BOOST_CHECK( !shmatch("*", "A\nB") );
+    BOOST_CHECK_THROW( shmatch("N[0-9", "N1"), std::regex_error );
+
+    const ShellPattern pattern("OP*_[0-9]?");
+    BOOST_CHECK( pattern.hasWildcard() );
+    BOOST_CHECK_EQUAL( pattern.prefix(), "OP" );
+    BOOST_CHECK( pattern.match("OP_1A") );
+    BOOST_CHECK( pattern.match("OPX_X_2B") );
+    BOOST_CHECK( !pattern.match("OPX_X_2") );
+    BOOST_CHECK( !ShellPattern("OP1").hasWildcard() );
+    BOOST_CHECK( ShellPattern("OP.").hasWildcard() );
 }
 
 
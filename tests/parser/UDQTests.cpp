@@ -273,6 +273,38 @@ BOOST_AUTO_TEST_CASE(SUBTRACT)
     BOOST_CHECK_EQUAL( res2[0].get(), 16.0);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_CONTEXT_UNKNOWN_ENTITIES)
+{
+    UDQParams udqp;
+    UDQFunctionTable udqft;
+
+    SummaryState st(TimeService::now());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2"}));
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    UDQContext context(udqft, wm, {}, segmentMatcherFactory, st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 4);
+    st.update_group_var("G1", "GOPR", 5);
+    st.update_group_var("G2", "GWPR", 6);
+
+    std::vector<double> values;
+    context.well_values("WOPR", values);
+    BOOST_REQUIRE_EQUAL( values.size(), 2U );
+    BOOST_CHECK_EQUAL( values[0], 4.0 );
+    BOOST_CHECK( std::isnan(values[1]) );
+
+    context.group_values("GOPR", values);
+    BOOST_REQUIRE_EQUAL( values.size(), 2U );
+    BOOST_CHECK_EQUAL( values[0], 5.0 );
+    BOOST_CHECK( std::isnan(values[1]) );
+
+    // Looking up values does not register unknown wells.
+    BOOST_CHECK( !st.find_well_id("P2").has_value() );
+    BOOST_CHECK( st.find_well_id("P1").has_value() );
+    BOOST_CHECK( st.find_group_var_id("GOPR").has_value() );
+}
+
 BOOST_AUTO_TEST_CASE(TEST)
 {
     KeywordLocation location;
@@ -1437,6 +1469,94 @@ BOOST_AUTO_TEST_CASE(UDQ_BASIC_MATH_TEST) {
     BOOST_CHECK_EQUAL( res_wuwct["P4"].get(),0.50);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_COMPILED_PROGRAM) {
+    UDQParams udqp;
+    UDQFunctionTable udqft;
+    KeywordLocation location;
+    UDQDefine def_lin(udqp, "WULIN", 0, location, {"-", "2", "*", "WOPR", "+", "WWPR", "/", "FOPR"});
+    UDQDefine def_sum(udqp, "WUSUM", 0, location, {"WOPR", "/", "SUM", "(", "WOPR", ")"});
+    UDQDefine def_avea(udqp, "WUAVE", 0, location, {"AVEA", "(", "WWPR", ")"});
+    UDQDefine def_uadd(udqp, "WUADD", 0, location, {"WOPR", "UADD", "WWPR"});
+    UDQDefine def_idv(udqp, "WUIDV", 0, location, {"IDV", "(", "WWPR", ")", "+", "ABS", "(", "WOPR", "P1", ")"});
+    UDQDefine def_pow(udqp, "WUPOW", 0, location, {"WOPR", "^", "WWPR"});
+    UDQDefine def_cmp(udqp, "WUCMP", 0, location, {"WOPR", ">", "1"});
+    UDQDefine def_grp(udqp, "GUGRP", 0, location, {"GOPR", "*", "2", "+", "WOPR", "P2"});
+
+    BOOST_CHECK(def_lin.compiled());
+    BOOST_CHECK(def_sum.compiled());
+    BOOST_CHECK(def_avea.compiled());
+    BOOST_CHECK(def_uadd.compiled());
+    BOOST_CHECK(def_idv.compiled());
+    BOOST_CHECK(def_pow.compiled());
+    BOOST_CHECK(def_grp.compiled());
+
+    // Comparisons are evaluated by the syntax tree.
+    BOOST_CHECK(!def_cmp.compiled());
+
+    SummaryState st(TimeService::now());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2", "P3"}));
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    UDQContext context(udqft, wm, {}, segmentMatcherFactory, st, udq_state);
+
+    st.update("FOPR", 2);
+    st.update_well_var("P1", "WOPR", 1);
+    st.update_well_var("P2", "WOPR", 3);
+    st.update_well_var("P3", "WOPR", 4);
+    st.update_well_var("P1", "WWPR", 4);
+    st.update_well_var("P2", "WWPR", 2);
+    st.update_group_var("G1", "GOPR", 10);
+    st.update_group_var("G2", "GOPR", 20);
+
+    // WWPR is not defined for P3.
+    const auto res_lin = def_lin.eval(context);
+    BOOST_CHECK_EQUAL(res_lin.name(), "WULIN");
+    BOOST_CHECK_EQUAL(res_lin.size(), 3U);
+    BOOST_CHECK_EQUAL(res_lin["P1"].get(), -2*1 + 4.0/2);
+    BOOST_CHECK_EQUAL(res_lin["P2"].get(), -2*3 + 2.0/2);
+    BOOST_CHECK(!res_lin["P3"].defined());
+
+    const auto res_sum = def_sum.eval(context);
+    BOOST_CHECK_EQUAL(res_sum["P1"].get(), 1.0 / 8);
+    BOOST_CHECK_EQUAL(res_sum["P2"].get(), 3.0 / 8);
+    BOOST_CHECK_EQUAL(res_sum["P3"].get(), 4.0 / 8);
+
+    const auto res_avea = def_avea.eval(context);
+    BOOST_CHECK(res_avea.var_type() == UDQVarType::WELL_VAR);
+    BOOST_CHECK_EQUAL(res_avea["P1"].get(), 3.0);
+    BOOST_CHECK_EQUAL(res_avea["P3"].get(), 3.0);
+
+    const auto res_uadd = def_uadd.eval(context);
+    BOOST_CHECK_EQUAL(res_uadd["P1"].get(), 5.0);
+    BOOST_CHECK_EQUAL(res_uadd["P2"].get(), 5.0);
+    BOOST_CHECK_EQUAL(res_uadd["P3"].get(), 4.0);
+
+    const auto res_idv = def_idv.eval(context);
+    BOOST_CHECK_EQUAL(res_idv["P1"].get(), 2.0);
+    BOOST_CHECK_EQUAL(res_idv["P2"].get(), 2.0);
+    BOOST_CHECK_EQUAL(res_idv["P3"].get(), 1.0);
+
+    // POW retains the left hand side where the exponent is undefined.
+    const auto res_pow = def_pow.eval(context);
+    BOOST_CHECK_EQUAL(res_pow["P1"].get(), 1.0);
+    BOOST_CHECK_EQUAL(res_pow["P2"].get(), 9.0);
+    BOOST_CHECK_EQUAL(res_pow["P3"].get(), 4.0);
+
+    const auto res_cmp = def_cmp.eval(context);
+    BOOST_CHECK_EQUAL(res_cmp["P1"].get(), 0.0);
+    BOOST_CHECK_EQUAL(res_cmp["P2"].get(), 1.0);
+
+    const auto res_grp = def_grp.eval(context);
+    BOOST_CHECK(res_grp.var_type() == UDQVarType::GROUP_VAR);
+    BOOST_CHECK_EQUAL(res_grp["G1"].get(), 23.0);
+    BOOST_CHECK_EQUAL(res_grp["G2"].get(), 43.0);
+
+    // Undefined scalar combined with a set is reported by the syntax tree.
+    UDQDefine def_undef(udqp, "WUUND", 0, location, {"WOPR", "+", "WOPR", "P4"});
+    BOOST_CHECK(def_undef.compiled());
+    BOOST_CHECK_THROW(def_undef.eval(context), std::exception);
+}
+
 BOOST_AUTO_TEST_CASE(DECK_TEST) {
     KeywordLocation location;
     UDQParams udqp;
@@ -316,6 +316,24 @@ BOOST_AUTO_TEST_CASE(TestERst_4) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestERst_Elements) {
+    const std::vector<std::int64_t> cells { 299, 0, 150, 150, 42 };
+
+    for (const auto* fname : { "SPE1_TESTCASE.UNRST", "SPE1_TESTCASE.FUNRST" }) {
+        ERst rst1(fname);
+        ERst rst2(fname);
+
+        // No report step is loaded for the subset.
+        const auto pres = rst1.getRestartElements<float>("PRESSURE", 25, cells);
+        const auto& full = rst2.getRestartData<float>("PRESSURE", 25, 0);
+
+        BOOST_REQUIRE_EQUAL(pres.size(), cells.size());
+        for (std::size_t i = 0; i < cells.size(); ++i)
+            BOOST_CHECK_EQUAL(pres[i], full[cells[i]]);
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(TestERst_5a) {
 
     std::string testRstFile = "LGR_TESTMOD.X0002";
@@ -375,6 +375,62 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestESmry_LoadSelected) {
+
+    // loading a selection of vectors, one PARAMS span pr ministep, should give
+    // same result as loading all vectors or loading vectors one by one. Also
+    // when data is taken from a restart chain
+
+    auto check_equal = [](const std::vector<float>& vect1, const std::vector<float>& vect2)
+    {
+        BOOST_REQUIRE_EQUAL(vect1.size(), vect2.size());
+
+        for (std::size_t i = 0; i < vect1.size(); i++) {
+            if (std::isnan(vect1[i]))
+                BOOST_CHECK(std::isnan(vect2[i]));
+            else
+                BOOST_CHECK_EQUAL(vect1[i], vect2[i]);
+        }
+    };
+
+    for (const auto& [smspec, loadBase] : { std::make_pair(std::string{"SPE1CASE1.SMSPEC"}, false),
+                                            std::make_pair(std::string{"SPE1CASE1_RST60.SMSPEC"}, true) }) {
+        ESmry smry1(smspec, loadBase);
+        ESmry smry2(smspec, loadBase);
+
+        const auto& keys = smry2.keywordList();
+        std::vector<std::string> selection;
+
+        for (std::size_t n = 0; n < keys.size(); n += 3)
+            selection.push_back(keys[n]);
+
+        // duplicated keys should be handled
+        selection.push_back(keys.front());
+
+        smry2.loadData(selection);
+
+        for (const auto& key : selection)
+            check_equal(smry1.get(key), smry2.get(key));
+
+        if (! loadBase) {
+            ESmry smry3(smspec);
+            smry3.loadData();
+
+            for (const auto& key : selection)
+                check_equal(smry3.get(key), smry2.get(key));
+        }
+    }
+
+    // vector not defined in base run, padded with NaN for base run time steps
+
+    ESmry smry4("SPE1CASE1_RST60.SMSPEC", true);
+    const auto& fopt = smry4.get("FOPT");
+
+    BOOST_CHECK_EQUAL(fopt.size(), smry4.numberOfTimeSteps());
+    BOOST_CHECK(std::isnan(fopt.front()));
+    BOOST_CHECK(!std::isnan(fopt.back()));
+}
+
 BOOST_AUTO_TEST_CASE(TestESmry_4) {
 
     std::vector<float> time_ref = {31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365, 396, 424, 455, 485, 516, 546, 577, 608, 638, 669, 699, 730, 761, 789, 820, 850, 881, 911, 942, 973, 1003, 1034, 1064, 1095, 1126, 1154, 1185, 1215, 1246, 1276, 1307, 1338, 1368, 1399, 1429, 1460, 1491, 1519, 1550, 1580, 1611, 1641, 1672, 1703, 1733, 1764, 1794, 1825, 1856, 1884, 1915, 1945, 1976, 2006, 2037, 2068, 2098, 2129, 2159, 2190, 2221, 2249, 2280, 2310, 2341, 2371, 2402, 2433, 2463, 2494, 2524, 2555, 2586, 2614, 2645, 2675, 2706, 2736, 2767, 2798, 2828, 2859, 2889, 2920, 2951, 2979, 3010, 3040, 3071, 3101, 3132, 3163, 3193, 3224, 3254, 3285, 3316, 3344, 3375, 3405, 3436, 3466, 3497, 3528, 3558, 3589, 3619, 3650};
@@ -28,6 +28,8 @@
 #include <tuple>
 #include <cmath>
 #include <numeric>
+#include <string>
+#include <type_traits>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
@@ -241,6 +243,73 @@ BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MemoryMapped) {
+
+    std::string testFile="ECLFILE.INIT";
+
+    EclFile file1(testFile);
+    EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+    BOOST_CHECK(!file1.memoryMapped());
+    BOOST_CHECK(file2.memoryMapped());
+
+    // array index built from mapped record headers same as stream based index
+
+    BOOST_CHECK(file1.getList() == file2.getList());
+
+    // check that exeption is thrown when member function getView is used with wrong type
+
+    BOOST_CHECK_THROW(file2.getView<int>("PORV"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.getView<float>("ICON"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.getView<double>("XPORV"), std::invalid_argument);
+
+    // values loaded through mapping and through views identical to stream based loading
+
+    BOOST_CHECK(file1.get<int>("ICON") == file2.get<int>("ICON"));
+    BOOST_CHECK(file1.get<float>("PORV") == file2.get<float>("PORV"));
+    BOOST_CHECK(file1.get<double>("XCON") == file2.get<double>("XCON"));
+    BOOST_CHECK(file1.get<bool>("LOGIHEAD") == file2.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(file1.get<std::string>("KEYWORDS") == file2.get<std::string>("KEYWORDS"));
+
+    {
+        const auto& ref = file1.get<float>("PORV");
+        const auto porv = file2.getView<float>("PORV");
+
+        BOOST_CHECK_EQUAL(porv.size(), ref.size());
+        BOOST_CHECK(std::equal(porv.begin(), porv.end(), ref.begin(), ref.end()));
+        BOOST_CHECK_THROW(porv.at(ref.size()), std::out_of_range);
+
+        // partial copy spanning a record boundary (1000 elements per record)
+        std::vector<float> part(50);
+        porv.copy(part.begin(), 980, part.size());
+        BOOST_CHECK(std::equal(part.begin(), part.end(), ref.begin() + 980));
+
+        BOOST_CHECK_THROW(porv.copy(part.begin(), ref.size() - 10, part.size()), std::out_of_range);
+    }
+
+    {
+        const auto& ref = file1.get<std::string>("KEYWORDS");
+        const auto keywords = file2.getView<std::string>("KEYWORDS");
+
+        BOOST_CHECK(keywords.toVector() == ref);
+        BOOST_CHECK_EQUAL(keywords[200], ref[200]);
+    }
+
+    // views available also when the file is not opened in memory mapped
+    // mode, and they outlive the EclFile object
+
+    auto xcon = EclFile(testFile).getView<double>("XCON");
+    BOOST_CHECK(xcon.toVector() == file1.get<double>("XCON"));
+
+    // views not supported for formatted files
+
+    EclFile file3("ECLFILE.FINIT", EclFile::MemoryMapped{true});
+    BOOST_CHECK(!file3.memoryMapped());
+    BOOST_CHECK_THROW(file3.getView<int>("ICON"), std::runtime_error);
+    BOOST_CHECK(file1.get<int>("ICON") == file3.get<int>("ICON"));
+}
+
+
 BOOST_AUTO_TEST_CASE(TestEclFile_IX) {
 
     // file MODEL1_IX.INIT is output from comercial simulator ix with
@@ -358,6 +427,102 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted_not_finite) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_converted) {
+    // Block-wise conversion must produce the same file as converting the
+    // full array up front, for partial and complete output blocks.
+    std::vector<double> data(2503);
+    std::iota(data.begin(), data.end(), -17.25);
+
+    const auto convert = [](double* begin, double* end)
+    {
+        std::transform(begin, end, begin, [](const double x) { return 0.1*x - 3.0; });
+    };
+
+    std::vector<double> converted = data;
+    convert(converted.data(), converted.data() + converted.size());
+
+    const std::vector<float> narrowed(converted.begin(), converted.end());
+
+    WorkArea work;
+    for (const bool formatted : { false, true }) {
+        {
+            EclOutput expect("EXPECT.DAT", formatted);
+            expect.write("DOUB", converted);
+            expect.write("REAL", narrowed);
+            expect.write("EMPTY", std::vector<float>{});
+        }
+
+        {
+            EclOutput result("RESULT.DAT", formatted);
+            result.write("DOUB", data, convert, true);
+            result.write("REAL", data, convert, false);
+            result.write("EMPTY", std::vector<double>{}, convert, false);
+        }
+
+        BOOST_CHECK_MESSAGE(compare_files("EXPECT.DAT", "RESULT.DAT"),
+                            "Converted output must match for formatted = " << formatted);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_getElements) {
+    // Elements spanning several records, in arbitrary order, with repeats.
+    const std::vector<std::int64_t> elements { 2502, 0, 999, 1000, 1000, 1999, 17, 2000 };
+
+    std::vector<double> doub(2503);
+    std::iota(doub.begin(), doub.end(), 0.5);
+
+    std::vector<int> inte(2503);
+    std::iota(inte.begin(), inte.end(), -1000);
+
+    std::vector<bool> logi(2503);
+    for (std::size_t i = 0; i < logi.size(); ++i)
+        logi[i] = (i % 3) == 0;
+
+    std::vector<std::string> names(2503);
+    for (std::size_t i = 0; i < names.size(); ++i)
+        names[i] = "N" + std::to_string(i);
+
+    const std::vector<float> real(doub.begin(), doub.end());
+
+    auto expect = [&elements](const auto& data)
+    {
+        std::vector<typename std::decay_t<decltype(data)>::value_type> result;
+        for (const auto& e : elements)
+            result.push_back(data[e]);
+
+        return result;
+    };
+
+    WorkArea work;
+    for (const auto* fname : { "TEST.DAT", "TEST.FDAT" }) {
+        {
+            EclOutput output(fname, std::string(fname) == "TEST.FDAT");
+            output.write("DOUB", doub);
+            output.write("REAL", real);
+            output.write("INTE", inte);
+            output.write("LOGI", logi);
+            output.write("NAMES", names);
+        }
+
+        for (const bool mmap : { false, true }) {
+            EclFile file(fname, EclFile::MemoryMapped{ mmap });
+
+            BOOST_CHECK(file.getElements<double>("DOUB", elements) == expect(doub));
+            BOOST_CHECK(file.getElements<float>("REAL", elements) == expect(real));
+            BOOST_CHECK(file.getElements<int>("INTE", elements) == expect(inte));
+            BOOST_CHECK(file.getElements<bool>("LOGI", elements) == expect(logi));
+            BOOST_CHECK(file.getElements<std::string>("NAMES", elements) == expect(names));
+
+            BOOST_CHECK_THROW(file.getElements<int>("DOUB", elements), std::runtime_error);
+            BOOST_CHECK_THROW(file.getElements<double>("DOUB", { 2503 }), std::out_of_range);
+
+            // Already loaded arrays are served from memory.
+            file.loadData("INTE");
+            BOOST_CHECK(file.getElements<int>("INTE", elements) == expect(inte));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestEcl_getList) {
 
     std::string inputFile="ECLFILE.INIT";
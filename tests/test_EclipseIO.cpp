@@ -284,7 +284,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         "'PROD' 'G' 3 3 1000 'OIL' /\n"
         "/\n";
 
-    auto write_and_check = [&]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&]( int first = 1, int last = 5, bool async = false ) {
         auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         auto& eclGrid = es.getInputGrid();
@@ -320,6 +320,9 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         int_data.erase("STR_ULONGNAME");
         eclWriter.writeInitial( eGridProps , int_data );
 
+        if (async)
+            eclWriter.enableAsyncOutput();
+
         data::Wells wells;
         data::GroupAndNetworkValues grp_nwrk;
 
@@ -342,7 +345,15 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
                                      first_step - start_time,
                                      std::move(restart_value));
 
-            checkRestartFile( i );
+            if (!async)
+                checkRestartFile( i );
+        }
+
+        if (async) {
+            eclWriter.waitForOutput();
+
+            for( int i = first; i < last; ++i )
+                checkRestartFile( i );
         }
 
         checkInitFile( deck , eGridProps);
@@ -394,4 +405,75 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
      * the file
      */
     BOOST_CHECK_EQUAL( file_size, write_and_check( 3, 5 ) );
+
+    /* output written on a background thread must be identical */
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 1, 5, true ) );
+    BOOST_CHECK( file_size < write_and_check( 3, 7, true ) );
+}
+
+BOOST_AUTO_TEST_CASE(InitFileNumericalAquiferDepth) {
+    const auto deck = Parser().parseString(R"(RUNSPEC
+OIL
+WATER
+METRIC
+DIMENS
+4 1 1 /
+AQUDIMS
+1* 1* 1* 1* 1 1 1* 1* /
+GRID
+INIT
+DXV
+4*100 /
+DYV
+100 /
+DZV
+10 /
+TOPS
+4*2000 /
+PORO
+4*0.3 /
+PERMX
+4*100 /
+PERMY
+4*100 /
+PERMZ
+4*10 /
+AQUNUM
+-- Cell (1,1,1) is a numerical aquifer cell at 2585 m
+  1  1 1 1   1000000.0   10000   0.25   400    2585.00   285.00    1   1  /
+/
+AQUCON
+  1  2 2  1 1  1 1  'I-'  1.00  1  /
+/
+PROPS
+REGIONS
+SOLUTION
+SCHEDULE
+TSTEP
+1 /
+)");
+
+    WorkArea work_area("test_init_aqunum");
+
+    auto es = EclipseState( deck );
+    const auto& grid = es.getInputGrid();
+    auto python = std::make_shared<Python>();
+    Schedule schedule(deck, es, python);
+    SummaryConfig summary_config( deck, schedule, es.fieldProps(), es.aquifer());
+    es.getIOConfig().setBaseName( "FOO" );
+
+    // INIT output must not bypass the aquifer cell depth also when the
+    // active cell geometry is cached.
+    grid.precomputeGeometry();
+
+    EclipseIO eclWriter( es, grid, schedule, summary_config);
+    eclWriter.writeInitial( );
+
+    EclIO::EclFile initFile("FOO.INIT");
+    const auto& depth = initFile.get<float>("DEPTH");
+
+    BOOST_REQUIRE_EQUAL(depth.size(), std::size_t{4});
+    BOOST_CHECK_CLOSE(depth[0], 2585.0f, 1.0e-5);
+    for (std::size_t cell = 1; cell < depth.size(); ++cell)
+        BOOST_CHECK_CLOSE(depth[cell], 2005.0f, 1.0e-5);
 }
@@ -20,6 +20,7 @@
 
 #include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/ExtESmry.hpp>
+#include <opm/io/eclipse/ExtSmryBlocks.hpp>
 #include <opm/common/utility/FileSystem.hpp>
 
 #define BOOST_TEST_MODULE Test EclIO
@@ -30,6 +31,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <limits>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -42,6 +46,8 @@
 
 using Opm::EclIO::ESmry;
 using Opm::EclIO::ExtESmry;
+using Opm::EclIO::ExtSmryLayout;
+namespace ExtSmryBlocks = Opm::EclIO::ExtSmryBlocks;
 
 template<typename InputIterator1, typename InputIterator2>
 bool
@@ -415,3 +421,127 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     for (size_t n = 63; n < fopt.size(); n++)
         BOOST_REQUIRE_CLOSE(fopt[n], fopt_rst_ref[n-63], 0.01);
 }
+
+BOOST_AUTO_TEST_CASE(TestExtSmryBlocks_Codec) {
+
+    std::vector<float> values = { 0.0, 0.0, 0.0, 1.0, 1.0, 1.5, -2.25e7, 3.0e-30,
+                                  std::numeric_limits<float>::quiet_NaN(),
+                                  std::numeric_limits<float>::infinity(), 4.0, 4.0 };
+
+    for (int i = 0; i < 1000; i++)
+        values.push_back(static_cast<float>(std::sin(0.01 * i)));
+
+    values.insert(values.end(), 500, 17.0);
+
+    for (const auto compression : { ExtSmryBlocks::Compression::None,
+                                    ExtSmryBlocks::Compression::DeltaShuffle }) {
+        const auto words = ExtSmryBlocks::encode(values.data(), values.size(), compression);
+
+        std::vector<float> decoded(values.size());
+        ExtSmryBlocks::decode(words.data(), words.size(), decoded.data(), decoded.size());
+
+        for (size_t i = 0; i < values.size(); i++) {
+            if (std::isnan(values[i]))
+                BOOST_CHECK(std::isnan(decoded[i]));
+            else
+                BOOST_CHECK_EQUAL(values[i], decoded[i]);
+        }
+
+        BOOST_CHECK_THROW(ExtSmryBlocks::decode(words.data(), words.size() - 1, decoded.data(), decoded.size()),
+                          std::runtime_error);
+    }
+
+    // constant vector, compressed size should be a tiny fraction of raw size
+
+    const std::vector<float> zeros(1000, 0.0);
+    const auto packed = ExtSmryBlocks::encode(zeros.data(), zeros.size(), ExtSmryBlocks::Compression::DeltaShuffle);
+
+    BOOST_CHECK(packed.size() < zeros.size() / 20);
+}
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_Chunked) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    std::vector<std::vector<float>> ref;
+    std::uintmax_t transposed_size;
+
+    {
+        ESmry smry("SPE1CASE1.SMSPEC");
+        smry.make_esmry_file();
+        transposed_size = std::filesystem::file_size("SPE1CASE1.ESMRY");
+
+        ExtESmry esmry("SPE1CASE1.ESMRY");
+        esmry.loadData();
+
+        for (const auto& key : esmry.keywordList())
+            ref.push_back(esmry.get(key));
+
+        std::filesystem::remove("SPE1CASE1.ESMRY");
+    }
+
+    for (const auto layout : { ExtSmryLayout::Chunked, ExtSmryLayout::ChunkedCompressed }) {
+        ESmry smry("SPE1CASE1.SMSPEC");
+        BOOST_CHECK(smry.make_esmry_file(layout));
+
+        if (layout == ExtSmryLayout::ChunkedCompressed)
+            BOOST_CHECK(std::filesystem::file_size("SPE1CASE1.ESMRY") < transposed_size / 2);
+
+        ExtESmry esmry1("SPE1CASE1.ESMRY");
+
+        BOOST_CHECK_EQUAL(esmry1.numberOfTimeSteps(), 123);
+        BOOST_CHECK_EQUAL(esmry1.numberOfVectors(), ref.size());
+        BOOST_CHECK(esmry1.all_steps_available());
+
+        const auto& keys = esmry1.keywordList();
+
+        // one by one and all in one go
+
+        for (size_t n = 0; n < keys.size(); n += 7)
+            BOOST_CHECK(esmry1.get(keys[n]) == ref[n]);
+
+        esmry1.loadData();
+
+        for (size_t n = 0; n < keys.size(); n++)
+            BOOST_CHECK(esmry1.get(keys[n]) == ref[n]);
+
+        std::filesystem::remove("SPE1CASE1.ESMRY");
+    }
+
+    // trailing time block only partially written, as for an ESMRY file
+    // from an active run. Only complete blocks should be used
+
+    {
+        Opm::EclIO::EclOutput outFile("TMP1.ESMRY", false, std::ios::out);
+
+        outFile.write<int>("START", {1, 1, 2020, 0, 0, 0, 0});
+        outFile.write("KEYCHECK", std::vector<std::string>{"TIME", "FOPR"});
+        outFile.write("UNITS", std::vector<std::string>{"DAYS", "SM3/DAY"});
+
+        ExtSmryBlocks::writeSpec(outFile, 2, ExtSmryBlocks::Compression::DeltaShuffle);
+
+        const std::vector<std::vector<float>> data { {1.0, 2.0, 3.0, 4.0, 5.0},
+                                                     {10.0, 10.0, 12.0, 12.0, 12.0} };
+
+        ExtSmryBlocks::writeBlock(outFile, {0, 1, 0}, {0, 1, 2}, data, 0, ExtSmryBlocks::Compression::DeltaShuffle);
+        ExtSmryBlocks::writeBlock(outFile, {1, 1}, {3, 4}, data, 3, ExtSmryBlocks::Compression::DeltaShuffle);
+    }
+
+    const auto full_size = std::filesystem::file_size("TMP1.ESMRY");
+
+    {
+        ExtESmry esmry("TMP1.ESMRY");
+        BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), 5);
+        BOOST_CHECK(esmry.get("FOPR") == std::vector<float>({10.0, 10.0, 12.0, 12.0, 12.0}));
+        BOOST_CHECK(esmry.get_at_rstep("TIME") == std::vector<float>({2.0, 4.0, 5.0}));
+    }
+
+    std::filesystem::resize_file("TMP1.ESMRY", full_size - 6);
+
+    {
+        ExtESmry esmry("TMP1.ESMRY");
+        BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), 3);
+        BOOST_CHECK(esmry.get("TIME") == std::vector<float>({1.0, 2.0, 3.0}));
+    }
+}
@@ -72,3 +72,63 @@ BOOST_AUTO_TEST_CASE(TESTInplace) {
     BOOST_CHECK( v1 == e1 );
 
 }
+
+BOOST_AUTO_TEST_CASE(TESTInplaceDense) {
+    Inplace oip;
+
+    // Grow the region rows of one set while another set has values.
+    oip.add("FIPNUM", Inplace::Phase::OIL, 1, 10);
+    oip.add("FIPABC", Inplace::Phase::GAS, 2, 20);
+    oip.add("FIPNUM", Inplace::Phase::OIL, 40, 30);
+    oip.add("FIPABC", Inplace::Phase::WATER, 17, 40);
+
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 1), 10);
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 40), 30);
+    BOOST_CHECK_EQUAL( oip.get("FIPABC", Inplace::Phase::GAS, 2), 20);
+    BOOST_CHECK_EQUAL( oip.get("FIPABC", Inplace::Phase::WATER, 17), 40);
+    BOOST_CHECK( !oip.has("FIPABC", Inplace::Phase::GAS, 17) );
+    BOOST_CHECK( !oip.has("FIPNUM", Inplace::Phase::OIL, 41) );
+    BOOST_CHECK_EQUAL( oip.max_region(), 40);
+    BOOST_CHECK_EQUAL( oip.max_region("FIPABC"), 17);
+
+    // Equality does not depend on insertion order.
+    Inplace oip2;
+    oip2.add("FIPABC", Inplace::Phase::WATER, 17, 40);
+    oip2.add("FIPNUM", Inplace::Phase::OIL, 40, 30);
+    oip2.add("FIPABC", Inplace::Phase::GAS, 2, 20);
+    BOOST_CHECK( !(oip == oip2) );
+
+    oip2.add("FIPNUM", Inplace::Phase::OIL, 1, 10);
+    BOOST_CHECK( oip == oip2 );
+}
+
+BOOST_AUTO_TEST_CASE(TESTInplaceRegionSums) {
+    const std::unordered_map<std::string, std::vector<int>> regions = {
+        { "FIPNUM", { 1, 1, 2, 2, 0, 3 } },
+        { "FIPABC", { 2, 2, 2, 1, 1, 0 } },
+    };
+
+    const std::unordered_map<Inplace::Phase, std::vector<double>> cell_values = {
+        { Inplace::Phase::OIL,        { 1, 2, 3, 4, 5, 6 } },
+        { Inplace::Phase::PoreVolume, { 10, 20, 30, 40, 50, 60 } },
+    };
+
+    Inplace oip;
+    oip.add_region_sums(regions, cell_values);
+
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 1), 3);
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 2), 7);
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::OIL, 3), 6);
+    BOOST_CHECK_EQUAL( oip.get("FIPNUM", Inplace::Phase::PoreVolume, 2), 70);
+    BOOST_CHECK_EQUAL( oip.get("FIPABC", Inplace::Phase::OIL, 1), 9);
+    BOOST_CHECK_EQUAL( oip.get("FIPABC", Inplace::Phase::OIL, 2), 6);
+    BOOST_CHECK_EQUAL( oip.get("FIPABC", Inplace::Phase::PoreVolume, 1), 90);
+    BOOST_CHECK_EQUAL( oip.max_region("FIPNUM"), 3);
+    BOOST_CHECK_EQUAL( oip.max_region("FIPABC"), 2);
+    BOOST_CHECK_THROW( oip.get("FIPNUM", Inplace::Phase::GAS, 1), std::exception);
+
+    const std::unordered_map<Inplace::Phase, std::vector<double>> short_values = {
+        { Inplace::Phase::OIL, { 1, 2, 3 } },
+    };
+    BOOST_CHECK_THROW( oip.add_region_sums(regions, short_values), std::invalid_argument);
+}
@@ -0,0 +1,154 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE PersistentMapTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/PersistentMap.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_set>
+
+namespace {
+
+// Forces all keys into a few slots to exercise deep tries and collisions.
+struct PoorHash
+{
+    std::size_t operator()(const std::string& key) const
+    {
+        return key.size() % 3;
+    }
+};
+
+template <class Map>
+std::map<std::string, int> contents(const Map& map)
+{
+    std::map<std::string, int> result;
+    for (const auto& [key, value] : map) {
+        BOOST_CHECK_MESSAGE(result.emplace(key, value).second,
+                            "Key " << key << " visited twice");
+    }
+
+    return result;
+}
+
+template <class Map>
+std::size_t numNodes(const Map& map, std::unordered_set<const void*>& seen)
+{
+    std::size_t count = 0;
+    map.visitNodes([&seen, &count](const void* node, std::size_t)
+    {
+        if (! seen.insert(node).second) {
+            return false;
+        }
+
+        ++count;
+        return true;
+    });
+
+    return count;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Insert_Find)
+{
+    Opm::PersistentMap<std::string, int> map;
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.begin() == map.end());
+    BOOST_CHECK(map.find("W1") == nullptr);
+
+    std::map<std::string, int> expect;
+    for (int i = 0; i < 2000; ++i) {
+        const auto key = "W" + std::to_string(i);
+        map.insert_or_assign(key, i);
+        expect[key] = i;
+    }
+
+    map.insert_or_assign("W17", -17);
+    expect["W17"] = -17;
+
+    BOOST_CHECK_EQUAL(map.size(), expect.size());
+    BOOST_CHECK(contents(map) == expect);
+
+    for (const auto& [key, value] : expect) {
+        const auto* found = map.find(key);
+        BOOST_REQUIRE(found != nullptr);
+        BOOST_CHECK_EQUAL(*found, value);
+    }
+
+    BOOST_CHECK(! map.contains("W2000"));
+    BOOST_CHECK(! map.contains(""));
+}
+
+BOOST_AUTO_TEST_CASE(Collisions)
+{
+    Opm::PersistentMap<std::string, int, PoorHash> map;
+
+    std::map<std::string, int> expect;
+    for (int i = 0; i < 100; ++i) {
+        const auto key = std::string(i % 7 + 1, 'A') + std::to_string(i);
+        map.insert_or_assign(key, i);
+        expect[key] = i;
+    }
+
+    map.insert_or_assign("A0", 42);
+    expect["A0"] = 42;
+
+    BOOST_CHECK_EQUAL(map.size(), expect.size());
+    BOOST_CHECK(contents(map) == expect);
+    BOOST_CHECK_EQUAL(*map.find("A0"), 42);
+    BOOST_CHECK(map.find("B0") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Copies_Share_Storage)
+{
+    Opm::PersistentMap<std::string, int> map;
+    for (int i = 0; i < 1000; ++i) {
+        map.insert_or_assign("G" + std::to_string(i), i);
+    }
+
+    auto copy = map;
+    BOOST_CHECK(copy.sharesStorage(map));
+
+    copy.insert_or_assign("G10", 100);
+    copy.insert_or_assign("NEW", 1);
+    BOOST_CHECK(! copy.sharesStorage(map));
+
+    BOOST_CHECK_EQUAL(*map.find("G10"), 10);
+    BOOST_CHECK(! map.contains("NEW"));
+    BOOST_CHECK_EQUAL(map.size(), std::size_t{1000});
+
+    BOOST_CHECK_EQUAL(*copy.find("G10"), 100);
+    BOOST_CHECK_EQUAL(*copy.find("NEW"), 1);
+    BOOST_CHECK_EQUAL(copy.size(), std::size_t{1001});
+
+    // Only the paths to the two updated entries are new.
+    std::unordered_set<const void*> seen;
+    const auto original = numNodes(map, seen);
+    const auto added = numNodes(copy, seen);
+    BOOST_CHECK(original > 10);
+    BOOST_CHECK(added >= 1);
+    BOOST_CHECK(added <= 2 * 3);
+}
@@ -24,6 +24,7 @@
 
 #include <opm/output/data/Cells.hpp>
 #include <opm/output/data/Groups.hpp>
+#include <opm/output/data/Solution.hpp>
 #include <opm/output/data/Wells.hpp>
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
 #include <opm/output/eclipse/EclipseIO.hpp>
@@ -35,6 +36,7 @@
 #include <opm/io/eclipse/OutputStream.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/Box.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
@@ -646,6 +648,69 @@ BOOST_AUTO_TEST_CASE(EclipseReadWriteWellStateData_double) {
     compare_equal( state1 , state2 , solution_keys);
 }
 
+BOOST_AUTO_TEST_CASE(LoadSolutionSubset) {
+    const auto keys = std::vector<RestartKey> {
+        {"PRESSURE", UnitSystem::measure::pressure},
+        {"SWAT",     UnitSystem::measure::identity},
+    };
+
+    WorkArea test_area("test_Restart");
+    test_area.copyIn("BASE_SIM.DATA");
+    Setup setup("BASE_SIM.DATA");
+    auto st = sim_state(setup.schedule);
+    Action::State action_state;
+    UDQState udq_state(1);
+
+    const auto state = first_sim(setup, action_state, st, udq_state, true);
+    const auto& units = setup.es.getUnits();
+
+    const auto check = [&state, &keys](const data::Solution&   sol,
+                                       const std::vector<int>& cells)
+    {
+        for (const auto& key : keys) {
+            const auto& subset = sol.data(key.key);
+            const auto& full = state.solution.data(key.key);
+
+            BOOST_REQUIRE_EQUAL(subset.size(), cells.size());
+            for (std::size_t i = 0; i < cells.size(); ++i) {
+                BOOST_CHECK_CLOSE(subset[i], full[cells[i]], 1.0e-8);
+            }
+        }
+    };
+
+    {
+        const auto cells = std::vector<int> { 999, 0, 17, 17, 500 };
+        check(RestartIO::loadSolution("BASE_SIM.UNRST", 1, keys, cells, units), cells);
+    }
+
+    {
+        const auto& grid = setup.grid;
+        const auto box = Box {
+            grid,
+            [&grid](const std::size_t i) { return grid.cellActive(i); },
+            [&grid](const std::size_t i) { return grid.activeIndex(i); },
+            2, 4, 3, 3, 5, 9
+        };
+
+        auto cells = std::vector<int>{};
+        for (const auto& cell : box.index_list()) {
+            cells.push_back(static_cast<int>(cell.active_index));
+        }
+
+        BOOST_CHECK_EQUAL(cells.size(), std::size_t{15});
+        check(RestartIO::loadSolution("BASE_SIM.UNRST", 1, keys, box, units), cells);
+    }
+
+    BOOST_CHECK_THROW(RestartIO::loadSolution("BASE_SIM.UNRST", 1,
+                                              {{"SOIL", UnitSystem::measure::identity, true}},
+                                              std::vector<int>{ 0 }, units),
+                      std::runtime_error);
+
+    BOOST_CHECK_THROW(RestartIO::loadSolution("BASE_SIM.UNRST", 1, keys,
+                                              std::vector<int>{ 1000 }, units),
+                      std::out_of_range);
+}
+
 BOOST_AUTO_TEST_CASE(WriteWrongSOlutionSize) {
     namespace OS = ::Opm::EclIO::OutputStream;
 
@@ -38,8 +38,12 @@
 #include <opm/input/eclipse/EclipseState/EclipseConfig.hpp>
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
 #include <opm/input/eclipse/EclipseState/TracerConfig.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Python/Python.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/Fault.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaultCollection.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaultFace.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -332,6 +336,42 @@ TEST_FOR_TYPE(WellType)
 TEST_FOR_TYPE(WListManager)
 TEST_FOR_TYPE(WriteRestartFileEvents)
 
+BOOST_AUTO_TEST_CASE(Schedule_Shared_Wells)
+{
+    const auto deck = Opm::Parser{}.parseString(R"(
+START
+10 MAI 2007 /
+SCHEDULE
+WELSPECS
+     'W1'        'G1'   3   3  3.33       'OIL'  7* /
+     'W2'        'G1'   3   4  3.33       'OIL'  7* /
+/
+TSTEP
+  10 10 /
+WCONPROD
+     'W2' 'OPEN' 'ORAT' 100 /
+/
+TSTEP
+  10 /
+)");
+
+    const Opm::EclipseGrid grid(10, 10, 10);
+    const Opm::TableManager tables(deck);
+    const Opm::FieldPropsManager fp(deck, Opm::Phases{true, true, true}, grid, tables);
+    Opm::Schedule sched(deck, grid, fp, Opm::Runspec(deck), std::make_shared<Opm::Python>());
+
+    auto restored = PackUnpack(sched);
+    const auto& sched2 = std::get<0>(restored);
+    BOOST_CHECK_EQUAL(std::get<1>(restored), std::get<2>(restored));
+    BOOST_CHECK(sched2 == sched);
+
+    // Report steps of the restored schedule share unchanged wells.
+    BOOST_CHECK(sched2[1].wells.storage().sharesStorage(sched2[0].wells.storage()));
+    BOOST_CHECK(sched2[3].wells.storage().sharesStorage(sched2[2].wells.storage()));
+    BOOST_CHECK(sched2[2].wells.get_ptr("W1") == sched2[1].wells.get_ptr("W1"));
+    BOOST_CHECK(sched2[2].wells.get_ptr("W2") != sched2[1].wells.get_ptr("W2"));
+}
+
 
 bool init_unit_test_func()
 {
@@ -0,0 +1,143 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestSnapshotFile
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/SnapshotFile.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include "tests/WorkArea.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+void writeDeck(const std::string& poro)
+{
+    {
+        std::ofstream props("props.inc");
+        props << "PORO\n 8*" << poro << " /\n";
+    }
+
+    std::ofstream data("CASE.DATA");
+    data << R"(RUNSPEC
+DIMENS
+ 2 2 2 /
+GRID
+INCLUDE
+ 'props.inc' /
+PERMX
+ 8*100 /
+)";
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Deck_Round_Trip)
+{
+    WorkArea work;
+    writeDeck("0.25");
+
+    const auto deck = Opm::Parser{}.parseFile("CASE.DATA");
+    const auto files = deck.tree().files();
+    BOOST_REQUIRE_EQUAL(files.size(), std::size_t{2});
+
+    const auto extra = std::map<std::string, std::vector<int>> {
+        { "A", { 1, 2, 3 } },
+        { "B", {} },
+    };
+
+    const Opm::SnapshotFile snapshot("CASE.SNAPSHOT");
+    BOOST_CHECK(! snapshot.isValid("key"));
+
+    snapshot.save(files, "key", deck, extra);
+    BOOST_CHECK(snapshot.isValid("key"));
+    BOOST_CHECK(! snapshot.isValid("other key"));
+
+    Opm::Deck restored;
+    std::map<std::string, std::vector<int>> restored_extra;
+    BOOST_REQUIRE(snapshot.load("key", restored, restored_extra));
+
+    BOOST_CHECK(restored == deck);
+    BOOST_CHECK(restored_extra == extra);
+    BOOST_CHECK_EQUAL(restored["PORO"].back().getSIDoubleData()[7], 0.25);
+
+    BOOST_CHECK(! Opm::SnapshotFile("CASE.SNAPSHOT").load("other key", restored));
+}
+
+BOOST_AUTO_TEST_CASE(Changed_Input_Invalidates)
+{
+    WorkArea work;
+    writeDeck("0.25");
+
+    const auto deck = Opm::Parser{}.parseFile("CASE.DATA");
+
+    const Opm::SnapshotFile snapshot("CASE.SNAPSHOT");
+    snapshot.save(deck.tree().files(), "", deck);
+    BOOST_CHECK(snapshot.isValid(""));
+
+    // Same size, different contents of include file.
+    writeDeck("0.35");
+    BOOST_CHECK(! snapshot.isValid(""));
+
+    Opm::Deck restored;
+    BOOST_CHECK(! snapshot.load("", restored));
+    BOOST_CHECK(restored.empty());
+
+    writeDeck("0.25");
+    BOOST_CHECK(snapshot.load("", restored));
+    BOOST_CHECK(restored == deck);
+
+    std::filesystem::remove("props.inc");
+    BOOST_CHECK(! snapshot.isValid(""));
+}
+
+BOOST_AUTO_TEST_CASE(Corrupt_Snapshot)
+{
+    WorkArea work;
+
+    const auto values = std::vector<double> { 1.0, 2.0, 3.0 };
+    const Opm::SnapshotFile snapshot("VALUES.SNAPSHOT");
+    snapshot.save({}, "", values);
+
+    // Truncated payload.
+    std::filesystem::resize_file("VALUES.SNAPSHOT",
+                                 std::filesystem::file_size("VALUES.SNAPSHOT") - 4);
+
+    std::vector<double> restored;
+    BOOST_CHECK(! snapshot.load("", restored));
+
+    {
+        std::ofstream os("VALUES.SNAPSHOT", std::ios::binary | std::ios::trunc);
+        os << "not a snapshot";
+    }
+
+    BOOST_CHECK(! snapshot.isValid(""));
+    BOOST_CHECK_THROW(snapshot.save({ "no-such-file.inc" }, "", values), std::runtime_error);
+}
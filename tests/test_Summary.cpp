@@ -44,8 +44,13 @@
 #include <opm/input/eclipse/Units/Units.hpp>
 
 #include <opm/io/eclipse/ERsm.hpp>
+#include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/ExtESmry.hpp>
+#include <opm/io/eclipse/ExtSmryBlocks.hpp>
 
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -1754,6 +1759,98 @@ BOOST_AUTO_TEST_CASE(field_keywords) {
     BOOST_CHECK_CLOSE(121.21e6, ecl_sum_get_field_var(resp, 2, "FHPV"), 1.0e-5);
 }
 
+BOOST_AUTO_TEST_CASE(field_totals_continued) {
+    setup cfg( "test_summary_field_totals_continued" );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    SummaryState st(TimeService::now());
+
+    // Cumulatives restored from a restart file.  Output of totals must
+    // continue from these values.
+    st.update("FOPT", 1000.0);
+    st.update("FWPT", 500.0);
+
+    writer.eval( st, 0, 0 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 0, false);
+    writer.eval( st, 1, 1 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 1, false);
+    writer.write();
+
+    auto res = readsum( cfg.name );
+    const auto* resp = res.get();
+
+    BOOST_CHECK_CLOSE( 1000.0 + 10.1 + 20.1, ecl_sum_get_field_var( resp, 1, "FOPT" ), 1e-5 );
+    BOOST_CHECK_CLOSE(  500.0 + 10.0 + 20.0, ecl_sum_get_field_var( resp, 1, "FWPT" ), 1e-5 );
+    BOOST_CHECK_CLOSE( st.get("FOPT"), ecl_sum_get_field_var( resp, 1, "FOPT" ), 1e-5 );
+    BOOST_CHECK_CLOSE( 10.1 + 20.1, ecl_sum_get_field_var( resp, 1, "FOPR" ), 1e-5 );
+}
+
+BOOST_AUTO_TEST_CASE(params_match_summary_state) {
+    setup cfg( "test_summary_params_match_state" );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    SummaryState st(TimeService::now());
+
+    writer.eval( st, 0, 0 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 0, false);
+    writer.eval( st, 1, 1 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+
+    // UDQ values are assigned by the UDQ machinery, not by the summary
+    // evaluators, and must be picked up from the SummaryState.
+    st.update_well_var("W_1", "WUBHP", 42.0);
+    st.update_well_var("W_2", "WUBHP", 43.0);
+
+    writer.add_timestep( st, 1, false);
+    writer.write();
+
+    auto res = readsum( cfg.name );
+    const auto* resp = res.get();
+
+    BOOST_CHECK_CLOSE( 42.0, ecl_sum_get_well_var( resp, 1, "W_1", "WUBHP" ), 1e-5 );
+    BOOST_CHECK_CLOSE( 43.0, ecl_sum_get_well_var( resp, 1, "W_2", "WUBHP" ), 1e-5 );
+
+    auto num_checked = std::size_t{0};
+    for (const auto& key : resp->keywordList()) {
+        if (! st.has(key)) {
+            continue;
+        }
+
+        BOOST_TEST_INFO("Summary vector " << key);
+        BOOST_CHECK_EQUAL( static_cast<float>(st.get(key)), resp->get(key)[1] );
+
+        ++num_checked;
+    }
+
+    BOOST_CHECK( num_checked > std::size_t{100} );
+}
+
+BOOST_AUTO_TEST_CASE(params_from_other_summary_state) {
+    setup cfg( "test_summary_params_other_state" );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    SummaryState st(TimeService::now());
+
+    writer.eval( st, 0, 0 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.add_timestep( st, 0, false);
+    writer.eval( st, 1, 1 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+
+    // Values evaluated into 'st' must not leak into the output of a
+    // different SummaryState, e.g., one restored from a restart file.
+    auto other = st;
+    other.update_well_var("W_1", "WOPR", 1234.5);
+    other.update_group_var("G_1", "GOPT", 6789.0);
+
+    writer.add_timestep( other, 1, false);
+    writer.write();
+
+    auto res = readsum( cfg.name );
+    const auto* resp = res.get();
+
+    BOOST_CHECK_CLOSE( 1234.5, ecl_sum_get_well_var( resp, 1, "W_1", "WOPR" ), 1e-5 );
+    BOOST_CHECK_CLOSE( other.get_group_var("G_1", "GOPT"),
+                       ecl_sum_get_group_var( resp, 1, "G_1", "GOPT" ), 1e-5 );
+}
+
 #if 0
 BOOST_AUTO_TEST_CASE(report_steps_time) {
     setup cfg( "test_summary_report_steps_time" );
@@ -1802,6 +1899,40 @@ BOOST_AUTO_TEST_CASE(skip_unknown_var) {
     BOOST_CHECK( !ecl_sum_has_field_var( resp, "FGST" ) );
 }
 
+BOOST_AUTO_TEST_CASE(esmry_chunked_layout) {
+    setup cfg( "test_summary_esmry_chunked" );
+
+    auto& ioconfig = cfg.es.getIOConfig();
+    ioconfig.setOutputDir(".");
+    ioconfig.setBaseName(cfg.name);
+    ioconfig.setEsmryLayout(EclIO::ExtSmryLayout::ChunkedCompressed);
+
+    {
+        out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name, true );
+        SummaryState st(TimeService::now());
+        writer.eval( st, 0, 0 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+        writer.add_timestep( st, 0, false);
+        writer.eval( st, 1, 1 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+        writer.add_timestep( st, 1, false);
+        writer.eval( st, 2, 2 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+        writer.add_timestep( st, 2, false);
+        writer.write(true);
+    }
+
+    {
+        EclIO::EclFile file(cfg.name + ".ESMRY");
+        BOOST_CHECK(file.hasKey("BLKSPEC"));
+    }
+
+    EclIO::ESmry smry(cfg.name + ".SMSPEC");
+    EclIO::ExtESmry esmry(cfg.name + ".ESMRY");
+
+    BOOST_CHECK_EQUAL(esmry.numberOfTimeSteps(), 3);
+
+    for (const auto& key : { "TIME", "FOPR", "FOPT", "WOPR:W_1", "GWPR:G_1" })
+        BOOST_CHECK(esmry.get(key) == smry.get(key));
+}
+
 BOOST_AUTO_TEST_CASE(region_vars) {
     setup cfg( "region_vars" );
 
@@ -2825,6 +2956,152 @@ BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     BOOST_CHECK_EQUAL(st.get_conn_var("OP2", "COPR", 101, 99), 99);
 }
 
+BOOST_AUTO_TEST_CASE(Test_SummaryState_Batched) {
+    Opm::SummaryState st(TimeService::from_time_t(0));
+
+    st.update_well_vars("WOPR", {"OP1", "OP2", "OP3"}, {1.0, 2.0, 3.0});
+    st.update_well_vars("WOPT", {"OP1", "OP2"}, {10.0, 20.0});
+    BOOST_CHECK_THROW(st.update_well_vars("WOPR", {"OP1"}, {1.0, 2.0}), std::invalid_argument);
+
+    BOOST_CHECK_EQUAL(st.get_well_var("OP2", "WOPR"), 2.0);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP3"), 3.0);
+    BOOST_CHECK_EQUAL(st.num_wells(), 3U);
+
+    // Identifiers are stable, and updates through them are visible
+    // through the string API.
+    const auto wopt = st.well_var_id("WOPT");
+    const auto op1 = st.well_id("OP1");
+    const auto op4 = st.well_id("OP4");
+    BOOST_CHECK_EQUAL(st.well_id("OP1"), op1);
+    BOOST_CHECK_EQUAL(st.get_well_var(wopt, op4, -1.0), -1.0);
+
+    st.update_well_vars(wopt, {op1, op4}, {5.0, 7.0});
+    BOOST_CHECK_EQUAL(st.get_well_var(wopt, op1, -1.0), 15.0);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 15.0);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 15.0);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP4"), 7.0);
+    BOOST_CHECK_EQUAL(st.num_wells(), 4U);
+    BOOST_CHECK_THROW(st.update_well_vars(wopt, {op4 + 1}, {1.0}), std::out_of_range);
+
+    st.update_group_vars("GOPR", {"G1", "FIELD"}, {3.0, 4.0});
+    const auto gopr = st.group_var_id("GOPR");
+    st.update_group_vars(gopr, {st.group_id("G1")}, {5.0});
+    BOOST_CHECK_EQUAL(st.get("GOPR:G1"), 5.0);
+    BOOST_CHECK_EQUAL(st.get_group_var(gopr, st.group_id("FIELD"), 0.0), 4.0);
+    BOOST_CHECK(st.groups() == std::vector<std::string>({"FIELD", "G1"}));
+
+    // The general string API covers all values.
+    BOOST_CHECK_EQUAL(st.size(), 8U);
+
+    // Equality does not depend on the order of first appearance.
+    Opm::SummaryState reordered(TimeService::from_time_t(0));
+    reordered.update_group_var("FIELD", "GOPR", 4.0);
+    reordered.update_group_var("G1", "GOPR", 5.0);
+    reordered.update_well_var("OP4", "WOPT", 7.0);
+    reordered.update_well_var("OP3", "WOPR", 3.0);
+    reordered.update_well_var("OP2", "WOPT", 20.0);
+    reordered.update_well_var("OP2", "WOPR", 2.0);
+    reordered.update_well_var("OP1", "WOPT", 15.0);
+    reordered.update_well_var("OP1", "WOPR", 1.0);
+    BOOST_CHECK(reordered == st);
+
+    reordered.update_well_var("OP1", "WOPR", 1.5);
+    BOOST_CHECK(!(reordered == st));
+
+    Opm::SummaryState appended(TimeService::from_time_t(0));
+    appended.append(st);
+    BOOST_CHECK(appended == st);
+}
+
+BOOST_AUTO_TEST_CASE(Test_SummaryState_Variable_Defined) {
+    Opm::SummaryState st(TimeService::from_time_t(0));
+
+    // Interning a variable name does not define the variable.
+    st.well_var_id("WUX");
+    st.group_var_id("GUX");
+    BOOST_CHECK( !st.has_well_var("WUX") );
+    BOOST_CHECK( !st.has_group_var("GUX") );
+
+    st.update_well_var("OP1", "WUX", 1.0);
+    st.update_group_var("G1", "GUX", 2.0);
+    BOOST_CHECK( st.has_well_var("WUX") );
+    BOOST_CHECK( st.has_group_var("GUX") );
+    BOOST_CHECK( st.wells() == std::vector<std::string>{"OP1"} );
+
+    st.erase_well_var("OP1", "WUX");
+    st.erase_group_var("G1", "GUX");
+    BOOST_CHECK( !st.has_well_var("WUX") );
+    BOOST_CHECK( !st.has_group_var("GUX") );
+    BOOST_CHECK( st.wells().empty() );
+    BOOST_CHECK( st.groups().empty() );
+    BOOST_CHECK( !st.has("WUX:OP1") );
+}
+
+BOOST_AUTO_TEST_CASE(Test_SummaryState_String_View) {
+    Opm::SummaryState st(TimeService::from_time_t(0));
+
+    st.update("FOPR", 1.0);
+    st.set("WWCT:OP2", 0.5);
+    st.update_well_var("OP1", "WOPR", 2.0);
+    st.update_group_var("G1", "GOPR", 3.0);
+    st.update_conn_var("OP1", "CWIT", 17, 4.0);
+    st.update_segment_var("OP1", "SOFR", 2, 5.0);
+
+    // Values in the dense tables are seen through the string API, but
+    // are not copied into the general map.
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP1"), 2.0);
+    BOOST_CHECK_EQUAL(st.get("GOPR:G1"), 3.0);
+    BOOST_CHECK_EQUAL(st.get("CWIT:OP1:17"), 4.0);
+    BOOST_CHECK_EQUAL(st.get("SOFR:OP1:2"), 5.0);
+    BOOST_CHECK( !st.has("CWIT:OP1:18") );
+    BOOST_CHECK( !st.has("WOPR:OP2") );
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP2", -1.0), -1.0);
+    BOOST_CHECK_THROW(st.get("GOPR:G2"), std::out_of_range);
+
+    const auto expect = std::map<std::string, double> {
+        {"FOPR", 1.0}, {"WWCT:OP2", 0.5}, {"WOPR:OP1", 2.0},
+        {"GOPR:G1", 3.0}, {"CWIT:OP1:17", 4.0}, {"SOFR:OP1:2", 5.0},
+    };
+
+    auto all = std::map<std::string, double>{};
+    for (const auto& [key, value] : st)
+        all.emplace(key, value);
+
+    BOOST_CHECK(all == expect);
+    BOOST_CHECK_EQUAL(st.size(), expect.size());
+
+    // Assignments through the general API go to the dense tables if the
+    // value is stored there.
+    st.set("WOPR:OP1", 6.0);
+    st.update("CWIT:OP1:17", 1.0);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 6.0);
+    BOOST_CHECK_EQUAL(st.get_conn_var("OP1", "CWIT", 17), 5.0);
+
+    // A value assigned through the general API moves to the dense table
+    // once it is updated there.
+    st.update_well_var("OP2", "WWCT", 0.25);
+    BOOST_CHECK_EQUAL(st.get("WWCT:OP2"), 0.25);
+    BOOST_CHECK_EQUAL(st.size(), expect.size());
+
+    BOOST_CHECK( st.erase("SOFR:OP1:2") );
+    BOOST_CHECK( !st.has_segment_var("OP1", "SOFR", 2) );
+    BOOST_CHECK( st.erase("GOPR:G1") );
+    BOOST_CHECK( !st.has_group_var("G1", "GOPR") );
+    BOOST_CHECK( !st.erase("GOPR:G1") );
+    BOOST_CHECK_EQUAL(st.size(), expect.size() - 2);
+
+    // The name to identifier maps are rebuilt when unpacking.
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+    ser.pack(st);
+
+    Opm::SummaryState copy;
+    ser.unpack(copy);
+    BOOST_CHECK(copy == st);
+    BOOST_CHECK_EQUAL(copy.well_id("OP1"), st.well_id("OP1"));
+    BOOST_CHECK_EQUAL(copy.get("WOPR:OP1"), 6.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary
 
 // ####################################################################
@@ -6482,6 +6759,7 @@ BOOST_AUTO_TEST_SUITE(Summary_State)
 
 BOOST_AUTO_TEST_CASE(SummaryState_TOTAL) {
     SummaryState st(TimeService::now());
+
     st.update("FOPR", 100);
     BOOST_CHECK_EQUAL(st.get("FOPR"), 100);
     st.update("FOPR", 100);
@@ -6525,6 +6803,18 @@ BOOST_AUTO_TEST_CASE(SummaryState_TOTAL) {
     st.update_group_var("G1", "GOPTH", 100);
     BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPTH"), 200);
 
+    // The update_xxx() methods return the resulting, possibly accumulated,
+    // value.
+    BOOST_CHECK_EQUAL(st.update_group_var("G1", "GOPTH", 100), 300);
+    BOOST_CHECK_EQUAL(st.update_group_var("G1", "GOPR", 10), 10);
+    BOOST_CHECK_EQUAL(st.update_well_var("OP1", "WOPT", 100), 300);
+    BOOST_CHECK_EQUAL(st.update_conn_var("OP1", "COPT", 7, 5), 5);
+    BOOST_CHECK_EQUAL(st.update_conn_var("OP1", "COPT", 7, 5), 10);
+    BOOST_CHECK_EQUAL(st.update_segment_var("OP1", "SOFR", 2, 5), 5);
+    BOOST_CHECK_EQUAL(st.update_segment_var("OP1", "SOFR", 2, 6), 6);
+    BOOST_CHECK_EQUAL(st.update("FOPT", 100), 300);
+    BOOST_CHECK_EQUAL(st.update("FOPR", 50), 50);
+
     st.update("FOPTH", 100);
     BOOST_CHECK_EQUAL(st.get("FOPTH"), 100);
     st.update("FOPTH", 100);